@@ -10,6 +10,10 @@ Import("env")
 
 # Import our version generation module
 import version
+import web_assets
+
+# Gzip the config UI's stylesheet and script before anything compiles
+web_assets.generate_assets_header()
 
 def before_build(source, target, env):
     # Generate version header
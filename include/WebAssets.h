@@ -0,0 +1,385 @@
+#ifndef WEB_ASSETS_H
+#define WEB_ASSETS_H
+
+// Automatically generated from web/ by scripts/web_assets.py - do not edit manually
+
+#include <Arduino.h>
+
+namespace WebAssets {
+struct Asset {
+  const char* name;
+  const char* contentType;
+  const uint8_t* gzipped;
+  size_t size;
+  const char* etag;
+};
+
+// style.css: 17395 bytes, 3108 gzipped
+const uint8_t STYLE_CSS_GZ[] PROGMEM = {
+    0x1f, 0x8b, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x03, 0xcd, 0x5b, 0x5b, 0x8f, 0xdb, 0xb8,
+    0x15, 0x7e, 0xcf, 0xaf, 0x10, 0xb2, 0x08, 0x76, 0x1c, 0x58, 0x8e, 0x24, 0x5b, 0x1e, 0xdb, 0x41,
+    0x81, 0x76, 0xdb, 0x0d, 0x5a, 0x60, 0xf7, 0xa5, 0x41, 0xd1, 0x16, 0xc5, 0x3e, 0x50, 0x12, 0x65,
+    0xab, 0x23, 0x8b, 0x2a, 0x45, 0xcf, 0x25, 0x83, 0xfc, 0xf7, 0x92, 0xd4, 0xc5, 0xbc, 0x4a, 0xb4,
+    0x67, 0x92, 0x76, 0x8c, 0x64, 0xc6, 0xf6, 0x21, 0x79, 0x78, 0x78, 0xce, 0x77, 0x6e, 0x94, 0xe7,
+    0x79, 0xde, 0x0e, 0x23, 0x44, 0xbc, 0xe7, 0x37, 0x5e, 0xf7, 0xe3, 0xfb, 0x35, 0x2e, 0x8e, 0x00,
+    0x3f, 0xf9, 0x29, 0x2a, 0x11, 0xde, 0x79, 0x3f, 0x44, 0xe1, 0x76, 0xfd, 0x69, 0xf9, 0x51, 0xa0,
+    0x68, 0x60, 0x8a, 0xaa, 0x4c, 0xa4, 0xb9, 0x8d, 0xd9, 0x4b, 0xa2, 0x39, 0xa5, 0x29, 0x6c, 0x9a,
+    0x81, 0x62, 0xf5, 0xc7, 0x3f, 0x7c, 0x8a, 0x03, 0x91, 0x02, 0x62, 0x8c, 0xf0, 0xf0, 0x7d, 0xbe,
+    0x5a, 0x2d, 0x97, 0x6b, 0xf1, 0xfb, 0x07, 0x80, 0xab, 0xa2, 0xda, 0x9f, 0x29, 0xf2, 0xed, 0x26,
+    0x90, 0x66, 0x48, 0x40, 0x7a, 0xb7, 0xc7, 0xe8, 0x54, 0x65, 0x67, 0xa2, 0x4d, 0xbe, 0xcd, 0x81,
+    0x48, 0x94, 0x02, 0x9c, 0x09, 0x94, 0x7c, 0x22, 0xf6, 0x23, 0xd2, 0x10, 0xf8, 0x48, 0x84, 0xfd,
+    0x46, 0x71, 0xb4, 0xd5, 0xbe, 0x3e, 0x9e, 0x08, 0x64, 0xa3, 0xd7, 0x29, 0xdd, 0x6a, 0x26, 0xb1,
+    0x81, 0x70, 0x06, 0xcf, 0x3b, 0xc9, 0x20, 0x8c, 0xa0, 0xb4, 0x93, 0x5e, 0xa2, 0x07, 0x74, 0x0f,
+    0x19, 0x45, 0xb8, 0xbd, 0x5d, 0x67, 0x91, 0x59, 0xa2, 0x3d, 0xcd, 0x3a, 0x64, 0x2f, 0x93, 0x44,
+    0x7b, 0x8a, 0xe5, 0x66, 0x03, 0x97, 0xa9, 0x44, 0x51, 0x83, 0x94, 0x4a, 0x6c, 0xe7, 0x85, 0x18,
+    0x1e, 0x0d, 0x1c, 0x62, 0x90, 0x15, 0xa7, 0x66, 0xe7, 0x05, 0x8b, 0x58, 0x21, 0x68, 0x0e, 0x20,
+    0x43, 0x0f, 0xf4, 0x1b, 0x2f, 0xaa, 0x1f, 0xbd, 0x15, 0xfd, 0x87, 0xf7, 0x09, 0xb8, 0x09, 0xe6,
+    0xfc, 0xb5, 0x08, 0x67, 0x22, 0x71, 0x8e, 0xd2, 0x53, 0x23, 0x0c, 0x61, 0xaf, 0x65, 0x3f, 0x64,
+    0xb9, 0x9c, 0x7b, 0x61, 0x1c, 0xcc, 0xbd, 0x68, 0x45, 0xff, 0xd2, 0x86, 0x96, 0x08, 0x10, 0x76,
+    0xa8, 0xe7, 0xd1, 0x6c, 0xb1, 0x30, 0xd2, 0x56, 0x8c, 0xa5, 0x71, 0xc9, 0x89, 0x10, 0x54, 0x29,
+    0x6c, 0x6e, 0xc6, 0xd8, 0x1c, 0xfe, 0xf8, 0xf0, 0xde, 0xfb, 0x3b, 0xb8, 0x87, 0x5e, 0x02, 0xaa,
+    0xcc, 0xe3, 0x67, 0xd4, 0x78, 0xbe, 0x77, 0x04, 0x24, 0x3d, 0x50, 0x46, 0xbc, 0x5f, 0x7e, 0xfe,
+    0x53, 0xff, 0xe9, 0xfb, 0x0f, 0xc2, 0x8a, 0x25, 0xa2, 0x5c, 0x3e, 0xd0, 0x81, 0xe7, 0x73, 0x4d,
+    0x97, 0xf1, 0x4a, 0xd2, 0xf1, 0x23, 0xa4, 0xf2, 0x3c, 0xca, 0x54, 0x79, 0x9e, 0x86, 0xc1, 0xad,
+    0x2c, 0x5b, 0x84, 0x89, 0x4c, 0x14, 0x64, 0x6b, 0x98, 0x67, 0x66, 0x66, 0xff, 0x0c, 0x01, 0x3d,
+    0x2b, 0x8f, 0x71, 0x7b, 0x80, 0x65, 0xed, 0x51, 0xd5, 0x20, 0x05, 0xaa, 0xbc, 0xb3, 0x0a, 0x2b,
+    0x9c, 0x1e, 0xf8, 0x00, 0x49, 0xc5, 0x25, 0xa9, 0x04, 0x91, 0x24, 0x4a, 0x36, 0xa9, 0x62, 0x0f,
+    0x9a, 0xcd, 0xb4, 0x34, 0x5c, 0x69, 0xe8, 0xf7, 0x70, 0x0b, 0x53, 0xd8, 0xd9, 0xcb, 0xd7, 0x37,
+    0xfc, 0xd7, 0xef, 0xd9, 0xd6, 0x81, 0x77, 0x53, 0x63, 0x98, 0x43, 0xdc, 0x59, 0xb9, 0xdf, 0xa4,
+    0x07, 0x78, 0x84, 0x3b, 0x8f, 0x2a, 0xf2, 0xdd, 0x4c, 0xc0, 0x14, 0x15, 0x63, 0xac, 0xd6, 0x1b,
+    0x46, 0xec, 0xf5, 0x51, 0x21, 0xd4, 0x2d, 0x38, 0x84, 0xec, 0xa5, 0xd2, 0x49, 0x56, 0xac, 0x1a,
+    0xb9, 0xc1, 0x92, 0x41, 0x96, 0xc4, 0x49, 0xa6, 0x92, 0x28, 0xd6, 0xbc, 0xda, 0xc6, 0x41, 0x7c,
+    0xab, 0x12, 0xd9, 0x64, 0x1e, 0xc5, 0xf1, 0xbc, 0xff, 0x47, 0x25, 0x2f, 0x2a, 0xb1, 0x4d, 0xfa,
+    0x51, 0xc6, 0x5e, 0x66, 0xba, 0xfe, 0x04, 0x56, 0x01, 0x7b, 0xa9, 0x34, 0x1a, 0xac, 0xc4, 0xeb,
+    0x38, 0xd5, 0xa8, 0x74, 0x68, 0x51, 0xc1, 0xda, 0x0c, 0x2f, 0x11, 0xbc, 0xcd, 0x96, 0xda, 0x59,
+    0x58, 0x80, 0x62, 0x72, 0xdf, 0x17, 0x61, 0x46, 0xa4, 0x0f, 0x77, 0xc5, 0x8d, 0xa5, 0x36, 0xd4,
+    0x0d, 0x3a, 0xc4, 0x25, 0xbf, 0x8a, 0x9a, 0xfe, 0x5e, 0xd0, 0xdb, 0x04, 0x3d, 0xfa, 0x4d, 0xf1,
+    0x85, 0x43, 0x6c, 0xa7, 0x26, 0xf4, 0xa3, 0xf3, 0x40, 0x7a, 0x1a, 0xfb, 0xa2, 0xa2, 0x6b, 0x9c,
+    0x3f, 0xaa, 0x41, 0x96, 0x71, 0xfa, 0x40, 0xb2, 0x9f, 0x04, 0x65, 0x4f, 0xde, 0xf3, 0xd9, 0xee,
+    0x73, 0x54, 0x11, 0x3f, 0x07, 0xc7, 0xa2, 0x7c, 0xda, 0x79, 0x3e, 0xa8, 0xeb, 0x12, 0xfa, 0xcd,
+    0x53, 0x43, 0xe0, 0x71, 0xee, 0xfd, 0x54, 0x16, 0xd5, 0xdd, 0xaf, 0x20, 0xfd, 0xcc, 0xdf, 0x7f,
+    0xa2, 0x94, 0x73, 0xef, 0xed, 0x67, 0xb8, 0x47, 0xd0, 0xfb, 0xdb, 0x5f, 0xde, 0xce, 0xbd, 0xbf,
+    0xa2, 0x04, 0x11, 0x34, 0xf7, 0x1a, 0x50, 0x51, 0x09, 0x43, 0x5c, 0x08, 0x5a, 0x4f, 0x87, 0x42,
+    0xaa, 0x4b, 0xc5, 0xfe, 0x40, 0xa8, 0x57, 0x58, 0x08, 0x5e, 0x49, 0xb7, 0xbe, 0x7b, 0x80, 0x6f,
+    0x74, 0xab, 0x14, 0xe4, 0x22, 0xd1, 0x9d, 0x8d, 0x4d, 0xa0, 0x38, 0x16, 0xd5, 0x79, 0xb5, 0x20,
+    0xb8, 0x3f, 0x48, 0x9b, 0x5e, 0x50, 0x45, 0x24, 0x80, 0x72, 0x84, 0x05, 0x99, 0x1e, 0xc1, 0xa3,
+    0xff, 0x50, 0x64, 0xe4, 0xb0, 0xf3, 0xd6, 0x41, 0x50, 0x9b, 0xa4, 0xe9, 0x81, 0x13, 0x41, 0x06,
+    0x91, 0xb6, 0x8c, 0x74, 0x4e, 0x6f, 0xa6, 0x11, 0xd0, 0xb3, 0xa1, 0x27, 0x7f, 0xdc, 0x79, 0x29,
+    0x28, 0xd3, 0x1b, 0x99, 0x98, 0x1e, 0xeb, 0x7a, 0x9a, 0x6f, 0xf6, 0x93, 0x15, 0x4d, 0x5d, 0x02,
+    0x7a, 0x2a, 0x79, 0x09, 0x05, 0xe6, 0xd8, 0x3b, 0x3f, 0x2b, 0x70, 0x0b, 0xce, 0x3b, 0x26, 0x9b,
+    0xd3, 0xb1, 0x92, 0xb7, 0xdb, 0x82, 0x84, 0xb0, 0x57, 0x2e, 0x33, 0x50, 0x16, 0x7b, 0x36, 0x00,
+    0x56, 0x04, 0x62, 0xc3, 0xae, 0xcc, 0xdc, 0x46, 0x33, 0x51, 0xab, 0x06, 0xe5, 0x6b, 0x37, 0x18,
+    0x52, 0x6d, 0x6e, 0x50, 0x59, 0x64, 0xfd, 0x19, 0x0a, 0x10, 0x36, 0x53, 0x05, 0x3a, 0x8c, 0x32,
+    0x89, 0xaf, 0x67, 0xbd, 0x21, 0x80, 0x50, 0x7b, 0x4d, 0x80, 0xc8, 0xbe, 0x08, 0x5b, 0xed, 0x60,
+    0x05, 0x99, 0x67, 0xce, 0xdb, 0x09, 0x16, 0xb7, 0x22, 0x46, 0x28, 0xf1, 0x89, 0xb4, 0x8b, 0xf6,
+    0x43, 0x89, 0xf8, 0x71, 0xb0, 0xe6, 0x6e, 0x62, 0xfe, 0xee, 0xb2, 0x9d, 0x4e, 0x9d, 0x07, 0xb7,
+    0x48, 0x6a, 0xec, 0x90, 0x85, 0x4b, 0x5b, 0x31, 0x5a, 0xd2, 0xcd, 0x80, 0x3b, 0x14, 0x45, 0x82,
+    0x15, 0xb8, 0x17, 0x44, 0x67, 0xd1, 0xa2, 0x3d, 0xa8, 0xed, 0x12, 0x8a, 0xed, 0x1b, 0x32, 0x0f,
+    0x09, 0x87, 0x21, 0x22, 0x13, 0x40, 0x60, 0x83, 0xad, 0x4e, 0xd5, 0xe5, 0xda, 0x63, 0xe2, 0x9b,
+    0xcd, 0xa8, 0x3f, 0xc1, 0xa0, 0xd5, 0xfa, 0x0a, 0x55, 0xf0, 0x12, 0x7c, 0xb8, 0x44, 0x83, 0x2e,
+    0xd2, 0x89, 0xc9, 0x93, 0x7c, 0xe8, 0xac, 0x3b, 0x0e, 0x34, 0x33, 0x72, 0xb6, 0x1f, 0x82, 0x29,
+    0xc2, 0x16, 0xed, 0xce, 0x41, 0x59, 0x32, 0x47, 0xd5, 0x78, 0x10, 0x34, 0xd0, 0x20, 0xf4, 0x05,
+    0xa0, 0xc0, 0x40, 0xa3, 0xce, 0x31, 0xeb, 0x91, 0x12, 0x2d, 0x1d, 0x67, 0x1f, 0x0e, 0x05, 0x81,
+    0x9a, 0x3c, 0x24, 0x21, 0x9b, 0x66, 0x90, 0xd8, 0xd8, 0xb5, 0xde, 0xbc, 0x42, 0xe4, 0xa6, 0xe3,
+    0x68, 0x36, 0xca, 0x92, 0x61, 0xe7, 0x03, 0x78, 0xd3, 0x93, 0xba, 0x12, 0x0c, 0x2e, 0x94, 0xf3,
+    0xff, 0x08, 0x0d, 0x98, 0xa4, 0x68, 0x9c, 0x41, 0xe7, 0x39, 0x14, 0x59, 0x06, 0x2b, 0x7d, 0xfb,
+    0xbe, 0x86, 0xe8, 0x93, 0xbe, 0xe8, 0x3a, 0xa4, 0xd6, 0x85, 0xab, 0x05, 0x9c, 0x86, 0xd3, 0xf1,
+    0xdb, 0xa8, 0xc2, 0x8d, 0x39, 0x11, 0xe9, 0x59, 0x7a, 0xf1, 0xfc, 0x5d, 0x4e, 0xcb, 0x09, 0xc7,
+    0x14, 0xd4, 0x19, 0x3f, 0x97, 0x8e, 0x7f, 0xfd, 0x68, 0x2c, 0x90, 0xfb, 0xef, 0x53, 0x43, 0x8a,
+    0x9c, 0x99, 0x0c, 0x45, 0x89, 0x8a, 0x22, 0x02, 0x5b, 0x18, 0xfa, 0x09, 0x24, 0x0f, 0xb0, 0x9f,
+    0x9b, 0xfd, 0x70, 0x30, 0xf1, 0xa9, 0x05, 0x1e, 0x9b, 0x8b, 0x9d, 0xb5, 0xea, 0xdd, 0x9c, 0x4f,
+    0xf3, 0x3a, 0x8d, 0x51, 0x45, 0x51, 0x81, 0xa3, 0x08, 0x3c, 0x12, 0xfe, 0xad, 0x45, 0xfc, 0x1b,
+    0x07, 0x6c, 0x75, 0xda, 0x6b, 0xb4, 0x2b, 0x47, 0xf8, 0xe8, 0xb3, 0x2d, 0xd6, 0x52, 0xc8, 0xe7,
+    0x1c, 0x87, 0xf0, 0xf1, 0x18, 0x3d, 0xbc, 0xa2, 0x2b, 0xb5, 0x1e, 0x6c, 0xb7, 0x66, 0x09, 0x12,
+    0x58, 0x9a, 0xd6, 0x4b, 0x4a, 0x94, 0xde, 0x5d, 0xac, 0xca, 0x91, 0xb8, 0xb6, 0xdd, 0x15, 0x4d,
+    0xfb, 0x4e, 0x73, 0x40, 0xd2, 0x31, 0x5d, 0x54, 0xf5, 0x89, 0xa6, 0x05, 0x6d, 0xae, 0xa3, 0x9e,
+    0x7d, 0x3b, 0x28, 0x5c, 0x8b, 0xc1, 0xf5, 0x45, 0x56, 0x7b, 0x4d, 0x30, 0xf7, 0x02, 0xac, 0xb3,
+    0x3b, 0x92, 0x69, 0x29, 0x89, 0x3e, 0x5a, 0x5c, 0xf0, 0xec, 0xac, 0xe7, 0x82, 0xcb, 0xb0, 0xb8,
+    0x70, 0x2e, 0xcd, 0x1d, 0x4f, 0x59, 0x05, 0x59, 0xa2, 0x13, 0x61, 0xe9, 0x94, 0x1a, 0xf5, 0xb8,
+    0xfa, 0x65, 0xb3, 0xb3, 0x12, 0xf3, 0xe2, 0x99, 0xce, 0xc4, 0xbf, 0xc8, 0x53, 0x0d, 0x7f, 0xf7,
+    0x96, 0x6d, 0xf5, 0xed, 0x6f, 0x73, 0xe9, 0xb3, 0xea, 0x74, 0x4c, 0x20, 0x7e, 0xfb, 0x9b, 0xc0,
+    0x61, 0x97, 0x47, 0xd1, 0x0c, 0xe6, 0x9d, 0x75, 0x2a, 0xc3, 0x30, 0xff, 0x88, 0xbe, 0xb0, 0x9c,
+    0x13, 0x02, 0x2a, 0xbc, 0x94, 0x6e, 0x90, 0x2d, 0x97, 0x17, 0xb0, 0xcc, 0x26, 0x67, 0xd9, 0xed,
+    0xa8, 0x3a, 0x27, 0x77, 0x05, 0xf1, 0xa9, 0x74, 0xa8, 0x14, 0x9a, 0x9a, 0x99, 0x04, 0xd7, 0xc2,
+    0xb9, 0xc3, 0xa0, 0xa2, 0xaa, 0xe4, 0x41, 0x22, 0x57, 0x1d, 0x8d, 0xc8, 0xd8, 0x59, 0xf2, 0x06,
+    0x9e, 0xd2, 0x03, 0x4c, 0xef, 0xa8, 0x84, 0x4d, 0x22, 0x89, 0xa4, 0xcc, 0xb2, 0x4f, 0xf5, 0x22,
+    0x73, 0xbe, 0x29, 0x60, 0x45, 0xca, 0x00, 0xc2, 0x3d, 0xe6, 0x22, 0x68, 0xbf, 0x2f, 0xe1, 0x34,
+    0x58, 0x8d, 0x3a, 0x17, 0x27, 0x24, 0xeb, 0xeb, 0x08, 0xaa, 0xd4, 0x5e, 0x27, 0xca, 0x54, 0x75,
+    0x7c, 0x04, 0xb7, 0x4e, 0xb8, 0x61, 0xd3, 0xd4, 0xa8, 0x90, 0x77, 0x31, 0x11, 0x2c, 0xab, 0x59,
+    0xf7, 0x6a, 0x25, 0x1e, 0xc5, 0x20, 0xb6, 0xa2, 0xe2, 0x15, 0x8c, 0x0b, 0xa4, 0xa7, 0xf9, 0x77,
+    0x03, 0xc4, 0xb7, 0x52, 0x6b, 0x63, 0x63, 0x27, 0xd9, 0x71, 0x4a, 0x15, 0x65, 0x98, 0x6f, 0xda,
+    0xb5, 0x7f, 0x96, 0x80, 0xc0, 0x7f, 0xde, 0xf8, 0x14, 0xf1, 0x4c, 0xc7, 0xb3, 0xd3, 0x72, 0x01,
+    0xf3, 0xf8, 0x40, 0xd1, 0xa6, 0x84, 0x54, 0xe7, 0xea, 0xdd, 0x28, 0x9f, 0x4a, 0x43, 0x66, 0x6c,
+    0x1e, 0x87, 0x5d, 0x2b, 0x15, 0x43, 0xd3, 0x6c, 0x6d, 0xad, 0x70, 0x7c, 0x16, 0xb1, 0x01, 0x64,
+    0x9f, 0xc3, 0x85, 0x1f, 0xb1, 0x32, 0xa9, 0xcc, 0xc4, 0xcb, 0xea, 0xbc, 0xb4, 0xff, 0xfc, 0xd2,
+    0x64, 0xf9, 0x3c, 0xd5, 0x21, 0xb2, 0xb8, 0xd0, 0x45, 0x28, 0x16, 0x02, 0xec, 0x81, 0x95, 0x63,
+    0xc6, 0x31, 0xe9, 0x57, 0x0d, 0x35, 0x92, 0x12, 0xe6, 0xcc, 0x5c, 0x7a, 0xdf, 0xfa, 0x92, 0x9c,
+    0x61, 0xd8, 0xf0, 0x62, 0x68, 0x76, 0xc8, 0x5b, 0x17, 0x96, 0x94, 0x31, 0x50, 0x69, 0x8e, 0xd8,
+    0x3c, 0xb4, 0x99, 0x4c, 0x5f, 0x5e, 0xe8, 0xa3, 0x38, 0x32, 0xa0, 0x75, 0x5e, 0x6c, 0x2c, 0xd8,
+    0x08, 0x75, 0x26, 0xce, 0x6d, 0x1a, 0x47, 0x1e, 0xd4, 0xbe, 0x8e, 0x8d, 0x05, 0x0b, 0xdd, 0x10,
+    0x5e, 0xb3, 0x2f, 0x00, 0x86, 0x40, 0xd7, 0x60, 0x82, 0xa8, 0x27, 0x30, 0x16, 0x3f, 0xdb, 0xaf,
+    0x6c, 0xa5, 0x42, 0x4d, 0x69, 0x38, 0xf5, 0x25, 0x99, 0x04, 0x97, 0x8a, 0xea, 0x5b, 0xb4, 0xf0,
+    0xc2, 0x41, 0x87, 0x43, 0x73, 0x04, 0xeb, 0x64, 0x49, 0x06, 0x6e, 0x76, 0xd4, 0x33, 0x80, 0xa4,
+    0x84, 0xa2, 0xb9, 0x23, 0xb6, 0x1a, 0x79, 0xe2, 0x6d, 0x4d, 0xdd, 0x31, 0x55, 0x88, 0x15, 0x86,
+    0x68, 0xfa, 0x08, 0x33, 0xeb, 0xac, 0xec, 0x6f, 0xd6, 0x0b, 0x14, 0x92, 0x1b, 0xd4, 0xfb, 0x2e,
+    0x0c, 0x29, 0x38, 0x53, 0xf4, 0xd6, 0x0e, 0x97, 0x03, 0x77, 0x4d, 0x0f, 0xae, 0x22, 0x53, 0x13,
+    0xef, 0x76, 0x20, 0x27, 0x12, 0xc8, 0x0d, 0xde, 0xe9, 0xc7, 0xcf, 0x9c, 0x62, 0xb1, 0x58, 0xfc,
+    0xf8, 0xd1, 0xb0, 0x3a, 0x48, 0xe8, 0x89, 0x9d, 0x44, 0x07, 0xdd, 0xda, 0x7f, 0x2c, 0x1e, 0x01,
+    0x3f, 0x5d, 0xf9, 0x13, 0x83, 0x7f, 0xb9, 0xf1, 0x29, 0xc9, 0xdc, 0x63, 0xff, 0x8f, 0x46, 0x01,
+    0xe7, 0x8a, 0x42, 0x59, 0x24, 0x6d, 0xa1, 0xcf, 0xef, 0xfc, 0xf1, 0x6b, 0x95, 0xb2, 0x3f, 0xfe,
+    0xdf, 0x55, 0x91, 0xae, 0x74, 0x19, 0xe4, 0xc4, 0x6f, 0x28, 0xdc, 0x83, 0xf2, 0x04, 0xcd, 0x2e,
+    0x23, 0xb2, 0xaa, 0xf9, 0xad, 0x35, 0xfd, 0xb3, 0x45, 0x6c, 0x8e, 0x19, 0x67, 0x3c, 0xb3, 0x1f,
+    0x24, 0xef, 0x28, 0x3f, 0x8f, 0xfa, 0x0c, 0xa9, 0x3f, 0xe9, 0x20, 0x7e, 0xa1, 0x53, 0x39, 0x7b,
+    0x69, 0x7e, 0x69, 0x73, 0x94, 0x17, 0x1e, 0xcf, 0x78, 0xfd, 0x5e, 0xe9, 0x89, 0xc5, 0x97, 0xd6,
+    0x43, 0x72, 0x0c, 0xff, 0x73, 0x82, 0x55, 0xfa, 0x64, 0x30, 0x0b, 0xc7, 0x5a, 0x8b, 0xed, 0x84,
+    0xed, 0x08, 0xe9, 0x10, 0x2a, 0x7c, 0x83, 0x56, 0x8b, 0x94, 0x4d, 0x2b, 0x8d, 0x41, 0x3a, 0xf1,
+    0xb2, 0xcf, 0xa8, 0x95, 0x0f, 0xe4, 0x10, 0x7f, 0xe8, 0xee, 0x89, 0x11, 0xbe, 0x0d, 0x3f, 0x14,
+    0xcb, 0xea, 0xab, 0x93, 0xf6, 0x32, 0x1f, 0x6f, 0xc4, 0x3d, 0x60, 0x96, 0x33, 0x55, 0x88, 0xfd,
+    0x76, 0x4c, 0xa4, 0x6e, 0x2d, 0xb6, 0xcc, 0x90, 0x19, 0xa3, 0xb2, 0xf9, 0x8e, 0x49, 0x5c, 0x17,
+    0xa0, 0x93, 0x6f, 0x9e, 0xc6, 0x5d, 0xaf, 0x44, 0xe1, 0xb5, 0x1a, 0x74, 0x45, 0xe6, 0x28, 0xa6,
+    0x85, 0x4b, 0xa9, 0x68, 0x65, 0xb7, 0x69, 0xbe, 0x7d, 0xce, 0x30, 0x94, 0xf5, 0x40, 0x11, 0xf1,
+    0x95, 0x39, 0xdf, 0x60, 0xfa, 0xc3, 0x35, 0x04, 0x20, 0xe5, 0x73, 0x67, 0x87, 0x9d, 0x17, 0x8f,
+    0x50, 0x0c, 0xca, 0x47, 0x11, 0x4b, 0xf4, 0x84, 0x26, 0xbf, 0x6e, 0xf0, 0xe2, 0xff, 0xb8, 0x51,
+    0x1c, 0xf8, 0x17, 0xbf, 0xa8, 0x32, 0xde, 0xd5, 0x0b, 0xe4, 0xd6, 0x96, 0x56, 0x69, 0x92, 0xaf,
+    0x50, 0x5c, 0xdd, 0x6f, 0xa1, 0x02, 0xcb, 0x30, 0xaa, 0xfd, 0xbc, 0x28, 0x09, 0x53, 0xb1, 0xa4,
+    0x3c, 0xe1, 0x9b, 0x8d, 0x9a, 0xf9, 0x2a, 0xa2, 0xb2, 0x44, 0x94, 0xdf, 0x30, 0x78, 0x54, 0xd0,
+    0x27, 0x92, 0xef, 0x16, 0xbc, 0xb0, 0xc5, 0x24, 0xdd, 0x29, 0x51, 0x36, 0x5e, 0x1c, 0x6b, 0x16,
+    0xef, 0xc3, 0x47, 0xfe, 0xab, 0xbf, 0xbd, 0x65, 0x8e, 0xed, 0xa7, 0xd5, 0xe2, 0x95, 0x2e, 0x3b,
+    0xc4, 0xd7, 0xe7, 0x04, 0xce, 0xfe, 0x37, 0x1a, 0x15, 0x44, 0x2b, 0xb2, 0xe6, 0x85, 0x85, 0xfc,
+    0x5b, 0x43, 0x53, 0x7c, 0x44, 0x92, 0x06, 0x98, 0x37, 0x73, 0xa5, 0x17, 0xce, 0xd5, 0x4e, 0xb9,
+    0x8c, 0x3d, 0xb1, 0x52, 0x7f, 0xe7, 0xf8, 0xd2, 0xce, 0xf9, 0xc2, 0x42, 0x4d, 0x3b, 0xc9, 0xab,
+    0x54, 0x69, 0xda, 0xad, 0x5e, 0xec, 0x55, 0xf4, 0x29, 0x5e, 0x86, 0x9a, 0x3f, 0xb4, 0x93, 0x7c,
+    0x2a, 0xcc, 0x95, 0x51, 0xad, 0xa6, 0xbb, 0x20, 0x08, 0x34, 0xc4, 0x05, 0x5d, 0x1d, 0x6d, 0xe8,
+    0x5a, 0x68, 0x75, 0xab, 0x69, 0xd9, 0x9d, 0xb0, 0x4b, 0xdb, 0x64, 0xaa, 0x71, 0xfc, 0x6a, 0x4d,
+    0x70, 0x8b, 0x9f, 0xb0, 0xfb, 0xe7, 0x73, 0x5a, 0x6d, 0x8e, 0x07, 0xbb, 0xef, 0x4d, 0x51, 0x5f,
+    0xe7, 0xd2, 0x7d, 0x78, 0x4f, 0xa3, 0xa2, 0xc6, 0x7a, 0xc4, 0x0b, 0x7e, 0x03, 0x7c, 0x54, 0xad,
+    0x84, 0x3b, 0xe2, 0x33, 0xd3, 0x0c, 0xcd, 0x41, 0xea, 0x0d, 0x0e, 0x3c, 0x87, 0x12, 0xf1, 0x21,
+    0xb4, 0xd5, 0xf3, 0x62, 0xb7, 0xf4, 0xcc, 0xd0, 0x1a, 0x70, 0xca, 0x15, 0xec, 0x85, 0xc4, 0xe8,
+    0x92, 0x42, 0x62, 0x7b, 0x61, 0x52, 0x51, 0xa0, 0x8b, 0xfb, 0xb8, 0xe7, 0xab, 0x4a, 0x52, 0x21,
+    0x62, 0xec, 0x32, 0xd3, 0x64, 0xdf, 0xf1, 0xc3, 0x7b, 0xef, 0x57, 0x94, 0x50, 0xcb, 0xa6, 0xe1,
+    0x00, 0xa6, 0x46, 0x8b, 0x61, 0x53, 0x53, 0x3c, 0x65, 0xd5, 0xee, 0x0c, 0x36, 0x34, 0x3e, 0xee,
+    0xaf, 0x2a, 0xf7, 0x17, 0x86, 0x85, 0xeb, 0x7e, 0xab, 0x0d, 0x75, 0xc9, 0xe2, 0x75, 0x14, 0xe3,
+    0xfd, 0xc0, 0xcb, 0xfb, 0x8f, 0x5f, 0xf5, 0x6b, 0xd5, 0xa6, 0x3e, 0xf2, 0xd4, 0x2d, 0x3e, 0x63,
+    0x98, 0xdf, 0x10, 0x0c, 0x49, 0x7a, 0x18, 0x5f, 0x4c, 0xbe, 0xfa, 0xe5, 0xb2, 0x8e, 0x6d, 0x16,
+    0x70, 0x99, 0x20, 0x42, 0xdb, 0x25, 0xd6, 0x5e, 0xfa, 0xdd, 0xdd, 0x5e, 0x66, 0x8f, 0xd2, 0x3d,
+    0x20, 0x73, 0x3f, 0x44, 0x01, 0x4a, 0x39, 0x97, 0xf8, 0xaa, 0xa8, 0xc1, 0x27, 0xde, 0x2d, 0x6d,
+    0xc8, 0x53, 0x09, 0x1b, 0xaa, 0x33, 0x98, 0xf7, 0xce, 0x9a, 0xa6, 0xa0, 0xca, 0xc1, 0x50, 0xa2,
+    0x53, 0x83, 0xb6, 0xa9, 0xea, 0xdf, 0x17, 0xf4, 0x0b, 0xc9, 0x1d, 0x0c, 0xcd, 0xd5, 0x48, 0x89,
+    0x48, 0x6c, 0x79, 0x4f, 0x37, 0xc0, 0x47, 0x79, 0xce, 0xe2, 0x7a, 0x36, 0x4e, 0xd5, 0xcc, 0x5f,
+    0x10, 0x60, 0xd2, 0xf2, 0x40, 0x45, 0xa7, 0xe0, 0x51, 0x58, 0xaf, 0x8c, 0x77, 0xf0, 0x29, 0xc7,
+    0xe0, 0x48, 0x39, 0xad, 0x4f, 0x65, 0x23, 0xf2, 0xc1, 0x4a, 0x64, 0xac, 0xc0, 0xe9, 0x3d, 0x8b,
+    0x60, 0x22, 0x1c, 0x50, 0x2c, 0x7f, 0xc7, 0x6a, 0x8e, 0xb2, 0x2c, 0xf4, 0x62, 0xe2, 0xb0, 0xfe,
+    0xae, 0x5b, 0x8e, 0xe2, 0x4e, 0xe3, 0x15, 0x55, 0x5e, 0x54, 0x6a, 0xd5, 0x8d, 0x72, 0xfd, 0x13,
+    0x20, 0x14, 0x3b, 0x9f, 0xe8, 0xf7, 0x59, 0x91, 0x02, 0x42, 0x25, 0xd9, 0x09, 0xb5, 0x63, 0x7e,
+    0x91, 0xb4, 0x04, 0xbc, 0x52, 0x36, 0x71, 0xf1, 0xc7, 0x56, 0x28, 0x89, 0xb4, 0x0c, 0xb4, 0x9b,
+    0xf3, 0xbc, 0xa8, 0xc1, 0x53, 0xef, 0xb1, 0xd8, 0x6f, 0x60, 0xef, 0x28, 0x62, 0x1c, 0x6b, 0xe6,
+    0x3b, 0xfd, 0x56, 0xa3, 0xa9, 0x85, 0x84, 0xb9, 0x6b, 0x16, 0xbc, 0x75, 0xef, 0x84, 0x84, 0xf2,
+    0x35, 0x0a, 0xd1, 0x4f, 0x30, 0x25, 0x00, 0xd8, 0xdf, 0x33, 0x9f, 0x48, 0xbd, 0xcd, 0x4d, 0x18,
+    0xc7, 0x19, 0xdc, 0xcf, 0xad, 0x2d, 0x90, 0xb9, 0x58, 0xb8, 0xf5, 0xd6, 0xf1, 0xbb, 0xef, 0x50,
+    0x61, 0x54, 0xa5, 0x4c, 0xe3, 0x16, 0xc6, 0xf6, 0x37, 0xba, 0xac, 0x94, 0x50, 0x5f, 0xcc, 0xa6,
+    0xbf, 0xb6, 0x10, 0xd2, 0x73, 0xa9, 0x5e, 0x84, 0x91, 0x1c, 0xc1, 0x26, 0x76, 0xbf, 0x12, 0x3b,
+    0xd4, 0x7b, 0x04, 0x30, 0x39, 0xd5, 0x35, 0xc4, 0xa9, 0x14, 0x35, 0x94, 0x90, 0xb4, 0x57, 0x08,
+    0xba, 0x87, 0x98, 0x82, 0x45, 0xb0, 0x72, 0x6f, 0x12, 0xf4, 0x5c, 0xb3, 0x69, 0xa9, 0xa8, 0xc0,
+    0xde, 0x52, 0x90, 0x4d, 0x4b, 0x70, 0xac, 0x6f, 0xa2, 0xc5, 0x0a, 0xb3, 0xbb, 0xf5, 0xdb, 0xfb,
+    0x87, 0xb9, 0xb7, 0xe4, 0x8f, 0x43, 0xcd, 0x6c, 0x15, 0x42, 0x5b, 0x80, 0x10, 0x5f, 0xec, 0x81,
+    0x7b, 0x1e, 0x8f, 0x50, 0xee, 0x06, 0x8c, 0x75, 0x1b, 0x8c, 0x4d, 0x97, 0xa1, 0x3c, 0xb2, 0xd2,
+    0x93, 0x5a, 0x1d, 0x42, 0xcd, 0x57, 0x71, 0x65, 0xe5, 0xdd, 0x88, 0x13, 0x0d, 0xd6, 0xb8, 0x94,
+    0xa6, 0xbf, 0xa0, 0x56, 0x3f, 0x7e, 0x67, 0x4f, 0x92, 0xc3, 0x58, 0x73, 0xc4, 0xb1, 0x27, 0x82,
+    0x5b, 0x69, 0x04, 0x17, 0xb7, 0x44, 0x98, 0x54, 0xb5, 0x96, 0x48, 0x5f, 0xaf, 0x34, 0xdd, 0x18,
+    0x19, 0xbd, 0x44, 0xd5, 0x3e, 0xd1, 0xc2, 0xfe, 0x05, 0x63, 0x52, 0x9b, 0x54, 0x8f, 0xbc, 0x28,
+    0x45, 0xbb, 0x13, 0x1e, 0x4c, 0x78, 0x77, 0x4d, 0x72, 0xa2, 0x70, 0x29, 0xa9, 0x8c, 0x18, 0xd0,
+    0xf3, 0x7d, 0x33, 0x87, 0x36, 0xdc, 0x93, 0xb2, 0x56, 0x7c, 0xed, 0x7c, 0x2f, 0x4a, 0x29, 0xc8,
+    0xd2, 0xb9, 0x94, 0x9e, 0xea, 0x1c, 0x11, 0xc0, 0x22, 0xc5, 0x94, 0x2f, 0x0a, 0x5a, 0x57, 0xe6,
+    0x07, 0x67, 0x8f, 0x96, 0xa3, 0x69, 0xa0, 0x9d, 0x0a, 0xd0, 0x46, 0x11, 0x74, 0x65, 0x43, 0xd0,
+    0x7b, 0x54, 0xda, 0x81, 0x28, 0x5c, 0x04, 0xb1, 0x5b, 0x12, 0xe0, 0xf6, 0xc0, 0x41, 0xbf, 0x68,
+    0xfb, 0xe8, 0x86, 0x69, 0xcb, 0x97, 0x5f, 0xa6, 0x19, 0xdd, 0xf6, 0x32, 0xd6, 0x8d, 0x26, 0x2f,
+    0x48, 0xef, 0xac, 0x3e, 0xba, 0x38, 0x0e, 0xfb, 0xa6, 0x27, 0x63, 0xfe, 0x68, 0xa4, 0xe3, 0xb1,
+    0xb6, 0xab, 0xff, 0x76, 0xbb, 0x35, 0x61, 0xa6, 0xa3, 0xcb, 0x9f, 0x76, 0x74, 0xae, 0x28, 0x69,
+    0x3e, 0xb6, 0x45, 0x7a, 0xe0, 0x19, 0xdf, 0xde, 0x96, 0xa2, 0xd9, 0x6f, 0x16, 0x8a, 0xb7, 0x10,
+    0x8d, 0x4f, 0xd5, 0x2d, 0x6d, 0x21, 0x94, 0x91, 0x3a, 0xd8, 0x8c, 0x33, 0x2a, 0xdb, 0x79, 0xff,
+    0xb4, 0xe4, 0x06, 0xac, 0x72, 0xfd, 0x09, 0x0b, 0x89, 0x2d, 0xf6, 0x88, 0x20, 0x5d, 0x29, 0xa2,
+    0x8b, 0x4c, 0x73, 0xa5, 0x10, 0x87, 0xd1, 0x84, 0xf4, 0x74, 0xcc, 0x18, 0x38, 0xcb, 0xc3, 0x65,
+    0x90, 0x8e, 0x73, 0xb6, 0x5a, 0xcd, 0xbd, 0xf5, 0xed, 0xdc, 0x8b, 0x57, 0x0e, 0x9c, 0xc9, 0xc4,
+    0x1a, 0x67, 0xfd, 0x41, 0xfa, 0x45, 0x2a, 0x15, 0x16, 0x55, 0x6b, 0x54, 0x6e, 0x15, 0x6b, 0xb9,
+    0x42, 0x64, 0xc9, 0x14, 0x84, 0x1c, 0x66, 0x58, 0xea, 0xe5, 0xc9, 0xcc, 0x5a, 0x4d, 0x66, 0x64,
+    0x48, 0xd6, 0x95, 0xd3, 0xbd, 0x51, 0x25, 0xec, 0x4c, 0x61, 0xd8, 0xba, 0x45, 0x97, 0x9a, 0xc1,
+    0x74, 0x36, 0xe4, 0x84, 0x26, 0x1b, 0xb9, 0x82, 0xa0, 0xcf, 0x6f, 0xca, 0x8c, 0xb4, 0x4b, 0x8c,
+    0xd2, 0x93, 0x83, 0x67, 0x74, 0x35, 0xde, 0x45, 0x74, 0xc0, 0xd8, 0x50, 0x7a, 0xa2, 0xdd, 0x29,
+    0x4f, 0x0a, 0x27, 0xb6, 0xa1, 0xa7, 0x1e, 0x57, 0xd5, 0x41, 0xf8, 0x00, 0x6a, 0x74, 0x98, 0x38,
+    0x6f, 0x86, 0xfa, 0xc9, 0x09, 0xde, 0x8c, 0xa1, 0xbb, 0x31, 0x7c, 0x5f, 0x2e, 0x22, 0x1e, 0xbe,
+    0x87, 0x1b, 0x16, 0xbf, 0xc7, 0xfc, 0xdd, 0xc4, 0xe4, 0x6a, 0xcc, 0x2d, 0x46, 0x56, 0xab, 0x48,
+    0x74, 0x09, 0xa6, 0xd1, 0xba, 0x27, 0x1f, 0xaf, 0xe8, 0x99, 0xe6, 0xd0, 0x1c, 0xf3, 0x48, 0x5b,
+    0xc1, 0x59, 0x6f, 0x97, 0xb3, 0x4b, 0x8a, 0x62, 0x5f, 0xdf, 0xfc, 0x17, 0xee, 0xb2, 0x79, 0x37,
+    0xf3, 0x43, 0x00, 0x00,
+};
+// app.js: 10185 bytes, 2559 gzipped
+const uint8_t APP_JS_GZ[] PROGMEM = {
+    0x1f, 0x8b, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x03, 0xcd, 0x5a, 0x5f, 0x73, 0xe3, 0xb6,
+    0x11, 0x7f, 0xf7, 0xa7, 0x80, 0xef, 0x21, 0x24, 0x27, 0x32, 0xed, 0xb6, 0xd3, 0x17, 0x7b, 0x94,
+    0xce, 0x39, 0x67, 0x4f, 0xdd, 0x71, 0xe2, 0xcc, 0xc9, 0xed, 0x8b, 0xeb, 0xc9, 0xc0, 0x24, 0x24,
+    0x21, 0xa6, 0x48, 0x15, 0x00, 0xa5, 0xd3, 0xf8, 0xf4, 0xdd, 0xbb, 0xbb, 0x20, 0x45, 0x90, 0x04,
+    0x25, 0xdd, 0xa5, 0xd7, 0x56, 0x0f, 0xb6, 0x44, 0x02, 0xbb, 0x3f, 0xec, 0xff, 0x5d, 0x92, 0x31,
+    0xc6, 0xce, 0xcf, 0xd9, 0xbd, 0x5c, 0x09, 0xa6, 0x78, 0x2a, 0x0b, 0xa6, 0x0d, 0x37, 0x82, 0x2d,
+    0x4b, 0x3d, 0x17, 0x29, 0x7b, 0xd9, 0x30, 0x33, 0x17, 0x2c, 0x15, 0x2b, 0x99, 0x08, 0xc6, 0x35,
+    0x9b, 0x08, 0xb5, 0x12, 0xea, 0x6c, 0x22, 0x72, 0xc3, 0x6e, 0x56, 0xf0, 0x57, 0xb3, 0x22, 0x67,
+    0xe7, 0x82, 0xbe, 0xc6, 0xec, 0x86, 0x27, 0xf3, 0x13, 0x66, 0x69, 0xd2, 0x35, 0xb8, 0x9b, 0x6d,
+    0x58, 0xc2, 0x95, 0x92, 0x42, 0x13, 0xad, 0xa9, 0x14, 0x59, 0x8a, 0x5f, 0xb9, 0x61, 0xc9, 0x9c,
+    0xe7, 0x33, 0x91, 0x8e, 0x98, 0x2e, 0x58, 0x26, 0xb5, 0x11, 0xb9, 0x50, 0x9a, 0xcd, 0x84, 0xa1,
+    0x95, 0x0b, 0xa1, 0xe0, 0xa6, 0x05, 0x14, 0x13, 0xd5, 0xa4, 0xc8, 0xb5, 0xb1, 0x38, 0x27, 0x04,
+    0x73, 0xcc, 0xde, 0xb6, 0x57, 0xce, 0x2d, 0x23, 0x32, 0xb1, 0x10, 0x46, 0x6d, 0xee, 0x77, 0xd4,
+    0xc6, 0xec, 0xe9, 0xf9, 0xea, 0x84, 0xd6, 0x4c, 0xcb, 0x3c, 0x31, 0x12, 0xf0, 0x16, 0xf9, 0x63,
+    0xbd, 0x30, 0xac, 0xf9, 0x46, 0xec, 0x8d, 0x16, 0xe1, 0xa7, 0x4f, 0x26, 0x46, 0x81, 0x34, 0x6b,
+    0xaf, 0x76, 0x4b, 0xe5, 0x94, 0x85, 0x0f, 0x2f, 0xbf, 0x89, 0xc4, 0xc4, 0xaf, 0x62, 0xa3, 0xc3,
+    0x06, 0x5c, 0x14, 0x67, 0x22, 0x9f, 0x99, 0x39, 0xfb, 0x81, 0x5d, 0x44, 0xbb, 0xe3, 0xb9, 0x0b,
+    0x2c, 0x95, 0x6d, 0x07, 0x5c, 0xb9, 0x4c, 0xe1, 0x66, 0x03, 0xd0, 0x0a, 0x49, 0xbb, 0xf8, 0x2a,
+    0x86, 0x5c, 0x6b, 0x39, 0xcb, 0x1d, 0x8a, 0x23, 0x56, 0x2f, 0xbe, 0xda, 0x77, 0x96, 0x69, 0xa1,
+    0x50, 0x51, 0xbb, 0xe3, 0xb0, 0xf1, 0x0f, 0x5e, 0x7c, 0x03, 0x00, 0x41, 0x21, 0xca, 0x34, 0xf8,
+    0x5c, 0x60, 0x28, 0x8d, 0xd3, 0xb5, 0xcc, 0xd3, 0x62, 0x1d, 0x93, 0x79, 0x4c, 0x8a, 0x52, 0x25,
+    0xc2, 0x5d, 0x52, 0x59, 0xc7, 0xb5, 0x2a, 0xd6, 0x1a, 0xf5, 0xb3, 0x96, 0x66, 0x5e, 0x94, 0x86,
+    0x4d, 0x26, 0x37, 0x6c, 0x59, 0x64, 0x19, 0xa9, 0x5e, 0xf3, 0x85, 0xb0, 0x8a, 0xbf, 0xa2, 0xdf,
+    0x2f, 0xdc, 0x18, 0xa1, 0x36, 0xf5, 0xf1, 0x98, 0xce, 0x8a, 0x75, 0xb6, 0x69, 0xd1, 0x44, 0xd6,
+    0x69, 0x91, 0x94, 0x0b, 0xe0, 0x1a, 0x83, 0x09, 0xdd, 0x20, 0xbe, 0xdc, 0x5c, 0x6f, 0xee, 0xd2,
+    0x30, 0x48, 0x4a, 0xa5, 0xe0, 0xc7, 0x63, 0x99, 0xcb, 0x7c, 0x16, 0x44, 0x5d, 0x3c, 0xf8, 0xd1,
+    0xc2, 0xdc, 0xe5, 0xc0, 0x64, 0xc5, 0xb3, 0xb0, 0x52, 0x01, 0xad, 0xfe, 0x07, 0xcf, 0x4a, 0x10,
+    0xec, 0x9f, 0x2f, 0x2e, 0x1c, 0xa1, 0x5a, 0xb1, 0x1c, 0xcd, 0xbe, 0x82, 0x7f, 0x2b, 0xb3, 0xcc,
+    0xcf, 0xdc, 0x32, 0xbc, 0xb6, 0xcb, 0x88, 0x63, 0xd8, 0xe1, 0xe6, 0x87, 0xe8, 0xee, 0x20, 0x8c,
+    0xfb, 0x41, 0x2a, 0x61, 0x4a, 0x95, 0x37, 0x2b, 0x9a, 0xbb, 0xd6, 0x7d, 0x34, 0x69, 0x0b, 0x5c,
+    0x26, 0x17, 0x6b, 0xe6, 0xe8, 0x2f, 0x0c, 0x2a, 0x0f, 0x0f, 0x1c, 0xf2, 0x76, 0x71, 0x5c, 0xe4,
+    0x0b, 0xa1, 0x35, 0x9f, 0xe1, 0x36, 0xeb, 0xf2, 0x60, 0x4d, 0x5d, 0x1b, 0xfe, 0xdb, 0xe4, 0xe1,
+    0xe7, 0x78, 0xc9, 0x95, 0x16, 0x21, 0xad, 0x89, 0xe1, 0x36, 0xef, 0xd8, 0x97, 0xeb, 0x94, 0x36,
+    0x08, 0x01, 0xa1, 0xb7, 0x0e, 0x42, 0x61, 0xc5, 0x0a, 0xbc, 0x8e, 0xd5, 0x75, 0xdb, 0x55, 0xeb,
+    0xfd, 0xdf, 0x7d, 0x57, 0xc5, 0x15, 0x43, 0xcb, 0xd8, 0xe9, 0x78, 0xcc, 0xca, 0x3c, 0x15, 0x53,
+    0x99, 0x8b, 0x34, 0xaa, 0xd9, 0xc4, 0x46, 0x7c, 0x32, 0x3f, 0x16, 0x20, 0x73, 0x62, 0xe9, 0xee,
+    0xa8, 0xa0, 0x47, 0x57, 0x7e, 0xef, 0x6d, 0x4c, 0xa7, 0xe5, 0x1f, 0x53, 0x61, 0xc0, 0xef, 0x82,
+    0x73, 0x53, 0x81, 0x6b, 0x69, 0x27, 0x06, 0x4b, 0x07, 0x6f, 0x16, 0x7a, 0x09, 0x47, 0xa5, 0xd3,
+    0xd7, 0xdf, 0xe3, 0xdf, 0x74, 0x91, 0x87, 0x91, 0x6f, 0x39, 0x0a, 0xd2, 0x27, 0xf1, 0x37, 0x66,
+    0x79, 0x5c, 0x32, 0x5c, 0x11, 0xaf, 0x10, 0x0a, 0xc0, 0xed, 0x90, 0x48, 0x38, 0xe2, 0x11, 0x4a,
+    0x15, 0x14, 0x04, 0x50, 0xc6, 0x45, 0x26, 0x62, 0xba, 0x10, 0x06, 0x37, 0x74, 0x9d, 0x30, 0xa3,
+    0x8c, 0x2a, 0x51, 0x11, 0xa9, 0xcb, 0x60, 0xc4, 0x68, 0x55, 0xb4, 0x37, 0x8a, 0xb5, 0x2d, 0xda,
+    0x23, 0x08, 0xbe, 0x94, 0xe7, 0x95, 0x77, 0x7c, 0x4b, 0x69, 0x58, 0x73, 0xfb, 0x1d, 0x67, 0xaf,
+    0x03, 0x10, 0x9a, 0x40, 0xa9, 0x0f, 0x9e, 0x1e, 0x3c, 0xf5, 0x56, 0x89, 0x7f, 0x95, 0x22, 0x4f,
+    0xac, 0x31, 0xc3, 0xc5, 0x3b, 0x30, 0xaf, 0x4f, 0xff, 0x1d, 0x63, 0xe8, 0x07, 0x18, 0xeb, 0x3d,
+    0xa9, 0xd4, 0xcb, 0x8c, 0x6f, 0xf6, 0x79, 0xcf, 0x14, 0x60, 0xff, 0x1a, 0xb0, 0xef, 0x59, 0x0b,
+    0x75, 0x3f, 0x16, 0x51, 0xbc, 0xb3, 0xe4, 0x7c, 0x01, 0x0d, 0x3f, 0xd5, 0xed, 0x8e, 0x13, 0x35,
+    0xe6, 0x78, 0xb5, 0x77, 0x97, 0x36, 0x1b, 0xd0, 0xc6, 0x0b, 0x4f, 0x5e, 0x67, 0xaa, 0x00, 0xd7,
+    0xfc, 0xb1, 0xc8, 0x50, 0x51, 0x2c, 0x58, 0x71, 0x15, 0x9e, 0x9d, 0xe9, 0x32, 0x49, 0x20, 0xee,
+    0x9c, 0x25, 0x78, 0x39, 0x0a, 0x8e, 0xa1, 0x95, 0xd4, 0x14, 0xd6, 0x73, 0x69, 0xc4, 0xc0, 0x16,
+    0xd0, 0xdc, 0xa3, 0x5c, 0x08, 0xc8, 0x48, 0x21, 0x18, 0xac, 0x57, 0x96, 0x47, 0x23, 0x1d, 0x60,
+    0xb1, 0x07, 0xd9, 0xc0, 0x8e, 0xad, 0x2f, 0xff, 0xd4, 0x1f, 0xef, 0x45, 0xc8, 0xb0, 0x13, 0x0e,
+    0x35, 0x1d, 0x55, 0x5c, 0xb5, 0x25, 0x32, 0xb9, 0x58, 0x88, 0x54, 0x82, 0x67, 0x74, 0x72, 0xe7,
+    0xee, 0xf0, 0xb0, 0xc5, 0x6f, 0xb7, 0x23, 0x47, 0x6f, 0x1e, 0x1c, 0xed, 0x34, 0xb3, 0xfd, 0x0a,
+    0x4f, 0x03, 0xb9, 0x1b, 0x74, 0xb4, 0x1d, 0xd8, 0xc3, 0x3e, 0xb6, 0x07, 0xec, 0x8e, 0x4a, 0xd4,
+    0xcb, 0x20, 0xd6, 0x47, 0x3a, 0x6a, 0xad, 0x76, 0x5f, 0x32, 0xca, 0x51, 0x90, 0x64, 0xdb, 0x4e,
+    0x3b, 0x6a, 0x2d, 0x6e, 0x20, 0x36, 0xcb, 0x1b, 0x86, 0x4d, 0x72, 0xad, 0x52, 0x83, 0xeb, 0xea,
+    0x88, 0xf9, 0x6c, 0xb7, 0x16, 0x4e, 0xd8, 0x86, 0x01, 0xc1, 0x6a, 0x5e, 0xa4, 0x97, 0x2c, 0xf8,
+    0xe5, 0x61, 0xf2, 0x18, 0xb4, 0xb9, 0xce, 0x05, 0x4f, 0xa1, 0x5e, 0xba, 0xf4, 0x18, 0x64, 0x50,
+    0x79, 0xd7, 0xd9, 0xe3, 0x66, 0x29, 0x02, 0xd8, 0xce, 0x97, 0xcb, 0x4c, 0x26, 0x74, 0x80, 0x73,
+    0x8c, 0x16, 0x1d, 0x52, 0xdb, 0xf6, 0xcf, 0x97, 0x22, 0x85, 0xa3, 0x50, 0x8a, 0xd6, 0x46, 0x81,
+    0x12, 0xe4, 0xb4, 0x8a, 0x98, 0x27, 0x1e, 0x8d, 0x7e, 0x41, 0x60, 0xda, 0x17, 0x94, 0x28, 0x7e,
+    0xa0, 0x49, 0x55, 0x8e, 0xec, 0x2d, 0xc9, 0xe6, 0xc5, 0xfa, 0xb1, 0xe0, 0xda, 0x84, 0xc1, 0x4e,
+    0xd1, 0xa4, 0x76, 0x14, 0x11, 0x84, 0xa8, 0x46, 0xe8, 0x9d, 0xa2, 0x07, 0xf2, 0x37, 0x40, 0xdb,
+    0x4f, 0x90, 0xcb, 0x0c, 0x9a, 0x0b, 0x53, 0x10, 0x41, 0xe6, 0xea, 0xc4, 0xa8, 0x9e, 0x8d, 0x6f,
+    0xbd, 0x92, 0xe8, 0xd8, 0x75, 0x9b, 0x9f, 0xcf, 0xca, 0x1b, 0x9b, 0x6e, 0x93, 0x77, 0x70, 0x55,
+    0xde, 0xc0, 0x57, 0x2d, 0x67, 0xe8, 0xa3, 0xda, 0x0e, 0x79, 0xc5, 0x8e, 0x54, 0x55, 0x96, 0x8d,
+    0x98, 0xd4, 0x96, 0xe8, 0x98, 0x4d, 0x39, 0xc8, 0xa5, 0xef, 0x12, 0x06, 0xd7, 0xbb, 0x49, 0x21,
+    0x51, 0x02, 0x82, 0x44, 0x95, 0x17, 0xc2, 0x20, 0x95, 0x2b, 0xb7, 0x8e, 0xa2, 0xe5, 0x71, 0x92,
+    0x41, 0xfb, 0xf1, 0x33, 0xd6, 0xe9, 0x10, 0xb7, 0xe8, 0x12, 0xaa, 0x24, 0xac, 0x99, 0xfd, 0x05,
+    0x34, 0x44, 0x47, 0x0d, 0x18, 0x28, 0xab, 0xbf, 0xbd, 0x9d, 0x14, 0x2a, 0xac, 0xcd, 0xa2, 0x1d,
+    0x14, 0x34, 0xce, 0x18, 0xec, 0x59, 0x40, 0x5c, 0x9d, 0xcb, 0x2c, 0x0d, 0x69, 0xbb, 0x43, 0xee,
+    0xc4, 0x09, 0x79, 0x8f, 0x4a, 0xce, 0x66, 0xd0, 0xcf, 0x28, 0x31, 0x85, 0x06, 0x01, 0x95, 0x2b,
+    0x72, 0x5d, 0x2a, 0xe8, 0x5c, 0x73, 0xb9, 0x20, 0x77, 0x60, 0xeb, 0x42, 0xbd, 0xea, 0x0e, 0x96,
+    0x62, 0x3a, 0x85, 0xf0, 0xf3, 0x57, 0x21, 0x67, 0x73, 0xe3, 0x3d, 0x26, 0xb6, 0x4e, 0x31, 0x4f,
+    0x21, 0x3d, 0xa2, 0x78, 0x03, 0x1f, 0xf7, 0x03, 0x79, 0xa3, 0x4b, 0x4c, 0x89, 0x45, 0xb1, 0x12,
+    0x7d, 0x7a, 0x5e, 0x52, 0x76, 0x73, 0xb5, 0x25, 0x1a, 0xb1, 0x3f, 0xb5, 0x72, 0xc1, 0x96, 0x2e,
+    0x5c, 0x0c, 0xd8, 0x03, 0x34, 0x4c, 0x69, 0x26, 0x6e, 0x0b, 0xb5, 0x98, 0x94, 0x2f, 0x0b, 0x69,
+    0x6c, 0xfd, 0xed, 0xda, 0x80, 0x2d, 0xc8, 0x97, 0x8a, 0xfe, 0x7f, 0x10, 0x53, 0x5e, 0x66, 0xc6,
+    0xed, 0x3e, 0xac, 0x8d, 0x40, 0xcf, 0xb8, 0xa8, 0x2b, 0xfc, 0x18, 0x1a, 0x40, 0xa8, 0x1b, 0xae,
+    0x5c, 0xd1, 0xdf, 0x17, 0xc5, 0x2b, 0x2e, 0x62, 0x9a, 0xd8, 0xb0, 0x97, 0xd2, 0x18, 0x60, 0x2f,
+    0x73, 0x2d, 0x53, 0x61, 0x77, 0x4f, 0xa5, 0xd2, 0x66, 0x84, 0x29, 0x09, 0x3a, 0xf0, 0xd2, 0xd0,
+    0x8d, 0x10, 0xb7, 0x80, 0xb2, 0x38, 0x05, 0x7f, 0xbb, 0xa9, 0xf1, 0xb0, 0x4c, 0x98, 0x8a, 0xde,
+    0xb5, 0x25, 0x37, 0x26, 0x4a, 0x31, 0x38, 0x85, 0xda, 0x4c, 0xa0, 0xba, 0x4b, 0x0c, 0xfa, 0x96,
+    0xdd, 0xf6, 0x64, 0x20, 0xfa, 0x8d, 0xdf, 0xd9, 0xf5, 0xef, 0x9e, 0xbb, 0x95, 0xff, 0xa9, 0x4b,
+    0xa8, 0x1b, 0x6d, 0x3a, 0x4c, 0x76, 0xd6, 0xe7, 0x67, 0x84, 0x18, 0xc6, 0xef, 0x28, 0x02, 0x21,
+    0x1a, 0x99, 0xc2, 0xb7, 0xa0, 0xcd, 0x71, 0xeb, 0xb5, 0xcf, 0x0f, 0x52, 0xf3, 0x97, 0x4c, 0xd4,
+    0xc2, 0x01, 0xd5, 0x90, 0xbf, 0xd6, 0xee, 0x4e, 0xfd, 0x45, 0x0b, 0xf4, 0xb1, 0x98, 0xe3, 0xd4,
+    0x52, 0x4e, 0x01, 0x3c, 0x06, 0x8a, 0xab, 0xe1, 0x95, 0x5d, 0x83, 0x26, 0xd6, 0x87, 0xa1, 0x43,
+    0x51, 0x83, 0x52, 0xb0, 0x9a, 0xa4, 0x90, 0x2e, 0x73, 0xf0, 0x2f, 0x0e, 0xa0, 0x55, 0x99, 0x40,
+    0x5b, 0x09, 0xbc, 0x0b, 0x1a, 0x4b, 0x74, 0x7b, 0x4a, 0x9b, 0x48, 0xeb, 0x41, 0x8c, 0xf7, 0xe6,
+    0x87, 0x2a, 0x27, 0x6f, 0xfd, 0x6e, 0x7d, 0x8b, 0x86, 0x03, 0xb9, 0x56, 0x43, 0xf6, 0x4b, 0x2a,
+    0x1c, 0x3c, 0xcb, 0x00, 0xc1, 0x12, 0xcc, 0xa8, 0x49, 0xb2, 0x3d, 0xd3, 0x78, 0x9f, 0x65, 0x61,
+    0x40, 0xab, 0x82, 0x68, 0x37, 0xf5, 0xa0, 0xdf, 0xfe, 0x78, 0x6d, 0xd8, 0x02, 0x43, 0x3a, 0x40,
+    0xa1, 0x45, 0x71, 0x0e, 0xe1, 0x2d, 0xa6, 0x4b, 0xe1, 0x39, 0xa5, 0xf8, 0xcf, 0x0b, 0x3d, 0xfb,
+    0x2c, 0x72, 0x14, 0x75, 0xf4, 0x6b, 0xf8, 0xcf, 0xf4, 0xfb, 0xe8, 0xbc, 0xe3, 0xbc, 0xa8, 0x35,
+    0xda, 0x11, 0x0d, 0x56, 0xe1, 0x4f, 0xe0, 0x03, 0x60, 0xaa, 0x10, 0x98, 0xb1, 0xb8, 0x78, 0xc6,
+    0xf0, 0x87, 0x1b, 0xfc, 0x35, 0xf6, 0xa9, 0x23, 0xa2, 0x27, 0xbb, 0x61, 0xa8, 0xde, 0xee, 0xaf,
+    0x44, 0x99, 0x5a, 0x2e, 0x4e, 0xa9, 0x22, 0x6d, 0x1f, 0xb2, 0x3d, 0x54, 0xc5, 0x79, 0x6b, 0x4b,
+    0x84, 0x84, 0xe0, 0xd9, 0x18, 0x1a, 0x66, 0x6a, 0x16, 0x82, 0xe3, 0xe1, 0xc4, 0x4d, 0x25, 0x3a,
+    0x76, 0xf1, 0xa0, 0xa8, 0x07, 0x2b, 0x4b, 0x9b, 0xcb, 0xdb, 0x7c, 0x41, 0x0b, 0x5f, 0xc2, 0xb6,
+    0x19, 0x50, 0x38, 0xbc, 0x8e, 0x64, 0x65, 0x95, 0xfd, 0x25, 0xdc, 0xec, 0x8e, 0x74, 0xc7, 0x2d,
+    0x99, 0x8b, 0xe4, 0x55, 0xa4, 0x07, 0x8b, 0xe6, 0x5e, 0x6a, 0xef, 0xbb, 0x60, 0xbe, 0x12, 0x0a,
+    0xd3, 0x35, 0xe3, 0x4a, 0x41, 0x1b, 0x87, 0xf1, 0xa3, 0x4a, 0x70, 0x35, 0x53, 0xa9, 0x31, 0x7d,
+    0xb8, 0x2e, 0xc1, 0x42, 0x6b, 0x75, 0x84, 0x0e, 0xfe, 0xba, 0x90, 0x23, 0xaf, 0x0f, 0x54, 0x0b,
+    0xaa, 0x81, 0x47, 0xfb, 0x74, 0x7d, 0x63, 0x3f, 0x0d, 0x2b, 0x19, 0xa5, 0x81, 0x43, 0xdd, 0x3f,
+    0x62, 0xb3, 0xf7, 0x1c, 0x09, 0x51, 0x41, 0xb2, 0x6f, 0x62, 0x55, 0x47, 0x0f, 0x3b, 0x7f, 0xad,
+    0x89, 0xbb, 0xc1, 0xca, 0x95, 0xd0, 0x04, 0xaa, 0x04, 0x9c, 0x52, 0x63, 0x2d, 0xeb, 0xad, 0xbd,
+    0xff, 0x9f, 0x2b, 0xee, 0xb7, 0x26, 0x54, 0x6e, 0xbf, 0x65, 0xe5, 0xdd, 0x54, 0x88, 0x54, 0x7f,
+    0xef, 0xca, 0xc4, 0xd3, 0x56, 0x39, 0x7e, 0xf5, 0xbf, 0xa9, 0x78, 0x81, 0xc6, 0x54, 0xce, 0x4a,
+    0x45, 0x82, 0xf0, 0x55, 0xbd, 0x0d, 0x96, 0xa9, 0xcc, 0x21, 0x09, 0x6c, 0xbc, 0xe5, 0x16, 0xd8,
+    0xc2, 0x47, 0x71, 0x66, 0xed, 0xcc, 0xcd, 0xb6, 0xb6, 0x86, 0xf2, 0xe7, 0xdb, 0x63, 0x72, 0xee,
+    0xbe, 0xbc, 0xeb, 0xb1, 0xe5, 0x3d, 0xc9, 0x77, 0x57, 0x00, 0xf6, 0xf2, 0xaf, 0x3f, 0x18, 0x74,
+    0xeb, 0x3a, 0xf1, 0x69, 0x59, 0x28, 0xf3, 0x93, 0x55, 0x9e, 0x1e, 0x9c, 0xad, 0x55, 0xda, 0xd5,
+    0xdf, 0x76, 0xba, 0x84, 0xc1, 0x89, 0x5a, 0x06, 0xa8, 0x07, 0x5e, 0xb2, 0xe2, 0x05, 0x1a, 0x97,
+    0x62, 0x41, 0xb3, 0x07, 0xb4, 0x71, 0x2a, 0x17, 0x06, 0x72, 0x21, 0xad, 0xb6, 0xf3, 0xe6, 0x6b,
+    0xf8, 0x1a, 0x3e, 0x79, 0xda, 0xd0, 0x11, 0xcb, 0xcb, 0x2c, 0x1b, 0xb1, 0x3f, 0x46, 0xcf, 0xe0,
+    0xbe, 0x94, 0x3b, 0x7d, 0x1e, 0xd7, 0x8a, 0x9b, 0x6d, 0x2e, 0xa5, 0xca, 0x80, 0xc9, 0xdf, 0x3f,
+    0xde, 0x57, 0x9d, 0x8d, 0x7d, 0x7e, 0x02, 0xbf, 0x43, 0xe4, 0xef, 0xd9, 0xb6, 0xf7, 0x84, 0x46,
+    0x2c, 0x40, 0xf6, 0x5c, 0x6d, 0x58, 0x26, 0xf3, 0x57, 0xb2, 0x2b, 0x53, 0x35, 0x1e, 0x69, 0xb1,
+    0xce, 0xa1, 0x98, 0x4d, 0x07, 0x70, 0xf0, 0x3d, 0x4d, 0x16, 0x0f, 0x3c, 0x38, 0x78, 0x3c, 0x87,
+    0x5e, 0x06, 0x76, 0xc1, 0x09, 0x7c, 0x77, 0x6b, 0x7e, 0xd8, 0x83, 0xd1, 0x83, 0x9b, 0xb3, 0x5a,
+    0xe1, 0x67, 0x58, 0x9e, 0xa2, 0x58, 0x21, 0x78, 0x43, 0xd3, 0x10, 0x9b, 0xe2, 0x6e, 0xf2, 0x30,
+    0x21, 0xb9, 0xc2, 0x2f, 0x0d, 0xb2, 0x03, 0x9e, 0x8f, 0x41, 0xf4, 0x74, 0xf1, 0x8c, 0xd5, 0x2b,
+    0xa9, 0xdd, 0x33, 0x7d, 0x1a, 0xee, 0xc3, 0xb8, 0x17, 0x6e, 0x02, 0x3a, 0x79, 0x0d, 0x8f, 0x95,
+    0x68, 0x26, 0x38, 0x4e, 0x8a, 0x0f, 0x70, 0xb5, 0xae, 0x32, 0xcc, 0x15, 0xf5, 0x0a, 0xdd, 0x4b,
+    0xf1, 0xea, 0xe8, 0x15, 0xe4, 0x75, 0x0c, 0x08, 0x27, 0x0c, 0xd5, 0xae, 0x54, 0x79, 0x16, 0x3e,
+    0x78, 0xb4, 0xa1, 0x70, 0x0a, 0xc6, 0xb7, 0xe9, 0x39, 0xe8, 0xfe, 0x11, 0x97, 0xbf, 0xf4, 0xeb,
+    0x0d, 0xbd, 0x2c, 0x2b, 0x0c, 0x45, 0xb5, 0xda, 0x86, 0xe2, 0xa5, 0x37, 0x66, 0xf6, 0xb7, 0x0f,
+    0x4c, 0x2f, 0x06, 0x62, 0x88, 0x5c, 0x0c, 0xc6, 0x90, 0xba, 0x66, 0xa0, 0x52, 0x79, 0x78, 0x5a,
+    0x6c, 0x29, 0xdc, 0x4a, 0xac, 0x90, 0x3a, 0xed, 0x96, 0xdd, 0xfb, 0xf9, 0x33, 0xb3, 0xdf, 0x20,
+    0x5c, 0x67, 0x20, 0x5c, 0xf8, 0xed, 0xfc, 0xac, 0x9f, 0x90, 0x62, 0xa5, 0x75, 0x11, 0x0d, 0xe6,
+    0xa9, 0xe0, 0x17, 0x30, 0x14, 0x08, 0x53, 0x5a, 0xd8, 0xd2, 0x9f, 0xe1, 0x66, 0x2c, 0x83, 0x2c,
+    0x7b, 0xff, 0xa1, 0xfb, 0xcf, 0xba, 0xba, 0x1d, 0x2d, 0x12, 0x19, 0xbb, 0x70, 0xc0, 0x17, 0xba,
+    0x0d, 0x8a, 0xa2, 0x1a, 0xa0, 0x8a, 0x50, 0x78, 0xce, 0x8f, 0x74, 0x21, 0x8c, 0x9c, 0xe1, 0x9e,
+    0x5d, 0x13, 0x17, 0xb5, 0x27, 0xd6, 0xf2, 0x0d, 0x7b, 0xcf, 0x3d, 0x0d, 0xc4, 0x8c, 0xa1, 0xae,
+    0x00, 0x1d, 0xb0, 0xea, 0x83, 0xdc, 0xa7, 0x65, 0x55, 0xaf, 0x0d, 0x06, 0xae, 0xa1, 0x2f, 0x3f,
+    0xc6, 0xa6, 0xbd, 0xe1, 0x7f, 0x34, 0x50, 0xbf, 0xee, 0xab, 0x7f, 0x8e, 0xa8, 0x83, 0xbe, 0xb6,
+    0x1e, 0x1a, 0xa8, 0x8b, 0xf6, 0xd6, 0x47, 0xb5, 0x80, 0xa2, 0x7e, 0x21, 0xdd, 0xbf, 0xf4, 0x85,
+    0x09, 0xee, 0x98, 0x24, 0x77, 0xec, 0xd4, 0x72, 0x7f, 0x9d, 0x15, 0x0d, 0x3f, 0x13, 0xa0, 0xa2,
+    0x85, 0x6c, 0x08, 0x33, 0xe7, 0x12, 0x3b, 0x16, 0x1c, 0x4f, 0xe2, 0x80, 0xc0, 0x3e, 0xcf, 0x4a,
+    0x77, 0x7e, 0x3e, 0xcc, 0xb4, 0x3b, 0x3b, 0xaa, 0x1e, 0xc6, 0x67, 0x85, 0x55, 0x06, 0xd8, 0x11,
+    0x72, 0xc0, 0x29, 0xd2, 0x1f, 0x86, 0x1f, 0x29, 0x0c, 0x0e, 0x50, 0x0f, 0xd5, 0x90, 0x1e, 0x3f,
+    0x1c, 0x6e, 0x2e, 0x7d, 0x6a, 0x3b, 0x18, 0x47, 0x07, 0x63, 0xa9, 0x8d, 0x05, 0xc7, 0xc6, 0x52,
+    0x6f, 0x3c, 0xed, 0x93, 0x08, 0x06, 0x8f, 0xb4, 0xed, 0xcd, 0x9c, 0x09, 0x3a, 0xb3, 0xd8, 0xa3,
+    0x63, 0x33, 0x00, 0x7a, 0x39, 0x32, 0x44, 0x5b, 0x3f, 0x32, 0xf6, 0xdf, 0xe5, 0xd0, 0xbf, 0xca,
+    0xd4, 0x96, 0x56, 0x18, 0xb7, 0x0e, 0x8e, 0xac, 0x7d, 0xb1, 0x4a, 0xd4, 0x23, 0xe1, 0x3a, 0x58,
+    0xed, 0x09, 0xbf, 0x16, 0x2a, 0x6e, 0xa5, 0xa1, 0xb4, 0x97, 0xa5, 0x87, 0x09, 0xfe, 0x7b, 0xaf,
+    0x1f, 0xc5, 0x27, 0x13, 0xe2, 0x9e, 0x81, 0x24, 0x54, 0x95, 0x4e, 0x18, 0x5b, 0xef, 0x30, 0x14,
+    0xff, 0x67, 0xd3, 0x10, 0x6d, 0xed, 0x1e, 0xad, 0xea, 0xcb, 0xbb, 0xa5, 0xca, 0xd6, 0xc5, 0xb7,
+    0xe3, 0xc5, 0xd3, 0x94, 0xde, 0x84, 0xa8, 0x5f, 0x9f, 0x09, 0x83, 0x0f, 0x0f, 0x3f, 0x55, 0xe1,
+    0xee, 0x1e, 0x5c, 0x09, 0xfa, 0xde, 0x11, 0xeb, 0xf6, 0x20, 0xe0, 0xca, 0x0f, 0xf8, 0xe2, 0x53,
+    0xed, 0xc8, 0x9a, 0xc4, 0x49, 0x0f, 0xd1, 0xf1, 0x75, 0x2a, 0xc9, 0x33, 0x06, 0x12, 0x75, 0xdf,
+    0x6c, 0xb1, 0xef, 0xdf, 0x50, 0xc3, 0x6e, 0x9d, 0x5d, 0x9f, 0x7c, 0xcd, 0x9b, 0x2d, 0x98, 0x60,
+    0xbf, 0xee, 0x35, 0x94, 0xee, 0x5b, 0x3d, 0x43, 0x3d, 0xf6, 0xfb, 0x34, 0xb5, 0x43, 0xc0, 0x6a,
+    0xd0, 0x6b, 0x07, 0xcc, 0xca, 0x3f, 0x2e, 0x1e, 0x1a, 0xa4, 0xe2, 0xed, 0xae, 0xaa, 0xf0, 0x5a,
+    0x17, 0x14, 0x8d, 0xf4, 0xfa, 0x1a, 0xb0, 0xac, 0x41, 0xee, 0xdd, 0xe9, 0xf6, 0xc1, 0x31, 0x26,
+    0xa2, 0xb7, 0xd6, 0x62, 0xf3, 0xbf, 0x35, 0x2d, 0xfb, 0x5a, 0xd1, 0xc0, 0x51, 0xec, 0xf2, 0xbb,
+    0xdf, 0x61, 0x83, 0x0d, 0x81, 0x9e, 0x25, 0x36, 0xb7, 0x3c, 0xc7, 0xb4, 0xb0, 0xe0, 0x98, 0xed,
+    0x42, 0xad, 0x6f, 0xb2, 0x70, 0xe5, 0xdf, 0x3f, 0xa1, 0xa3, 0x90, 0xc9, 0x27, 0x00, 0x00,
+};
+
+const Asset ASSETS[] = {
+    {"style.css", "text/css", STYLE_CSS_GZ, sizeof(STYLE_CSS_GZ), "\"91712e3f800a9a01\""},
+    {"app.js", "application/javascript", APP_JS_GZ, sizeof(APP_JS_GZ), "\"79c403d04e63d30d\""},
+};
+}  // namespace WebAssets
+
+#endif  // WEB_ASSETS_H
@@ -0,0 +1,101 @@
+import gzip
+import hashlib
+import os
+
+# Files under web/ served by the config UI, with the content type each is sent as
+ASSETS = [
+    ("style.css", "text/css"),
+    ("app.js", "application/javascript"),
+]
+
+HEADER_PATH = os.path.join("include", "WebAssets.h")
+BYTES_PER_LINE = 16
+
+
+def compress(path):
+    """
+    Gzip a file the same way on every build.
+
+    The timestamp and file name are left out of the gzip header, so the bytes,
+    and with them the ETag, only change when the file does.
+    """
+    with open(path, "rb") as f:
+        data = f.read()
+    return data, gzip.compress(data, compresslevel=9, mtime=0)
+
+
+def to_identifier(name):
+    return name.replace(".", "_").upper()
+
+
+def format_bytes(data):
+    lines = []
+    for i in range(0, len(data), BYTES_PER_LINE):
+        chunk = data[i : i + BYTES_PER_LINE]
+        lines.append("    " + ", ".join(f"0x{b:02x}" for b in chunk) + ",")
+    return "\n".join(lines)
+
+
+def generate_assets_header(source_dir="web"):
+    """
+    Generate WebAssets.h with each file in web/ gzipped into PROGMEM.
+
+    The header is only rewritten when an asset changed, so an unchanged UI
+    does not rebuild WiFiManager.
+    """
+    arrays = []
+    entries = []
+    for name, content_type in ASSETS:
+        raw, packed = compress(os.path.join(source_dir, name))
+        ident = to_identifier(name)
+        etag = hashlib.sha1(packed).hexdigest()[:16]
+        arrays.append(
+            f"// {name}: {len(raw)} bytes, {len(packed)} gzipped\n"
+            f"const uint8_t {ident}_GZ[] PROGMEM = {{\n{format_bytes(packed)}\n}};"
+        )
+        entries.append(
+            f'    {{"{name}", "{content_type}", {ident}_GZ, sizeof({ident}_GZ), "\\"{etag}\\""}},'
+        )
+        print(f"Web asset {name}: {len(raw)} -> {len(packed)} bytes")
+
+    header = f"""#ifndef WEB_ASSETS_H
+#define WEB_ASSETS_H
+
+// Automatically generated from web/ by scripts/web_assets.py - do not edit manually
+
+#include <Arduino.h>
+
+namespace WebAssets {{
+struct Asset {{
+  const char* name;
+  const char* contentType;
+  const uint8_t* gzipped;
+  size_t size;
+  const char* etag;
+}};
+
+{chr(10).join(arrays)}
+
+const Asset ASSETS[] = {{
+{chr(10).join(entries)}
+}};
+}}  // namespace WebAssets
+
+#endif  // WEB_ASSETS_H
+"""
+
+    try:
+        with open(HEADER_PATH, "r") as f:
+            if f.read() == header:
+                return
+    except FileNotFoundError:
+        pass
+
+    os.makedirs("include", exist_ok=True)
+    with open(HEADER_PATH, "w") as f:
+        f.write(header)
+    print(f"Generated {HEADER_PATH}")
+
+
+if __name__ == "__main__":
+    generate_assets_header()
@@ -0,0 +1,193 @@
+#include "AdcSampler.h"
+#include "LoopWaker.h"
+
+#if ADC_SAMPLER_SUPPORTED
+
+namespace {
+constexpr uint32_t SAMPLER_TASK_STACK = 2048;
+constexpr UBaseType_t SAMPLER_TASK_PRIORITY = 2;  // Above idle, below audio and the loop
+constexpr BaseType_t SAMPLER_TASK_CORE = 0;
+constexpr uint32_t READ_TIMEOUT_MS = 100;  // Bounds how long end() waits for the task
+constexpr uint32_t FIRST_FRAME_TIMEOUT_MS = 50;
+}  // namespace
+
+bool AdcSampler::begin() {
+  if (running) return true;
+
+  // Both pots must sit on one ADC unit for single-unit conversion
+  for (size_t i = 0; i < CHANNELS; i++) {
+    if (adc_continuous_io_to_channel(pins[i], &units[i], &channels[i]) != ESP_OK) {
+#ifdef DEBUG_SERIAL_OUTPUT
+      Serial.printf("ADC sampler: GPIO%d has no ADC channel, using analogRead\n", pins[i]);
+#endif
+      return false;
+    }
+  }
+  if (units[0] != units[1]) {
+#ifdef DEBUG_SERIAL_OUTPUT
+    Serial.println(F("ADC sampler: pots on different ADC units, using analogRead"));
+#endif
+    return false;
+  }
+#if (defined(CONFIG_IDF_TARGET_ESP32S3) || defined(CONFIG_IDF_TARGET_ESP32C3)) && \
+    !defined(CONFIG_ADC_CONTINUOUS_FORCE_USE_ADC2_ON_C3_S3)
+  if (units[0] == ADC_UNIT_2) {
+#ifdef DEBUG_SERIAL_OUTPUT
+    Serial.println(F("ADC sampler: pots are on ADC2, which this chip cannot sample "
+                     "continuously; using analogRead"));
+#endif
+    return false;
+  }
+#endif
+
+  adc_continuous_handle_cfg_t handleConfig = {};
+  handleConfig.max_store_buf_size = FRAME_RESULTS * SOC_ADC_DIGI_RESULT_BYTES * 4;
+  handleConfig.conv_frame_size = FRAME_RESULTS * SOC_ADC_DIGI_RESULT_BYTES;
+  if (adc_continuous_new_handle(&handleConfig, &handle) != ESP_OK) {
+    handle = nullptr;
+    return false;
+  }
+
+  adc_digi_pattern_config_t pattern[CHANNELS] = {};
+  for (size_t i = 0; i < CHANNELS; i++) {
+    pattern[i].atten = ADC_ATTEN_DB_12;  // Full 0-3.3 V pot range, as analogRead() used
+    pattern[i].channel = channels[i];
+    pattern[i].unit = units[i];
+    pattern[i].bit_width = SOC_ADC_DIGI_MAX_BITWIDTH;
+  }
+
+  adc_continuous_config_t config = {};
+  config.pattern_num = CHANNELS;
+  config.adc_pattern = pattern;
+  config.sample_freq_hz = SAMPLE_RATE_HZ;
+  config.conv_mode = units[0] == ADC_UNIT_1 ? ADC_CONV_SINGLE_UNIT_1 : ADC_CONV_SINGLE_UNIT_2;
+  config.format = ADC_DIGI_OUTPUT_FORMAT_TYPE2;
+
+  if (adc_continuous_config(handle, &config) != ESP_OK || adc_continuous_start(handle) != ESP_OK) {
+#ifdef DEBUG_SERIAL_OUTPUT
+    Serial.println(F("ADC sampler: driver rejected the configuration, using analogRead"));
+#endif
+    adc_continuous_deinit(handle);
+    handle = nullptr;
+    return false;
+  }
+
+  seeded = false;
+  running = true;
+  BaseType_t taskResult =
+      xTaskCreatePinnedToCore(AdcSampler::samplerTaskEntry, "adc_sampler", SAMPLER_TASK_STACK,
+                              this, SAMPLER_TASK_PRIORITY, &samplerTask, SAMPLER_TASK_CORE);
+  if (taskResult != pdPASS) {
+    running = false;
+    samplerTask = nullptr;
+    end();
+    return false;
+  }
+
+  // Hold off readers until the first frame lands; a silent ADC means falling back
+  for (uint32_t waited = 0; !seeded && waited < FIRST_FRAME_TIMEOUT_MS; waited++) {
+    vTaskDelay(pdMS_TO_TICKS(1));
+  }
+  if (!seeded) {
+#ifdef DEBUG_SERIAL_OUTPUT
+    Serial.println(F("ADC sampler: no frames from the DMA, using analogRead"));
+#endif
+    end();
+    return false;
+  }
+  LoopWaker::getInstance().setAwake(LoopWaker::Holder::ADC, true);  // The DMA never pauses
+  return true;
+}
+
+void AdcSampler::end() {
+  running = false;
+  // The task notices within one read timeout and clears its handle on the way out
+  while (samplerTask != nullptr) {
+    vTaskDelay(pdMS_TO_TICKS(1));
+  }
+
+  if (handle != nullptr) {
+    adc_continuous_stop(handle);
+    adc_continuous_deinit(handle);
+    handle = nullptr;
+  }
+  LoopWaker::getInstance().setAwake(LoopWaker::Holder::ADC, false);
+}
+
+void AdcSampler::samplerTaskEntry(void* parameter) {
+  AdcSampler* sampler = static_cast<AdcSampler*>(parameter);
+  sampler->samplerLoop();
+  sampler->samplerTask = nullptr;
+  vTaskDelete(nullptr);
+}
+
+void AdcSampler::samplerLoop() {
+  uint8_t frame[FRAME_RESULTS * SOC_ADC_DIGI_RESULT_BYTES];
+
+  while (running) {
+    // Blocks until the DMA has filled a frame, which paces the task at the sample rate
+    uint32_t length = 0;
+    if (adc_continuous_read(handle, frame, sizeof(frame), &length, READ_TIMEOUT_MS) != ESP_OK) {
+      continue;
+    }
+
+    uint32_t sum[CHANNELS] = {};
+    uint32_t count[CHANNELS] = {};
+    for (uint32_t offset = 0; offset + SOC_ADC_DIGI_RESULT_BYTES <= length;
+         offset += SOC_ADC_DIGI_RESULT_BYTES) {
+      const adc_digi_output_data_t* result =
+          reinterpret_cast<const adc_digi_output_data_t*>(&frame[offset]);
+      for (size_t i = 0; i < CHANNELS; i++) {
+        if (result->type2.unit == units[i] && result->type2.channel == channels[i]) {
+          sum[i] += result->type2.data;
+          count[i]++;
+        }
+      }
+    }
+
+    uint32_t now = micros();
+    for (size_t i = 0; i < CHANNELS; i++) {
+      if (count[i] > 0) {
+        publish(i, (sum[i] + count[i] / 2) / count[i], now);
+      }
+    }
+    if (count[0] > 0 && count[1] > 0) {
+      seeded = true;
+    }
+  }
+}
+
+#else
+
+bool AdcSampler::begin() { return false; }
+
+void AdcSampler::end() { running = false; }
+
+void AdcSampler::samplerTaskEntry(void* parameter) { (void)parameter; }
+
+void AdcSampler::samplerLoop() {}
+
+#endif
+
+void AdcSampler::publish(size_t channel, int sample, uint32_t nowMicros) {
+  if (channel == 0) {
+    publishTo(tuningFilter, channel, sample, nowMicros);
+  } else {
+    publishTo(volumeFilter, channel, sample, nowMicros);
+  }
+}
+
+template <typename Reader>
+void AdcSampler::publishTo(Reader& filter, size_t channel, int sample, uint32_t nowMicros) {
+  if (!seeded) {
+    filter.begin(sample, nowMicros);
+  }
+  int previous = stable[channel];
+  stable[channel] = filter.push(sample, nowMicros);
+  smoothed[channel] = filter.pushRaw(sample, nowMicros);
+
+  // The loop idles between deadlines, so a pot that moved has to wake it
+  if (seeded && stable[channel] != previous) {
+    LoopWaker::getInstance().wake();
+  }
+}
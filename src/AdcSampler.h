@@ -0,0 +1,82 @@
+#ifndef ADC_SAMPLER_H
+#define ADC_SAMPLER_H
+
+#include <Arduino.h>
+#include "PotentiometerReader.h"
+
+// The continuous ADC driver API this sampler is written against ships with Arduino-ESP32 v3
+#if defined(ESP_ARDUINO_VERSION_MAJOR) && (ESP_ARDUINO_VERSION_MAJOR >= 3)
+#define ADC_SAMPLER_SUPPORTED 1
+#include <esp_adc/adc_continuous.h>
+#else
+#define ADC_SAMPLER_SUPPORTED 0
+#endif
+
+/**
+ * DMA sampling for the tuning and volume pots.
+ *
+ * The continuous ADC driver converts both pots round-robin into a DMA ring
+ * without the CPU. A low-priority task drains each frame, averages the
+ * conversions per pot (oversampling) and runs the decimated value through
+ * each pot's PotentiometerReader filter chain, timed from the frame. It
+ * then publishes the result, so getStable()/getSmoothed() are a plain load
+ * and the main loop never waits on a conversion. A change in a stable value
+ * wakes the loop, which otherwise has no reason to look at the pots.
+ *
+ * On the ESP32-S3 and C3, ESP-IDF only runs ADC2 in continuous mode when
+ * built with CONFIG_ADC_CONTINUOUS_FORCE_USE_ADC2_ON_C3_S3, and WiFi shares
+ * ADC2 as well. The FeatherS3 wiring puts both pots on ADC2 (GPIO17/18), so
+ * on this board begin() refuses them up front and the pots stay on analogRead().
+ * The sampler only runs where the pots are wired to ADC1 pins.
+ */
+class AdcSampler {
+ public:
+  AdcSampler(int tuningPin, int volumePin)
+      : pins{tuningPin, volumePin}, tuningFilter(tuningPin), volumeFilter(volumePin) {}
+
+  bool begin();  // Returns false if the driver is unavailable (caller keeps analogRead())
+  void end();
+
+  bool isRunning() const { return running; }
+  bool handles(int pin) const { return channelFor(pin) >= 0; }
+
+  int getStable(int pin) const { return stable[channelFor(pin)]; }      // Like read()
+  int getSmoothed(int pin) const { return smoothed[channelFor(pin)]; }  // Like readRaw()
+
+ private:
+  static constexpr size_t CHANNELS = 2;
+  static constexpr uint32_t SAMPLE_RATE_HZ = 10000;  // Across both pots
+  static constexpr size_t FRAME_RESULTS = 64;        // 32 conversions averaged per pot
+
+  static void samplerTaskEntry(void* parameter);
+  void samplerLoop();
+  void publish(size_t channel, int sample, uint32_t nowMicros);
+  template <typename Reader>
+  void publishTo(Reader& filter, size_t channel, int sample, uint32_t nowMicros);
+
+  int channelFor(int pin) const {
+    for (size_t i = 0; i < CHANNELS; i++) {
+      if (pins[i] == pin) return static_cast<int>(i);
+    }
+    return -1;
+  }
+
+  // Only touched by the sampler task once running
+  const int pins[CHANNELS];
+  TuningPotReader tuningFilter;
+  VolumePotReader volumeFilter;
+  volatile bool seeded = false;  // Set once both pots have been sampled
+
+  volatile int stable[CHANNELS] = {};
+  volatile int smoothed[CHANNELS] = {};
+  volatile bool running = false;
+
+#if ADC_SAMPLER_SUPPORTED
+  adc_continuous_handle_t handle = nullptr;
+  TaskHandle_t samplerTask = nullptr;
+  adc_unit_t units[CHANNELS];
+  adc_channel_t channels[CHANNELS];
+#endif
+};
+
+#endif
@@ -1,8 +1,20 @@
 #include "AudioManager.h"
 #include "PowerManager.h"
+#include "StationManager.h"
 
 void AudioManager::begin() {
-  configurePWM();
+#ifdef AUDIO_SAMPLE_ENGINE
+  sampleOutput = engine.begin();
+#endif
+  if (sampleOutput) {
+    // Only the sample renderer mixes neighbours, so the LEDC fallback never holds their timelines
+    if (interferers == nullptr) interferers = new Interferer[AudioSynth::MAX_INTERFERERS];
+    engine.synth().setMasterLevel(0);
+    engine.synth().setToneFrequency(MORSE_FREQUENCY);
+    engine.synth().setToneLevel(255);
+  } else {
+    configurePWM();
+  }
   lastPulseTime = 0;
   lastVolumeUpdate = 0;
   lastStaticPatternUpdate = 0;
@@ -30,6 +42,13 @@ void AudioManager::setVolume(int adcValue) {
     // Store the new volume value
     currentVolume = newVolume;
 
+    // The sample output applies volume as a master gain from the next block on
+    if (sampleOutput) {
+      engine.synth().setMasterLevel(currentVolume);
+      engine.wake();
+      return;
+    }
+
     // If volume is zero, ensure audio is completely stopped
     if (currentVolume == 0) {
       // Completely silence the audio and detach the pin
@@ -43,7 +62,7 @@ void AudioManager::setVolume(int adcValue) {
 
       // Update volume for morse tone
       if (isPlayingMorse) {
-        ledcWrite(Audio::SPEAKER_CHANNEL, currentVolume);
+        ledcWrite(Audio::SPEAKER_CHANNEL, morseDuty());
       }
       // Update static noise with new volume - only update the volume, not the frequency
       else if (isStaticPlaying) {
@@ -84,10 +103,10 @@ int AudioManager::calculateStaticVolume() {
   // Add some natural variation to the volume
   int volumeVariation = 0;
   if (!isCrackling) {
-    volumeVariation = random(-5, 6);
+    volumeVariation = noise.between(-5, 6);
   } else {
     // During crackle, apply the crackle volume variation
-    int crackleIntensity = random(staticVolume / 2, int(staticVolume * 1.5));
+    int crackleIntensity = noise.between(staticVolume / 2, int(staticVolume * 1.5));
     return constrain(crackleIntensity, 0, 255);
   }
 
@@ -117,19 +136,74 @@ void AudioManager::handlePlayback() {
   }
 }
 
+unsigned long AudioManager::msUntilNextUpdate(unsigned long now) const {
+  // The sample renderer animates static on its own task; only the LEDC pattern is stepped here
+  if (sampleOutput || !isStaticPlaying || isPlayingMorse || currentVolume <= 0) {
+    return Timing::MAX_IDLE_INTERVAL;
+  }
+  unsigned long elapsed = now - lastStaticPatternUpdate;
+  return elapsed >= STATIC_PATTERN_CHANGE_INTERVAL ? 0 : STATIC_PATTERN_CHANGE_INTERVAL - elapsed;
+}
+
 void AudioManager::playMorseTone() {
   isPlayingMorse = true;
+  if (sampleOutput) {
+    engine.synth().setToneKeyed(true);
+    engine.wake();
+    return;
+  }
   // Ensure PWM is attached
   ledcAttachPin(Pins::SPEAKER, Audio::SPEAKER_CHANNEL);
-  // Set exact 600Hz frequency for Morse code
-  ledcWriteTone(Audio::SPEAKER_CHANNEL, MORSE_FREQUENCY);
-  ledcWrite(Audio::SPEAKER_CHANNEL, currentVolume);
+  writeMorsePitch();
+  ledcWrite(Audio::SPEAKER_CHANNEL, morseDuty());
 }
 
 void AudioManager::stopMorseTone() {
   isPlayingMorse = false;
+  if (sampleOutput) {
+    engine.synth().setToneKeyed(false);
+    return;
+  }
   ledcWrite(Audio::SPEAKER_CHANNEL, 0);
   ledcDetachPin(Pins::SPEAKER);
+  pitchWritten = 0;
+}
+
+void AudioManager::prepareMorseTone() {
+  isPlayingMorse = false;
+  if (sampleOutput) {
+    engine.synth().setToneKeyed(false);
+    return;
+  }
+  ledcAttachPin(Pins::SPEAKER, Audio::SPEAKER_CHANNEL);
+  writeMorsePitch();
+  ledcWrite(Audio::SPEAKER_CHANNEL, 0);
+}
+
+void AudioManager::gateMorseTone(bool on) {
+  // Called from the keyer timer task: only touch the duty, never re-attach the pin
+  isPlayingMorse = on;
+  if (sampleOutput) {
+    engine.synth().setToneKeyed(on);
+    if (on) engine.wake();
+    return;
+  }
+  // A new pitch from mixStations() lands on the next key-down, where it cannot be heard
+  if (on) writeMorsePitch();
+  ledcWrite(Audio::SPEAKER_CHANNEL, on ? morseDuty() : 0);
+}
+
+void AudioManager::writeMorsePitch() {
+  uint16_t pitch = morsePitch;
+  if (pitch != pitchWritten) {
+    ledcWriteTone(Audio::SPEAKER_CHANNEL, pitch);
+    pitchWritten = pitch;
+  }
+}
+
+int AudioManager::morseDuty() const {
+  // The LEDC counterpart of the sample path's tone gain: the station fades with its signal
+  return currentVolume * morseLevel / 255;
 }
 
 void AudioManager::playStaticNoise(int signalStrength) {
@@ -137,14 +211,24 @@ void AudioManager::playStaticNoise(int signalStrength) {
   isStaticPlaying = true;
   currentSignalStrength = signalStrength;
 
-  // Ensure PWM is attached
-  ledcAttachPin(Pins::SPEAKER, Audio::SPEAKER_CHANNEL);
+  if (sampleOutput) {
+    engine.synth().setToneKeyed(false);
+    clearInterferers();
+  } else {
+    // Ensure PWM is attached
+    ledcAttachPin(Pins::SPEAKER, Audio::SPEAKER_CHANNEL);
+  }
 
   // Update the static noise pattern
   updateStaticPattern();
 }
 
 void AudioManager::updateStaticPattern() {
+  if (sampleOutput) {
+    postStatic();
+    return;
+  }
+
   // Don't process anything if volume is zero
   if (currentVolume <= 0) {
     return;
@@ -168,13 +252,13 @@ void AudioManager::updateStaticPattern() {
     // to pull back toward the center of our desired frequency range
     if (staticBaseFrequency > midFrequency + 50) {
       // If too high, bias toward decreasing
-      staticBaseFrequency += random(-8, 4);
+      staticBaseFrequency += noise.between(-8, 4);
     } else if (staticBaseFrequency < midFrequency - 50) {
       // If too low, bias toward increasing
-      staticBaseFrequency += random(-4, 8);
+      staticBaseFrequency += noise.between(-4, 8);
     } else {
       // Within reasonable range, use balanced random adjustment
-      staticBaseFrequency += random(-5, 6);
+      staticBaseFrequency += noise.between(-5, 6);
     }
 
     // Hard boundaries to ensure we stay in range
@@ -182,16 +266,18 @@ void AudioManager::updateStaticPattern() {
 
     // Periodically reset to center range to prevent long-term drift
     // Reset roughly every 10 seconds (200 updates at 50ms intervals)
-    if (random(200) == 0) {
-      staticBaseFrequency = midFrequency + random(-25, 26);
+    if (noise.between(0, 200) == 0) {
+      staticBaseFrequency = midFrequency + noise.between(-25, 26);
     }
 
     lastStaticPatternUpdate = currentTime;
 
     // Determine if we should start a new crackle - based on signal strength only, not volume
-    if (!isCrackling && random(0, 100) < map(staticIntensity, 0, 255, 0, MAX_CRACKLE_CHANCE)) {
+    if (!isCrackling &&
+        noise.between(0, 100) < map(staticIntensity, 0, 255, 0, Audio::MAX_CRACKLE_CHANCE)) {
       isCrackling = true;
-      crackleEndTime = currentTime + random(CRACKLE_DURATION_MIN, CRACKLE_DURATION_MAX);
+      crackleEndTime =
+          currentTime + noise.between(Audio::CRACKLE_DURATION_MIN, Audio::CRACKLE_DURATION_MAX);
     }
   }
 
@@ -203,7 +289,7 @@ void AudioManager::updateStaticPattern() {
     if (currentTime < crackleEndTime) {
       // During crackle - use higher frequency and variable volume
       // Frequency range for crackles should be fixed, independent of volume
-      noiseFrequency = random(MIN_STATIC_FREQ * 2, MAX_STATIC_FREQ * 3);
+      noiseFrequency = noise.between(MIN_STATIC_FREQ * 2, MAX_STATIC_FREQ * 3);
     } else {
       // Crackle has ended
       isCrackling = false;
@@ -212,7 +298,7 @@ void AudioManager::updateStaticPattern() {
   } else {
     // Normal static noise with small random variations
     // Frequency variations should be independent of volume
-    int randomOffset = random(-20, 21);
+    int randomOffset = noise.between(-20, 21);
     noiseFrequency = staticBaseFrequency + randomOffset;
     noiseFrequency = constrain(noiseFrequency, MIN_STATIC_FREQ, MAX_STATIC_FREQ);
   }
@@ -223,11 +309,102 @@ void AudioManager::updateStaticPattern() {
   // Apply the frequency and volume
   ledcWriteTone(Audio::SPEAKER_CHANNEL, noiseFrequency);
   ledcWrite(Audio::SPEAKER_CHANNEL, volumeLevel);
+  pitchWritten = 0;
+}
+
+void AudioManager::mixStations(const StationCandidate* candidates, size_t count,
+                               int tuningValue) {
+  if (count == 0) return;
+
+  // LEDC plays one source, so it keeps the strongest station alone: its beat pitch and a
+  // level that follows its signal, both picked up from the next key-down
+  if (!sampleOutput) {
+    morsePitch = beatFrequency(*candidates[0].station, tuningValue);
+    morseLevel = constrain(candidates[0].signalStrength, 0, 255);
+    return;
+  }
+  auto& synth = engine.synth();
+
+  // Crossfade: the tuned station rises with signal strength while the static bed falls away
+  currentSignalStrength = constrain(candidates[0].signalStrength, 0, 255);
+  synth.setToneFrequency(beatFrequency(*candidates[0].station, tuningValue));
+  synth.setToneLevel(currentSignalStrength);
+  postStatic();
+
+  // Weaker stations inside the leeway play their own messages on their own pitch
+  synth.setKeyingTimings(&ConfigManager::getInstance().getCurrentMorseTimings());
+  for (size_t slot = 0; slot < AudioSynth::MAX_INTERFERERS; slot++) {
+    if (slot + 1 < count) {
+      setInterferer(slot, candidates[slot + 1], tuningValue);
+    } else if (interferers[slot].station != nullptr) {
+      interferers[slot].station = nullptr;
+      interferers[slot].posted = nullptr;
+      synth.setInterferer(slot, nullptr, 0, 0);
+    }
+  }
+}
+
+void AudioManager::setInterferer(size_t slot, const StationCandidate& candidate,
+                                 int tuningValue) {
+  Interferer& interferer = interferers[slot];
+  auto& synth = engine.synth();
+
+  if (candidate.station != interferer.station) {
+    // Compile into the timeline the renderer is not reading. If it has not yet let go of
+    // the previous one, try again on the next tick.
+    const MorseTimeline* inUse = synth.getInterfererTimelineInUse(slot);
+    MorseTimeline* spare = nullptr;
+    for (MorseTimeline& timeline : interferer.timelines) {
+      if (&timeline != inUse && &timeline != interferer.posted) {
+        spare = &timeline;
+      }
+    }
+    if (spare == nullptr) return;
+
+    spare->compile(candidate.station->getMessage());
+    interferer.station = candidate.station;
+    interferer.posted = spare;
+  }
+
+  synth.setInterferer(slot, interferer.posted, beatFrequency(*candidate.station, tuningValue),
+                      candidate.signalStrength);
+  engine.wake();
+}
+
+void AudioManager::clearInterferers() {
+  for (size_t slot = 0; slot < AudioSynth::MAX_INTERFERERS; slot++) {
+    interferers[slot].station = nullptr;
+    interferers[slot].posted = nullptr;
+    engine.synth().setInterferer(slot, nullptr, 0, 0);
+  }
+}
+
+uint16_t AudioManager::beatFrequency(const Station& station, int tuningValue) {
+  // Like a receiver's beat note, the pitch slides as the dial moves across a station
+  int tone = station.getToneFrequency() != 0 ? station.getToneFrequency() : MORSE_FREQUENCY;
+  int offset = (station.getFrequency() - tuningValue) * BEAT_HZ_PER_STEP;
+  return static_cast<uint16_t>(
+      constrain(tone + offset, Radio::MIN_TONE_FREQUENCY, Radio::MAX_TONE_FREQUENCY));
+}
+
+void AudioManager::postStatic() {
+  // The renderer owns the noise and crackle timing; only the levels cross over.
+  // Volume is applied by the master gain, so the static gain is intensity alone.
+  int staticIntensity = map(currentSignalStrength, 0, 255, 255, 0);
+  int crackleChance = map(staticIntensity, 0, 255, 0, Audio::MAX_CRACKLE_CHANCE);
+  engine.synth().setStatic(staticIntensity, crackleChance);
+  engine.wake();
 }
 
 void AudioManager::stop() {
   isPlayingMorse = false;
   isStaticPlaying = false;
+  if (sampleOutput) {
+    engine.synth().silence();
+    clearInterferers();
+    return;
+  }
   ledcWrite(Audio::SPEAKER_CHANNEL, 0);
   ledcDetachPin(Pins::SPEAKER);
+  pitchWritten = 0;
 }
@@ -2,9 +2,17 @@
 #define AUDIOMANAGER_H
 
 #include "Config.h"
+#include "SampleAudioEngine.h"
+#include "StaticNoise.h"
+
+struct StationCandidate;
+class Station;
 
 class AudioManager {
  public:
+  // Stations the sample output can render at once: the tuned one plus its neighbours
+  static constexpr size_t MAX_STATIONS = 1 + AudioSynth::MAX_INTERFERERS;
+
   static AudioManager& getInstance() {
     static AudioManager instance;
     return instance;
@@ -13,24 +21,40 @@ class AudioManager {
   void begin();
   void setVolume(int adcValue);
   void handlePlayback();
+  unsigned long msUntilNextUpdate(unsigned long now) const;  // When handlePlayback() next has work
   void playMorseTone();
   void stopMorseTone();
+  void prepareMorseTone();      // Attach the speaker at the morse pitch with the gate closed
+  void gateMorseTone(bool on);  // Duty-only keying for the hardware keyer
   void playStaticNoise(int signalStrength);
+  // Tuned station and its neighbours under a static bed, strongest first
+  void mixStations(const StationCandidate* candidates, size_t count, int tuningValue);
   void stop();
 
  private:
+  friend class BenchCases;
+
   AudioManager() = default;
   AudioManager(const AudioManager&) = delete;
   AudioManager& operator=(const AudioManager&) = delete;
 
   void configurePWM();
   int calculateVolumeLevel(int adcValue);
+  void postStatic();  // Hands the static level and crackle chance to the sample renderer
+  void setInterferer(size_t slot, const StationCandidate& candidate, int tuningValue);
+  void clearInterferers();
+  static uint16_t beatFrequency(const Station& station, int tuningValue);
+
+  // LEDC morse tone at the strongest station's pitch and level (see mixStations())
+  void writeMorsePitch();
+  int morseDuty() const;
 
   // Static noise generation helper methods
   void updateStaticPattern();
   int calculateStaticVolume();
 
   static constexpr int MORSE_FREQUENCY = 600;  // Fixed 600Hz for Morse code
+  static constexpr int BEAT_HZ_PER_STEP = 3;   // Tone shift per ADC step off-tune
 
   // Updated static frequency range
   static constexpr int MIN_STATIC_FREQ = 100;  // 100 Hz
@@ -38,10 +62,7 @@ class AudioManager {
 
   // Static noise generation parameters
   static constexpr int STATIC_PATTERN_CHANGE_INTERVAL = 50;  // ms between static pattern updates
-  static constexpr int MAX_CRACKLE_CHANCE =
-      7;  // % chance of a crackle at maximum static (reduced from 30)
-  static constexpr int CRACKLE_DURATION_MIN = 30;  // Minimum duration of a crackle in ms
-  static constexpr int CRACKLE_DURATION_MAX = 80;  // Maximum duration of a crackle in ms
+  // Crackle chance and durations are shared with the sample renderer (Audio::*CRACKLE*)
 
   // State tracking
   int currentVolume = 0;
@@ -54,6 +75,25 @@ class AudioManager {
   bool isStaticPlaying = false;     // Track if static noise is currently playing
   int currentSignalStrength = 255;  // Start with full signal (no static)
   int staticBaseFrequency = MIN_STATIC_FREQ;
+  StaticNoise noise;  // xorshift source for the LEDC static pattern's variations
+
+  // LEDC morse tone, written by the loop and read by the keyer task on its next key-down
+  volatile uint16_t morsePitch = MORSE_FREQUENCY;
+  volatile int morseLevel = 255;
+  uint16_t pitchWritten = 0;  // Last ledcWriteTone() pitch, 0 once static or a stop moved it
+
+  // Sample output, used instead of LEDC when built with AUDIO_SAMPLE_ENGINE and I2S starts
+  SampleAudioEngine engine;
+  bool sampleOutput = false;
+
+  // Neighbouring stations, allocated once the sample engine starts. Each has two
+  // timelines so one can be compiled while the renderer is still reading the other.
+  struct Interferer {
+    const Station* station = nullptr;
+    const MorseTimeline* posted = nullptr;
+    MorseTimeline timelines[2];
+  };
+  Interferer* interferers = nullptr;
 
   static constexpr unsigned long VOLUME_UPDATE_INTERVAL = 10;  // Reduced from 20ms to 10ms
 
@@ -0,0 +1,180 @@
+#include "AudioSynth.h"
+#include <math.h>
+
+int16_t AudioSynth::sineTable[AudioSynth::SINE_TABLE_SIZE];
+int16_t AudioSynth::envelopeTable[AudioSynth::ENVELOPE_TABLE_SIZE];
+bool AudioSynth::tablesReady = false;
+
+AudioSynth::AudioSynth() {
+  // Filled once at start-up; the render path only ever indexes them
+  if (tablesReady) return;
+
+  const double radiansPerEntry = 6.283185307179586 / SINE_TABLE_SIZE;
+  for (size_t i = 0; i < SINE_TABLE_SIZE; i++) {
+    sineTable[i] = static_cast<int16_t>(lround(sin(radiansPerEntry * i) * 32767.0));
+  }
+
+  // 0.5 * (1 - cos(x)) over half a period rises smoothly from 0 to 1
+  const double radiansPerStep = 3.141592653589793 / (ENVELOPE_TABLE_SIZE - 1);
+  for (size_t i = 0; i < ENVELOPE_TABLE_SIZE; i++) {
+    envelopeTable[i] = static_cast<int16_t>(lround((1.0 - cos(radiansPerStep * i)) * 16383.5));
+  }
+  tablesReady = true;
+}
+
+void AudioSynth::setMasterLevel(uint8_t level) { masterLevel = level; }
+
+void AudioSynth::setToneFrequency(uint16_t frequencyHz) {
+  voices[PRIMARY_VOICE].frequency = frequencyHz;
+}
+
+void AudioSynth::setToneLevel(uint8_t level) { voices[PRIMARY_VOICE].level = level; }
+
+void AudioSynth::setToneKeyed(bool keyed) { voices[PRIMARY_VOICE].keyRequest = keyed; }
+
+void AudioSynth::setToneEnvelope(uint8_t milliseconds) {
+  envelopeStep = envelopeStepFor(constrain(milliseconds, MIN_ENVELOPE_MS, MAX_ENVELOPE_MS));
+}
+
+void AudioSynth::setStatic(uint8_t level, uint8_t chance) {
+  staticLevel = level;
+  crackleChance = chance;
+}
+
+void AudioSynth::setInterferer(size_t slot, const MorseTimeline* timeline, uint16_t frequencyHz,
+                               uint8_t level) {
+  if (slot >= MAX_INTERFERERS) return;
+  Voice& voice = voices[PRIMARY_VOICE + 1 + slot];
+  voice.frequency = frequencyHz;
+  voice.level = level;
+  voice.timeline = timeline;
+}
+
+const MorseTimeline* AudioSynth::getInterfererTimelineInUse(size_t slot) const {
+  return slot < MAX_INTERFERERS ? voices[PRIMARY_VOICE + 1 + slot].timelineInUse : nullptr;
+}
+
+void AudioSynth::setKeyingTimings(const Audio::MorseTimings* timings) { keyingTimings = timings; }
+
+void AudioSynth::silence() {
+  voices[PRIMARY_VOICE].keyRequest = false;
+  for (size_t slot = 0; slot < MAX_INTERFERERS; slot++) {
+    voices[PRIMARY_VOICE + 1 + slot].timeline = nullptr;
+  }
+  staticLevel = 0;
+}
+
+uint32_t AudioSynth::phaseIncrementFor(uint16_t frequencyHz) {
+  return static_cast<uint32_t>((static_cast<uint64_t>(frequencyHz) << 32) / SAMPLE_RATE);
+}
+
+uint32_t AudioSynth::envelopeStepFor(uint8_t milliseconds) {
+  // Walk the whole table in the requested number of samples
+  uint32_t samples = static_cast<uint32_t>(milliseconds) * SAMPLE_RATE / 1000;
+  return ENVELOPE_FULL / (samples > 0 ? samples : 1);
+}
+
+uint32_t AudioSynth::samplesFor(MorseTimeline::Element element,
+                                const Audio::MorseTimings& timings) {
+  uint32_t samples = MorseTimeline::durationOf(element, timings) * SAMPLE_RATE / 1000;
+  return samples > 0 ? samples : 1;
+}
+
+void AudioSynth::latchTimeline(Voice& voice, const Audio::MorseTimings* timings) {
+  const MorseTimeline* posted = timings != nullptr ? voice.timeline : nullptr;
+  if (posted == voice.timelineInUse) return;
+
+  // A new station starts from the top of its message; the old timeline is released
+  voice.timelineInUse = posted;
+  voice.elementIndex = 0;
+  voice.keyed = false;
+  if (posted != nullptr && !posted->isEmpty()) {
+    voice.samplesLeft = samplesFor(posted->at(0), *timings);
+    voice.keyed = MorseTimeline::isKeyed(posted->at(0));
+  }
+}
+
+void AudioSynth::advanceTimeline(Voice& voice, const Audio::MorseTimings& timings) {
+  const MorseTimeline& timeline = *voice.timelineInUse;
+  // Stations repeat their message, so wrap instead of stopping
+  voice.elementIndex = voice.elementIndex + 1 < timeline.size() ? voice.elementIndex + 1 : 0;
+  MorseTimeline::Element element = timeline.at(voice.elementIndex);
+  voice.samplesLeft = samplesFor(element, timings);
+  voice.keyed = MorseTimeline::isKeyed(element);
+}
+
+void AudioSynth::render(int16_t* out, size_t count) {
+  // Latch the posted parameters once per block
+  const uint32_t attackStep = envelopeStep;
+  const int32_t staticGain = staticLevel;
+  const int32_t masterGain = masterLevel;
+  const Audio::MorseTimings* timings = keyingTimings;
+
+  // Only voices that are sounding (or still releasing) are mixed
+  Voice* active[MAX_VOICES];
+  size_t activeCount = 0;
+  for (size_t v = 0; v < MAX_VOICES; v++) {
+    Voice& voice = voices[v];
+    if (v == PRIMARY_VOICE) {
+      voice.keyed = voice.keyRequest;
+    } else {
+      latchTimeline(voice, timings);
+    }
+    voice.step = phaseIncrementFor(voice.frequency);
+    voice.gain = voice.level;
+
+    // A released tone stays audible until its envelope has fully decayed
+    bool sounding = voice.keyed || voice.envelopePosition > 0 || voice.timelineInUse != nullptr;
+    if (voice.gain > 0 && sounding) {
+      active[activeCount++] = &voice;
+    } else {
+      voice.envelopePosition = 0;
+    }
+  }
+
+  silent = masterGain == 0 || (activeCount == 0 && staticGain == 0);
+  if (silent) {
+    for (size_t v = 0; v < MAX_VOICES; v++) {
+      voices[v].envelopePosition = 0;
+    }
+    memset(out, 0, count * sizeof(int16_t));
+    return;
+  }
+
+  if (staticGain > 0) {
+    noise.beginBlock(count, crackleChance);
+  }
+
+  for (size_t i = 0; i < count; i++) {
+    int32_t sample = 0;
+
+    for (size_t a = 0; a < activeCount; a++) {
+      Voice& voice = *active[a];
+      if (voice.timelineInUse != nullptr && --voice.samplesLeft == 0) {
+        advanceTimeline(voice, *timings);
+      }
+
+      if (voice.keyed) {
+        voice.envelopePosition = ENVELOPE_FULL - voice.envelopePosition > attackStep
+                                     ? voice.envelopePosition + attackStep
+                                     : ENVELOPE_FULL;
+      } else {
+        voice.envelopePosition =
+            voice.envelopePosition > attackStep ? voice.envelopePosition - attackStep : 0;
+      }
+
+      // Each source peaks at half scale (sine >> 1, StaticNoise::PEAK)
+      int32_t tone = ((sineTable[voice.phase >> 24] >> 1) * voice.gain) >> 8;
+      sample += (tone * envelopeTable[voice.envelopePosition >> 16]) >> 15;
+      voice.phase += voice.step;
+    }
+
+    if (staticGain > 0) {
+      sample += (noise.next() * staticGain) >> 8;
+    }
+
+    // One station plus static cannot clip; crowded bands can, so saturate
+    sample = sample > 32767 ? 32767 : (sample < -32767 ? -32767 : sample);
+    out[i] = static_cast<int16_t>((sample * masterGain) >> 8);
+  }
+}
@@ -0,0 +1,110 @@
+#ifndef AUDIO_SYNTH_H
+#define AUDIO_SYNTH_H
+
+#include <Arduino.h>
+#include "Config.h"
+#include "MorseTimeline.h"
+#include "StaticNoise.h"
+
+/**
+ * Fixed-point sample renderer for the radio audio.
+ *
+ * Produces signed 16-bit mono PCM for the morse tone (a sine from a 256-entry
+ * table, keyed through a raised-cosine attack/release so edges do not click)
+ * and the static bed (band-limited noise with crackle bursts, see StaticNoise),
+ * mixed rather than time-shared. Each source has its own gain and the mix
+ * then passes through a master gain (the volume pot). All arithmetic is
+ * integer: phase accumulators in Q32 and 8-bit gains.
+ *
+ * Besides the primary tone, which is keyed from outside, up to
+ * MAX_INTERFERERS neighbouring stations can be rendered as extra voices.
+ * Each steps through its own MorseTimeline at sample resolution, so no
+ * timer or task is needed per voice and nothing is allocated.
+ *
+ * The setters are called from the main loop and the keyer task while render()
+ * runs on the audio task, so parameters are posted into volatile fields and
+ * latched once at the start of every block.
+ */
+class AudioSynth {
+ public:
+  static constexpr uint32_t SAMPLE_RATE = 16000;  // Output rate (Hz)
+  static constexpr size_t MAX_INTERFERERS = 2;
+
+  AudioSynth();
+
+  void setMasterLevel(uint8_t level);
+  void setToneFrequency(uint16_t frequencyHz);
+  void setToneLevel(uint8_t level);
+  void setToneKeyed(bool keyed);
+  void setToneEnvelope(uint8_t milliseconds);  // Attack and release time of the keying edges
+  void setStatic(uint8_t level, uint8_t crackleChance);
+
+  // Neighbouring station in a slot, looping its timeline; a null timeline mutes the slot
+  void setInterferer(size_t slot, const MorseTimeline* timeline, uint16_t frequencyHz,
+                     uint8_t level);
+  // The timeline the renderer is still reading for a slot, which callers must not rewrite
+  const MorseTimeline* getInterfererTimelineInUse(size_t slot) const;
+  void setKeyingTimings(const Audio::MorseTimings* timings);  // Speed of the interferers
+
+  void silence();
+
+  void render(int16_t* out, size_t count);
+
+  // True when the last rendered block had no audible source
+  bool isSilent() const { return silent; }
+
+ private:
+  struct Voice {
+    // Posted parameters
+    volatile uint16_t frequency = 0;
+    volatile uint8_t level = 0;
+    volatile bool keyRequest = false;                  // Primary voice only
+    const MorseTimeline* volatile timeline = nullptr;  // Interferers only
+
+    // Render state
+    const MorseTimeline* volatile timelineInUse = nullptr;
+    size_t elementIndex = 0;
+    uint32_t samplesLeft = 0;
+    uint32_t phase = 0;
+    uint32_t step = 0;
+    int32_t gain = 0;
+    uint32_t envelopePosition = 0;
+    bool keyed = false;
+  };
+
+  static constexpr size_t PRIMARY_VOICE = 0;
+  static constexpr size_t MAX_VOICES = 1 + MAX_INTERFERERS;
+
+  static uint32_t phaseIncrementFor(uint16_t frequencyHz);
+  static uint32_t envelopeStepFor(uint8_t milliseconds);
+  static uint32_t samplesFor(MorseTimeline::Element element, const Audio::MorseTimings& timings);
+
+  void latchTimeline(Voice& voice, const Audio::MorseTimings* timings);
+  void advanceTimeline(Voice& voice, const Audio::MorseTimings& timings);
+
+  static constexpr size_t SINE_TABLE_SIZE = 256;
+  static int16_t sineTable[SINE_TABLE_SIZE];
+
+  // Raised-cosine gain curve in Q15, indexed by the integer part of a Q16 position
+  static constexpr size_t ENVELOPE_TABLE_SIZE = 128;
+  static constexpr uint32_t ENVELOPE_FULL = (ENVELOPE_TABLE_SIZE - 1) << 16;
+  static constexpr uint8_t MIN_ENVELOPE_MS = 1;
+  static constexpr uint8_t MAX_ENVELOPE_MS = 20;
+  static int16_t envelopeTable[ENVELOPE_TABLE_SIZE];
+  static bool tablesReady;
+
+  // Posted parameters
+  volatile uint8_t masterLevel = 255;
+  volatile uint32_t envelopeStep = envelopeStepFor(Audio::MORSE_ENVELOPE_MS);
+  volatile uint8_t staticLevel = 0;
+  volatile uint8_t crackleChance = 0;
+  const Audio::MorseTimings* volatile keyingTimings = nullptr;
+
+  Voice voices[MAX_VOICES];
+
+  // Render state, only touched by render()
+  StaticNoise noise;
+  bool silent = true;
+};
+
+#endif
@@ -0,0 +1,220 @@
+#include "BenchRunner.h"
+
+#ifdef PERF_PROBES
+
+#include <cstdio>
+#include <vector>
+
+#include "AudioManager.h"
+#include "Config.h"
+#include "MorseCode.h"
+#include "PerfMonitor.h"
+#include "PotentiometerReader.h"
+#include "PowerManager.h"
+#include "StationManager.h"
+#include "StationStorage.h"
+#include "Version.h"
+#include "WiFiManager.h"
+
+namespace {
+const char BENCH_MESSAGE[] = "CQ CQ DE MORSE RADIO 73";
+
+// Scratch state for the cases, built in setup and released in teardown
+TuningPotReader* benchPot = nullptr;
+std::vector<Station>* loadedStations = nullptr;
+StringArena* loadedStrings = nullptr;
+}  // namespace
+
+class BenchCases {
+ public:
+  static void startMessage() {
+    MorseCode::getInstance().startMessage(BENCH_MESSAGE);
+    // Past the tune-in delay so update() keys elements
+    delay(MorseCode::TUNE_IN_DELAY + 1);
+  }
+
+  static void morseUpdate(uint32_t) { MorseCode::getInstance().update(); }
+
+  static void stopMessage() { MorseCode::getInstance().stop(); }
+
+  static void morseGetSymbol(uint32_t iteration) {
+    char c = BENCH_MESSAGE[iteration % (sizeof(BENCH_MESSAGE) - 1)];
+    String symbol = MorseCode::getInstance().getSymbol(c);
+    (void)symbol;
+  }
+
+  static void findClosestStation(uint32_t iteration) {
+    static const WaveBand BANDS[] = {WaveBand::LONG_WAVE, WaveBand::MEDIUM_WAVE,
+                                     WaveBand::SHORT_WAVE};
+    int signalStrength = 0;
+    int tuningValue = static_cast<int>((iteration * 37) % (Radio::ADC_MAX + 1));
+    StationManager::getInstance().findClosestStation(tuningValue, BANDS[iteration % 3],
+                                                     signalStrength);
+  }
+
+  static void createPot() {
+    benchPot = new TuningPotReader(Pins::TUNING_POT);
+    benchPot->begin(Radio::ADC_MAX / 2);
+  }
+
+  static void potRead(uint32_t iteration) {
+    // The DMA sampler owns the ADC while it runs, so feed the chain a sample instead
+    if (PowerManager::getInstance().arePotsSampled()) {
+      benchPot->push(Radio::ADC_MAX / 2 + static_cast<int>(iteration % 16));
+    } else {
+      benchPot->read();
+    }
+  }
+
+  static void deletePot() {
+    delete benchPot;
+    benchPot = nullptr;
+  }
+
+  static void startStatic() {
+    auto& audio = AudioManager::getInstance();
+    audio.setVolume(Radio::ADC_MAX);
+    audio.playStaticNoise(128);
+  }
+
+  // Every call is due, so each one times a pattern change rather than the interval check
+  static void updateStaticPattern(uint32_t) {
+    auto& audio = AudioManager::getInstance();
+    audio.lastStaticPatternUpdate = millis() - AudioManager::STATIC_PATTERN_CHANGE_INTERVAL;
+    audio.updateStaticPattern();
+  }
+
+  static void stopAudio() { AudioManager::getInstance().stop(); }
+
+  // The catalogue is unchanged, so repeated saves compare pages without writing flash
+  static void saveStations(uint32_t) {
+    StationStorage::getInstance().saveStations(StationManager::getInstance().getAllStations());
+  }
+
+  static void createScratch() {
+    loadedStations = new std::vector<Station>();
+    loadedStrings = new StringArena(Radio::STRING_ARENA_SIZE);
+  }
+
+  static void loadStations(uint32_t) {
+    loadedStrings->clear();
+    StationStorage::getInstance().loadStations(*loadedStations, *loadedStrings);
+  }
+
+  static void deleteScratch() {
+    delete loadedStations;
+    delete loadedStrings;
+    loadedStations = nullptr;
+    loadedStrings = nullptr;
+  }
+
+#ifndef NATIVE_TEST
+  // Streamed into a stream with no client, so only the formatting is timed
+  static void writeStationList(uint32_t) {
+    HtmlStream html;
+    WiFiManager::getInstance().writeStationList(html);
+  }
+#endif
+};
+
+namespace {
+const BenchRunner::Case CASES[] = {
+    {"MorseCode::update", 2000, &BenchCases::startMessage, &BenchCases::morseUpdate,
+     &BenchCases::stopMessage},
+    {"MorseCode::getSymbol", 2000, nullptr, &BenchCases::morseGetSymbol, nullptr},
+    {"StationManager::findClosestStation", 2000, nullptr, &BenchCases::findClosestStation,
+     nullptr},
+    {"PotentiometerReader::read", 2000, &BenchCases::createPot, &BenchCases::potRead,
+     &BenchCases::deletePot},
+    {"AudioManager::updateStaticPattern", 2000, &BenchCases::startStatic,
+     &BenchCases::updateStaticPattern, &BenchCases::stopAudio},
+    {"StationStorage::saveStations", 50, nullptr, &BenchCases::saveStations, nullptr},
+    {"StationStorage::loadStations", 50, &BenchCases::createScratch, &BenchCases::loadStations,
+     &BenchCases::deleteScratch},
+#ifndef NATIVE_TEST
+    {"WiFiManager::writeStationList", 20, nullptr, &BenchCases::writeStationList, nullptr},
+#endif
+};
+}  // namespace
+
+const BenchRunner::Case* BenchRunner::getCases(size_t& count) {
+  count = sizeof(CASES) / sizeof(CASES[0]);
+  return CASES;
+}
+
+BenchRunner::Result BenchRunner::measure(const Case& benchCase) {
+  if (benchCase.setup != nullptr) benchCase.setup();
+
+  uint64_t totalCycles = 0;
+  uint32_t minCycles = UINT32_MAX;
+  for (uint32_t i = 0; i < benchCase.iterations; i++) {
+    uint32_t start = PerfMonitor::cycles();
+    benchCase.run(i);
+    uint32_t cycles = PerfMonitor::cycles() - start;
+    totalCycles += cycles;
+    if (cycles < minCycles) minCycles = cycles;
+  }
+
+  if (benchCase.teardown != nullptr) benchCase.teardown();
+
+  Result result;
+  result.name = benchCase.name;
+  result.iterations = benchCase.iterations;
+  result.cyclesPerOp = benchCase.iterations > 0
+                           ? static_cast<double>(totalCycles) / benchCase.iterations
+                           : 0;
+  result.nsPerOp = result.cyclesPerOp * 1000.0 / getCpuFrequencyMhz();
+  result.minCycles = benchCase.iterations > 0 ? minCycles : 0;
+  return result;
+}
+
+size_t BenchRunner::writeJson(const Result& result, char* buffer, size_t size) {
+#ifdef NATIVE_TEST
+  const char* target = "host";
+#else
+  const char* target = "device";
+#endif
+  int written;
+  if (result.minCycles > 0) {
+    written = snprintf(buffer, size,
+                       "{\"bench\":\"%s\",\"target\":\"%s\",\"version\":\"%s\","
+                       "\"iterations\":%lu,\"nsPerOp\":%.1f,\"cyclesPerOp\":%.1f,"
+                       "\"minCycles\":%lu}",
+                       result.name, target, FIRMWARE_VERSION,
+                       static_cast<unsigned long>(result.iterations), result.nsPerOp,
+                       result.cyclesPerOp, static_cast<unsigned long>(result.minCycles));
+  } else {
+    written = snprintf(buffer, size,
+                       "{\"bench\":\"%s\",\"target\":\"%s\",\"version\":\"%s\","
+                       "\"iterations\":%lu,\"nsPerOp\":%.1f}",
+                       result.name, target, FIRMWARE_VERSION,
+                       static_cast<unsigned long>(result.iterations), result.nsPerOp);
+  }
+  return written > 0 && static_cast<size_t>(written) < size ? static_cast<size_t>(written) : 0;
+}
+
+#ifdef DEBUG_SERIAL_OUTPUT
+void BenchRunner::poll() {
+  bool requested = false;
+  while (Serial.available() > 0) {
+    if (Serial.read() == 'b') requested = true;
+  }
+  if (!requested) return;
+
+  Serial.println(F("BENCH_BEGIN"));
+  size_t count = 0;
+  const Case* cases = getCases(count);
+  char line[256];
+  for (size_t i = 0; i < count; i++) {
+    Result result = measure(cases[i]);
+    if (writeJson(result, line, sizeof(line)) > 0) {
+      Serial.print(F("BENCH_JSON "));
+      Serial.println(line);
+    }
+    delay(1);  // Let the idle task feed the watchdog between cases
+  }
+  Serial.println(F("BENCH_END"));
+}
+#endif
+
+#endif  // PERF_PROBES
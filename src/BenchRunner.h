@@ -0,0 +1,54 @@
+#ifndef BENCH_RUNNER_H
+#define BENCH_RUNNER_H
+
+#include <Arduino.h>
+
+/**
+ * Microbenchmarks of the radio's hot paths (only with PERF_PROBES defined).
+ *
+ * Each case times one call of a hot path. On the device, sending 'b' on the
+ * serial console of a debug build runs every case with the cycle counter
+ * around each call. The host bench env runs the same cases against the mocks
+ * with a wall clock (test_bench_hot_paths). Both print one JSON object per
+ * case, with the same names and the firmware version, so runs from two
+ * releases can be diffed line by line.
+ *
+ * The cases drive the live singletons, so the radio stops responding while a
+ * run is in progress and the current message restarts afterwards.
+ */
+class BenchRunner {
+ public:
+  struct Case {
+    const char* name;
+    uint32_t iterations;
+    void (*setup)();  // Untimed; may be nullptr
+    void (*run)(uint32_t iteration);
+    void (*teardown)();  // Untimed; may be nullptr
+  };
+
+  struct Result {
+    const char* name;
+    uint32_t iterations;
+    double nsPerOp;
+    double cyclesPerOp;  // 0 when timed with a wall clock
+    uint32_t minCycles;  // Fastest single call; 0 when timed with a wall clock
+  };
+
+  static const Case* getCases(size_t& count);
+
+  // Runs one case with the cycle counter
+  static Result measure(const Case& benchCase);
+
+  // One JSON object without a newline; returns the length, or 0 if it did not fit
+  static size_t writeJson(const Result& result, char* buffer, size_t size);
+
+#ifdef DEBUG_SERIAL_OUTPUT
+  // Runs every case when 'b' arrives on the serial console
+  static void poll();
+#endif
+
+ private:
+  BenchRunner() = delete;
+};
+
+#endif
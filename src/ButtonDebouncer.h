@@ -1,6 +1,7 @@
 #pragma once
 
 #include <Arduino.h>
+#include "InputScanner.h"
 
 /**
  * Button Debouncer Class
@@ -11,6 +12,11 @@
  * - Detects press events (HIGH to LOW transition)
  * - Prevents retriggering while button is held
  * - Configurable debounce time
+ *
+ * update() takes the level and the time of the pin's last edge from the
+ * InputScanner, so it must run after the loop's scan(). With edge interrupts
+ * those are the ISR's timestamps, so the debounce window is measured from the
+ * real last bounce rather than from whichever poll happened to see it.
  */
 class ButtonDebouncer {
  public:
@@ -18,40 +24,39 @@ class ButtonDebouncer {
       : pin_(pin),
         debounceMs_(debounceMs),
         activeLow_(activeLow),
-        lastReading_(HIGH),
         stableState_(HIGH),
-        lastDebounceTime_(0),
         wasPressed_(false) {}
 
   void begin() {
     pinMode(pin_, INPUT_PULLUP);
-    lastReading_ = digitalRead(pin_);
-    stableState_ = lastReading_;
-    lastDebounceTime_ = millis();
+    stableState_ = digitalRead(pin_);
   }
 
   /**
    * Update the debouncer state. Call this regularly in your loop.
    */
   void update() {
-    int currentReading = digitalRead(pin_);
-    unsigned long currentTime = millis();
+    auto& inputs = InputScanner::getInstance();
+    int currentReading = inputs.read(pin_);
 
-    // If the reading has changed, reset the debounce timer
-    if (currentReading != lastReading_) {
-      lastDebounceTime_ = currentTime;
-    }
-
-    // If the reading has been stable for longer than the debounce time,
-    // accept it as the new stable state
-    if ((currentTime - lastDebounceTime_) > debounceMs_) {
-      // Detect state change
-      if (currentReading != stableState_) {
-        stableState_ = currentReading;
-      }
+    // If no edge has arrived for longer than the debounce time,
+    // accept the reading as the new stable state
+    uint32_t sinceLastEdge = static_cast<uint32_t>(micros()) - inputs.getLastEdgeMicros(pin_);
+    if (sinceLastEdge > debounceMs_ * 1000UL) {
+      stableState_ = currentReading;
     }
+  }
 
-    lastReading_ = currentReading;
+  /**
+   * Milliseconds until update() can settle a pending change, so an idle
+   * loop knows when to come back. Timing::MAX_IDLE_INTERVAL if nothing is pending.
+   */
+  unsigned long msUntilSettled() const {
+    auto& inputs = InputScanner::getInstance();
+    if (inputs.read(pin_) == stableState_) return Timing::MAX_IDLE_INTERVAL;
+    uint32_t sinceLastEdge = static_cast<uint32_t>(micros()) - inputs.getLastEdgeMicros(pin_);
+    uint32_t windowMicros = debounceMs_ * 1000UL;
+    return sinceLastEdge > windowMicros ? 0 : (windowMicros - sinceLastEdge) / 1000 + 1;
   }
 
   /**
@@ -112,9 +117,7 @@ class ButtonDebouncer {
   const unsigned long debounceMs_;
   const bool activeLow_;
   
-  int lastReading_;
   int stableState_;
-  unsigned long lastDebounceTime_;
   bool wasPressed_;
 };
 
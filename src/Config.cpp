@@ -57,16 +57,44 @@ const char* toString(WaveBand band) {
 
 void ConfigManager::begin() { load(); }
 
-void ConfigManager::save() {
+bool ConfigManager::save(size_t* bytesWritten) {
+  if (bytesWritten != nullptr) *bytesWritten = 0;
+  SavedValues current = {static_cast<uint8_t>(morseSpeed), static_cast<uint8_t>(currentBand),
+                         morseFrequency, speakerVolume, inactivityTimeoutMinutes};
   if (!preferences.begin("config", false)) {
-    return;
+    return false;
+  }
+
+  size_t bytes = 0;
+  bool ok = true;
+  auto wrote = [&bytes, &ok](size_t count) {
+    bytes += count;
+    ok = ok && count > 0;
+  };
+  if (!savedValid || current.morseSpeed != saved.morseSpeed) {
+    wrote(preferences.putUChar("morseSpeed", current.morseSpeed));
+  }
+  if (!savedValid || current.waveBand != saved.waveBand) {
+    wrote(preferences.putUChar("waveBand", current.waveBand));
+  }
+  if (!savedValid || current.frequency != saved.frequency) {
+    wrote(preferences.putUInt("frequency", current.frequency));
+  }
+  if (!savedValid || current.volume != saved.volume) {
+    wrote(preferences.putUInt("volume", current.volume));
+  }
+  if (!savedValid || current.inactivityTimeout != saved.inactivityTimeout) {
+    wrote(preferences.putUInt("inactTimeout", current.inactivityTimeout));
   }
-  preferences.putUChar("morseSpeed", static_cast<uint8_t>(morseSpeed));
-  preferences.putUChar("waveBand", static_cast<uint8_t>(currentBand));
-  preferences.putUInt("frequency", morseFrequency);
-  preferences.putUInt("volume", speakerVolume);
-  preferences.putUInt("inactTimeout", inactivityTimeoutMinutes);
   preferences.end();
+
+  // After a failure the old values stay the reference, so the next save writes the change again
+  if (ok) {
+    saved = current;
+    savedValid = true;
+  }
+  if (bytesWritten != nullptr) *bytesWritten = bytes;
+  return ok;
 }
 
 void ConfigManager::load() {
@@ -81,6 +109,11 @@ void ConfigManager::load() {
   speakerVolume = preferences.getUInt("volume", Audio::DEFAULT_VOLUME);
   inactivityTimeoutMinutes = preferences.getUInt("inactTimeout", 120);
   preferences.end();
+
+  // Missing keys read back as their defaults, which is what an unwritten key means anyway
+  saved = {static_cast<uint8_t>(morseSpeed), static_cast<uint8_t>(currentBand), morseFrequency,
+           speakerVolume, inactivityTimeoutMinutes};
+  savedValid = true;
 }
 
 void ConfigManager::reset() {
@@ -90,8 +123,6 @@ void ConfigManager::reset() {
   speakerVolume = Audio::DEFAULT_VOLUME;
   inactivityTimeoutMinutes = 120;
   wifiEnabled = false;
-  morsePlaying = false;
-  morseToneOn = false;
   save();
 }
 
@@ -83,6 +83,13 @@ constexpr int MIN_STATIC_FREQ = 100;     // Minimum static noise frequency (Hz)
 constexpr int MAX_STATIC_FREQ = 300;     // Maximum static noise frequency (Hz)
 constexpr int DEFAULT_MORSE_FREQ = 800;  // Default morse code tone frequency (Hz)
 constexpr int DEFAULT_VOLUME = 64;       // Default volume level (0-255)
+constexpr int MORSE_ENVELOPE_MS = 5;     // Key attack/release of the sample engine (ms)
+
+// Static crackle model, shared by the LEDC pattern and the sample renderer
+constexpr int CRACKLE_ROLL_INTERVAL = 50;  // ms between chances of starting a crackle
+constexpr int MAX_CRACKLE_CHANCE = 7;      // % chance per roll at maximum static
+constexpr int CRACKLE_DURATION_MIN = 30;   // Minimum duration of a crackle (ms)
+constexpr int CRACKLE_DURATION_MAX = 80;   // Maximum duration of a crackle (ms)
 
 /**
  * Morse timing parameters structure
@@ -111,6 +118,11 @@ constexpr unsigned long DEBOUNCE_DELAY = 500;      // Button debounce delay (ms)
 constexpr unsigned long DEBUG_INTERVAL = 5000;     // Debug print interval (ms)
 constexpr unsigned long WIFI_TIMEOUT = 120000;     // WiFi auto-off timeout (2 minutes)
 constexpr unsigned long LED_FLASH_INTERVAL = 500;  // LED flash interval (ms)
+constexpr unsigned long PERSIST_QUIET_PERIOD = 2000;  // Idle time before edits are written (ms)
+constexpr unsigned long SYSTEM_UPDATE_INTERVAL = 10;  // Tick while anything still needs polling (ms)
+constexpr unsigned long MAX_IDLE_INTERVAL = 1000;     // Longest the loop sleeps with nothing due (ms)
+constexpr unsigned long POT_POLL_INTERVAL = 50;       // Polled pots at rest are read this often (ms)
+constexpr unsigned long POT_ACTIVE_WINDOW = 1000;     // Back on the system tick this long after a move (ms)
 }  // namespace Timing
 
 /**
@@ -120,6 +132,13 @@ constexpr unsigned long LED_FLASH_INTERVAL = 500;  // LED flash interval (ms)
 namespace Radio {
 constexpr int TUNING_LEEWAY = 50;  // Tuning tolerance range
 constexpr int ADC_MAX = 4095;      // Maximum ADC value (12-bit)
+
+// Station catalogue limits
+constexpr size_t STRING_ARENA_SIZE = 16384;  // Pool for station names and messages (bytes)
+constexpr size_t MAX_NAME_LENGTH = 32;       // Longest station name (characters)
+constexpr size_t MAX_MESSAGE_LENGTH = 140;   // Longest station message (characters)
+constexpr int MIN_TONE_FREQUENCY = 100;      // Lowest per-station morse tone (Hz)
+constexpr int MAX_TONE_FREQUENCY = 2000;     // Highest per-station morse tone (Hz)
 }  // namespace Radio
 
 /**
@@ -151,7 +170,8 @@ class ConfigManager {
 
   // Initialization and persistence
   void begin();
-  void save();
+  // Writes the settings that changed since the last successful save; false if any write failed
+  bool save(size_t* bytesWritten = nullptr);
   void load();
   void reset();
 
@@ -161,8 +181,6 @@ class ConfigManager {
   unsigned int getMorseFrequency() const { return morseFrequency; }
   unsigned int getSpeakerVolume() const { return speakerVolume; }
   bool isWifiEnabled() const { return wifiEnabled; }
-  bool isMorsePlaying() const { return morsePlaying; }
-  bool isMorseToneOn() const { return morseToneOn; }
   unsigned int getInactivityTimeout() const { return inactivityTimeoutMinutes; }
   const Audio::MorseTimings& getCurrentMorseTimings() const;
 
@@ -172,8 +190,6 @@ class ConfigManager {
   void setMorseFrequency(unsigned int freq);
   void setSpeakerVolume(unsigned int vol);
   void setWifiEnabled(bool enabled);
-  void setMorsePlaying(bool playing) { morsePlaying = playing; }
-  void setMorseToneOn(bool on) { morseToneOn = on; }
   void setInactivityTimeout(unsigned int minutes);
 
  private:
@@ -183,6 +199,17 @@ class ConfigManager {
 
   Preferences preferences;
 
+  // Values flash holds, so save() skips keys that have not changed
+  struct SavedValues {
+    uint8_t morseSpeed;
+    uint8_t waveBand;
+    unsigned int frequency;
+    unsigned int volume;
+    unsigned int inactivityTimeout;
+  };
+  SavedValues saved = {};
+  bool savedValid = false;
+
   // State variables
   MorseSpeed morseSpeed = MorseSpeed::MEDIUM;
   WaveBand currentBand = WaveBand::SHORT_WAVE;
@@ -190,8 +217,6 @@ class ConfigManager {
   unsigned int speakerVolume = Audio::DEFAULT_VOLUME;
   unsigned int inactivityTimeoutMinutes = 120;  // Default 120 minutes (2 hours)
   bool wifiEnabled = false;
-  bool morsePlaying = false;
-  bool morseToneOn = false;
 };
 
 #endif
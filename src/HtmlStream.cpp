@@ -0,0 +1,54 @@
+#include "HtmlStream.h"
+
+HtmlStream::HtmlStream(WebServer& server, const char* contentType) : server(&server) {
+  server.setContentLength(CONTENT_LENGTH_UNKNOWN);
+  server.send(200, contentType, "");
+}
+
+HtmlStream& HtmlStream::operator+=(const __FlashStringHelper* text) {
+  PGM_P flash = reinterpret_cast<PGM_P>(text);
+  write(flash, strlen_P(flash));
+  return *this;
+}
+
+HtmlStream& HtmlStream::operator+=(const char* text) {
+  write(text, strlen(text));
+  return *this;
+}
+
+void HtmlStream::sendFlash(PGM_P text) {
+  size_t length = strlen_P(text);
+  if (length <= CHUNK_SIZE - used) {
+    write(text, length);
+    return;
+  }
+  flush();
+  if (server != nullptr) server->sendContent_P(text, length);
+  bytesSent += length;
+}
+
+void HtmlStream::end() {
+  if (ended) return;
+  flush();
+  if (server != nullptr) server->sendContent("");  // Zero-length chunk ends the response
+  ended = true;
+}
+
+void HtmlStream::write(const char* data, size_t length) {
+  while (length > 0) {
+    size_t room = CHUNK_SIZE - used;
+    size_t take = length < room ? length : room;
+    memcpy_P(buffer + used, data, take);
+    used += take;
+    data += take;
+    length -= take;
+    if (used == CHUNK_SIZE) flush();
+  }
+}
+
+void HtmlStream::flush() {
+  if (used == 0) return;
+  if (server != nullptr) server->sendContent(buffer, used);
+  bytesSent += used;
+  used = 0;
+}
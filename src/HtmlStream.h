@@ -0,0 +1,54 @@
+#ifndef HTML_STREAM_H
+#define HTML_STREAM_H
+
+#include <Arduino.h>
+#include <WebServer.h>
+
+/**
+ * A web page sent as it is written, with chunked transfer encoding.
+ *
+ * Small pieces are gathered in a fixed buffer and go out as one chunk when it
+ * fills; large flash blocks are sent in place without a copy. Nothing the page
+ * writes is kept on the heap, so the memory a request needs does not grow with
+ * the station catalogue.
+ *
+ * Without a server the stream only counts bytes, which lets a page be timed
+ * with no client connected (see BenchRunner).
+ */
+class HtmlStream {
+ public:
+  // Starts the response; the status line and headers go out on the first chunk
+  HtmlStream(WebServer& server, const char* contentType);
+  HtmlStream() = default;
+  ~HtmlStream() { end(); }
+
+  HtmlStream& operator+=(const __FlashStringHelper* text);
+  HtmlStream& operator+=(const char* text);
+  HtmlStream& operator+=(const String& text) { return *this += text.c_str(); }
+
+  // A block in flash, sent as it is once anything buffered is out
+  void sendFlash(PGM_P text);
+
+  // Sends what is buffered and the closing empty chunk
+  void end();
+
+  size_t getBytesSent() const { return bytesSent; }
+
+ private:
+  HtmlStream(const HtmlStream&) = delete;
+  HtmlStream& operator=(const HtmlStream&) = delete;
+
+  void write(const char* data, size_t length);
+  void flush();
+
+  // One TCP segment's worth, so each chunk fills a packet
+  static constexpr size_t CHUNK_SIZE = 1024;
+
+  WebServer* server = nullptr;
+  char buffer[CHUNK_SIZE];
+  size_t used = 0;
+  size_t bytesSent = 0;
+  bool ended = false;
+};
+
+#endif
@@ -0,0 +1,98 @@
+#include "InputScanner.h"
+#include "LoopWaker.h"
+#include <soc/gpio_reg.h>
+
+uint64_t IRAM_ATTR InputScanner::readInputs() {
+  uint64_t inputs = REG_READ(GPIO_IN_REG);
+  // Folded away at compile time while every input sits on GPIO0-31
+  if ((INPUT_MASK >> 32) != 0) {
+    inputs |= static_cast<uint64_t>(REG_READ(GPIO_IN1_REG)) << 32;
+  }
+  return inputs & INPUT_MASK;
+}
+
+void IRAM_ATTR InputScanner::onEdge(void* arg) {
+  InputScanner* scanner = static_cast<InputScanner*>(arg);
+  Edge edge = {readInputs(), static_cast<uint32_t>(micros())};
+  if (!scanner->edges.push(edge)) {
+    scanner->edgeOverflow = true;
+  }
+  scanner->waker->wakeFromISR();
+}
+
+void InputScanner::begin() {
+  levels = readInputs();
+  changed = 0;
+  scans++;
+#ifdef INPUT_EDGE_INTERRUPTS
+  enableEdgeInterrupts();
+#endif
+}
+
+bool InputScanner::enableEdgeInterrupts() {
+  if (interruptDriven) return true;
+
+  // Anything already queued predates this snapshot
+  Edge stale;
+  while (edges.pop(stale)) {
+  }
+  edgeOverflow = false;
+  waker = &LoopWaker::getInstance();
+
+  interruptDriven = true;
+  for (int pin = 0; pin < static_cast<int>(MAX_INPUT_PINS); pin++) {
+    if (INPUT_MASK & bit(pin)) {
+      attachInterruptArg(digitalPinToInterrupt(pin), InputScanner::onEdge, this, CHANGE);
+    }
+  }
+  // An edge between the last read and the attach would otherwise go unseen
+  levels = readInputs();
+  return true;
+}
+
+void InputScanner::end() {
+  if (!interruptDriven) return;
+  for (int pin = 0; pin < static_cast<int>(MAX_INPUT_PINS); pin++) {
+    if (INPUT_MASK & bit(pin)) {
+      detachInterrupt(digitalPinToInterrupt(pin));
+    }
+  }
+  interruptDriven = false;
+}
+
+void InputScanner::recordEdges(uint64_t from, uint64_t to, uint32_t timestamp) {
+  uint64_t moved = from ^ to;
+  while (moved != 0) {
+    edgeMicros[__builtin_ctzll(moved)] = timestamp;
+    moved &= moved - 1;
+    edgeCount++;
+  }
+}
+
+void InputScanner::scan() {
+  uint64_t previous = levels;
+  uint64_t current = levels;
+
+  if (interruptDriven) {
+    // Replay the edges in order so every pin keeps its own last-edge time
+    Edge edge;
+    while (edges.pop(edge)) {
+      recordEdges(current, edge.levels, edge.micros);
+      current = edge.levels;
+    }
+    if (edgeOverflow) {
+      // Edges were dropped, so the register is the only truth left
+      edgeOverflow = false;
+      uint64_t actual = readInputs();
+      recordEdges(current, actual, micros());
+      current = actual;
+    }
+  } else {
+    current = readInputs();
+    recordEdges(previous, current, micros());
+  }
+
+  levels = current;
+  changed = current ^ previous;
+  scans++;
+}
@@ -0,0 +1,97 @@
+#ifndef INPUT_SCANNER_H
+#define INPUT_SCANNER_H
+
+#include <Arduino.h>
+#include "Config.h"
+#include "SpscQueue.h"
+
+class LoopWaker;
+
+/**
+ * One snapshot of every switch and button per loop pass.
+ *
+ * scan() reads the GPIO input register once (GPIO_IN_REG covers GPIO0-31,
+ * which holds all of the radio's inputs; GPIO_IN1_REG is only read if an
+ * input pin above 31 is ever added). The power switch check, band and speed
+ * switches, the WiFi button debouncer and activity detection all read from
+ * this snapshot instead of each calling digitalRead() on overlapping pins.
+ *
+ * With edge interrupts enabled, a GPIO ISR on every input takes the register
+ * snapshot and its timestamp at the moment of each edge. It pushes both into
+ * a lock-free SPSC queue, and scan() replays the queue instead of reading the
+ * pins. A pass with no edges then does no I/O at all. If the queue overflows
+ * during heavy contact bounce, the next scan() resyncs from the register.
+ * Each edge also wakes the main loop (LoopWaker) if it is idling.
+ *
+ * Bits are pin levels: set means HIGH, i.e. released for these active-low
+ * inputs. getChanged() holds the pins that changed at the last scan, and
+ * getLastEdgeMicros() when each pin last moved (the ISR's timestamp).
+ */
+class InputScanner {
+ public:
+  static InputScanner& getInstance() {
+    static InputScanner instance;
+    return instance;
+  }
+
+  static constexpr uint64_t bit(int pin) { return 1ULL << pin; }
+
+  // Every digital input the radio reads
+  static constexpr uint64_t INPUT_MASK =
+      (1ULL << Pins::POWER_SWITCH) | (1ULL << Pins::LW_BAND_SWITCH) |
+      (1ULL << Pins::MW_BAND_SWITCH) | (1ULL << Pins::SLOW_DECODE) | (1ULL << Pins::MED_DECODE) |
+      (1ULL << Pins::WIFI_BUTTON);
+
+  // Takes the first snapshot once the pins are configured; with INPUT_EDGE_INTERRUPTS
+  // defined it also attaches the edge interrupts
+  void begin();
+  bool enableEdgeInterrupts();
+  void end();   // Detaches the interrupts (before deep sleep reconfigures the pins)
+  void scan();  // Call once at the start of every loop pass
+
+  uint64_t getLevels() const { return levels; }
+  uint64_t getChanged() const { return changed; }
+  uint32_t getScanCount() const { return scans; }
+  uint32_t getEdgeCount() const { return edgeCount; }
+  bool isInterruptDriven() const { return interruptDriven; }
+  bool hasPendingEdges() const { return !edges.empty() || edgeOverflow; }
+
+  uint32_t getLastEdgeMicros(int pin) const { return edgeMicros[pin]; }
+
+  int read(int pin) const { return (levels & bit(pin)) ? HIGH : LOW; }  // digitalRead() stand-in
+  bool isLow(int pin) const { return (levels & bit(pin)) == 0; }
+  bool fell(int pin) const { return (changed & bit(pin)) && isLow(pin); }
+  bool rose(int pin) const { return (changed & bit(pin)) && !isLow(pin); }
+
+ private:
+  InputScanner() = default;
+  InputScanner(const InputScanner&) = delete;
+  InputScanner& operator=(const InputScanner&) = delete;
+
+  struct Edge {
+    uint64_t levels;
+    uint32_t micros;
+  };
+
+  static constexpr size_t EDGE_QUEUE_SIZE = 32;  // Enough for a bouncy switch between passes
+  static constexpr size_t MAX_INPUT_PINS = 64;
+
+  static uint64_t readInputs();
+  static void onEdge(void* arg);
+  void recordEdges(uint64_t from, uint64_t to, uint32_t timestamp);
+
+  uint64_t levels = INPUT_MASK;  // Pulled up (released) until the first scan
+  uint64_t changed = 0;
+  uint32_t scans = 0;
+  uint32_t edgeCount = 0;
+  uint32_t edgeMicros[MAX_INPUT_PINS] = {};
+
+  // Filled by onEdge(), drained by scan()
+  SpscQueue<Edge, EDGE_QUEUE_SIZE> edges;
+  volatile bool edgeOverflow = false;
+  // Resolved before the interrupts attach; getInstance()'s static guard is not ISR-safe
+  LoopWaker* waker = nullptr;
+  bool interruptDriven = false;
+};
+
+#endif
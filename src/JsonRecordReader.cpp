@@ -0,0 +1,132 @@
+#include "JsonRecordReader.h"
+
+#include <cstring>
+
+void JsonRecordReader::begin() {
+  used = 0;
+  buffer[0] = '\0';
+  keyLength = 0;
+  arrayLevels = 0;
+  depth = 0;
+  inString = false;
+  escaped = false;
+  inArray = false;
+  capturing = false;
+  overflow = false;
+  recordReady = false;
+  arrayFound = false;
+  complete = false;
+  malformed = false;
+  skipped = 0;
+}
+
+size_t JsonRecordReader::feed(const char* data, size_t length) {
+  recordReady = false;
+  size_t i = 0;
+  while (i < length) {
+    scan(data[i++]);
+    if (recordReady) break;
+  }
+  return i;
+}
+
+void JsonRecordReader::scan(char c) {
+  if (malformed) return;
+
+  if (capturing) {
+    if (used < CAPACITY) {
+      buffer[used++] = c;
+    } else {
+      overflow = true;
+    }
+  }
+
+  if (inString) {
+    if (escaped) {
+      escaped = false;
+    } else if (c == '\\') {
+      escaped = true;
+    } else if (c == '"') {
+      inString = false;
+      return;
+    }
+    if (depth == 1) {
+      if (keyLength < KEY_CAPACITY) key[keyLength] = c;
+      keyLength++;
+    }
+    return;
+  }
+
+  bool whitespace = c == ' ' || c == '\t' || c == '\r' || c == '\n';
+  if (depth == 0 && !whitespace && (c != '{' || complete)) {
+    malformed = true;  // Anything but one object at the top level
+    return;
+  }
+
+  switch (c) {
+    case '"':
+      inString = true;
+      if (depth == 1) keyLength = 0;
+      break;
+    case '{':
+    case '[':
+      open(c);
+      break;
+    case '}':
+    case ']':
+      close(c);
+      break;
+    default:
+      break;
+  }
+}
+
+void JsonRecordReader::open(char c) {
+  if (depth == MAX_DEPTH) {
+    malformed = true;
+    return;
+  }
+  if (c == '[' && depth == 1 && keyMatches()) {
+    inArray = true;
+    arrayFound = true;
+  } else if (c == '{' && inArray && depth == 2) {
+    buffer[0] = c;
+    used = 1;
+    capturing = true;
+    overflow = false;
+  }
+  if (c == '[') {
+    arrayLevels |= 1UL << depth;
+  } else {
+    arrayLevels &= ~(1UL << depth);
+  }
+  depth++;
+}
+
+void JsonRecordReader::close(char c) {
+  bool array = depth > 0 && (arrayLevels & (1UL << (depth - 1))) != 0;
+  if (depth == 0 || array != (c == ']')) {
+    malformed = true;
+    return;
+  }
+  depth--;
+
+  if (capturing && depth == 2) {
+    capturing = false;
+    if (overflow) {
+      skipped++;
+    } else {
+      buffer[used] = '\0';
+      recordReady = true;
+    }
+  } else if (inArray && depth == 1) {
+    inArray = false;
+  } else if (depth == 0) {
+    complete = true;
+  }
+}
+
+bool JsonRecordReader::keyMatches() const {
+  size_t length = strlen(arrayKey);
+  return keyLength == length && length <= KEY_CAPACITY && memcmp(key, arrayKey, length) == 0;
+}
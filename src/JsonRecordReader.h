@@ -0,0 +1,72 @@
+#ifndef JSON_RECORD_READER_H
+#define JSON_RECORD_READER_H
+
+#include <Arduino.h>
+
+/**
+ * Picks the objects of one top-level array out of a JSON stream, one at a time.
+ *
+ * For a body like {"stations":[{...},{...}]} the bytes are fed in as they
+ * arrive; the reader follows nesting and strings, and copies only the array
+ * element being read into a fixed buffer. Once an element closes it is handed
+ * back whole, ready for deserializeJson, and the buffer is reused for the
+ * next. The payload as a whole is never held, so its size does not matter;
+ * an element longer than CAPACITY is skipped and counted.
+ *
+ * Only the structure is checked: brackets must pair up and close, and the top
+ * level must be a single object. Elements are parsed by the caller.
+ */
+class JsonRecordReader {
+ public:
+  // An exported station with the longest name and message, every character escaped
+  static constexpr size_t CAPACITY = 1280;
+
+  explicit JsonRecordReader(const char* arrayKey) : arrayKey(arrayKey) { begin(); }
+
+  void begin();
+
+  // Scans up to length bytes and returns how many were used. Stops right after an
+  // element closes, so the caller can take it before feeding the rest.
+  size_t feed(const char* data, size_t length);
+
+  bool hasRecord() const { return recordReady; }
+  const char* record() const { return buffer; }
+  size_t recordLength() const { return used; }
+
+  bool foundArray() const { return arrayFound; }
+  // The top-level object has closed and nothing malformed was seen
+  bool isComplete() const { return complete && !malformed; }
+  size_t getSkipped() const { return skipped; }
+
+ private:
+  JsonRecordReader(const JsonRecordReader&) = delete;
+  JsonRecordReader& operator=(const JsonRecordReader&) = delete;
+
+  void scan(char c);
+  void open(char c);
+  void close(char c);
+  bool keyMatches() const;
+
+  static constexpr uint8_t MAX_DEPTH = 32;  // One bit per level in arrayLevels
+  static constexpr size_t KEY_CAPACITY = 16;
+
+  const char* arrayKey;
+  char buffer[CAPACITY + 1];
+  size_t used;
+  char key[KEY_CAPACITY];  // Last string read at the top level: the key of what follows
+  size_t keyLength;
+  uint32_t arrayLevels;  // Bit n set when level n is an array
+  uint8_t depth;
+  bool inString;
+  bool escaped;
+  bool inArray;
+  bool capturing;
+  bool overflow;
+  bool recordReady;
+  bool arrayFound;
+  bool complete;
+  bool malformed;
+  size_t skipped;
+};
+
+#endif
@@ -0,0 +1,60 @@
+#include "LoopWaker.h"
+
+void LoopWaker::begin() {
+  loopTask = xTaskGetCurrentTaskHandle();
+
+#if defined(LIGHT_SLEEP_IDLE) && LIGHT_SLEEP_SUPPORTED
+  // Scale down between bursts of work and light sleep whenever no lock is held
+  esp_pm_config_t config = {};
+  config.max_freq_mhz = getCpuFrequencyMhz();
+  config.min_freq_mhz = 40;  // XTAL frequency
+  config.light_sleep_enable = true;
+  lightSleep = esp_pm_configure(&config) == ESP_OK;
+#endif
+
+#ifdef DEBUG_SERIAL_OUTPUT
+  Serial.println(lightSleep ? F("Idle: light sleep between deadlines")
+                            : F("Idle: blocking between deadlines"));
+#endif
+}
+
+void LoopWaker::wake() {
+  if (loopTask != nullptr) {
+    xTaskNotifyGive(loopTask);
+  }
+}
+
+void IRAM_ATTR LoopWaker::wakeFromISR() {
+  if (loopTask != nullptr) {
+    BaseType_t higherPriorityTaskWoken = pdFALSE;
+    vTaskNotifyGiveFromISR(loopTask, &higherPriorityTaskWoken);
+    portYIELD_FROM_ISR(higherPriorityTaskWoken);
+  }
+}
+
+void LoopWaker::setAwake(Holder holder, bool awake) {
+  uint8_t bit = static_cast<uint8_t>(holder);
+  if (awake) {
+    awakeHolders.fetch_or(bit);
+  } else {
+    awakeHolders.fetch_and(static_cast<uint8_t>(~bit));
+  }
+}
+
+bool LoopWaker::sleepFor(unsigned long ms) {
+  if (ms == 0) {
+    return false;
+  }
+
+  bool sleeping = canLightSleep();
+  unsigned long start = millis();
+  bool woken = ulTaskNotifyTake(pdTRUE, pdMS_TO_TICKS(ms)) != 0;
+  uint32_t slept = millis() - start;
+
+  stats.sleeps++;
+  stats.idleMillis += slept;
+  if (sleeping) stats.lightSleepMillis += slept;
+  if (slept > stats.longestSleep) stats.longestSleep = slept;
+  if (woken) stats.earlyWakes++;
+  return woken;
+}
@@ -0,0 +1,76 @@
+#ifndef LOOP_WAKER_H
+#define LOOP_WAKER_H
+
+#include <Arduino.h>
+#include <atomic>
+
+// esp_pm's chip-independent config and automatic light sleep need Arduino-ESP32 v3
+// built with power management; otherwise the loop still blocks, just without sleeping
+#if defined(ESP_ARDUINO_VERSION_MAJOR) && (ESP_ARDUINO_VERSION_MAJOR >= 3) && \
+    defined(CONFIG_PM_ENABLE) && defined(CONFIG_FREERTOS_USE_TICKLESS_IDLE)
+#define LIGHT_SLEEP_SUPPORTED 1
+#include <esp_pm.h>
+#else
+#define LIGHT_SLEEP_SUPPORTED 0
+#endif
+
+/**
+ * Lets the main loop block until its next deadline instead of spinning.
+ *
+ * The loop works out how long it can idle and calls sleepFor(). That blocks
+ * the loop task on a FreeRTOS task notification, so the idle task runs (and,
+ * with automatic light sleep enabled, the chip sleeps between ticks). Events
+ * the loop cannot predict call wake() or wakeFromISR() to end the wait early:
+ * input edges, a pot that settled on a new value, a keyer that finished.
+ *
+ * Drivers that must keep running (I2S audio, continuous ADC, WiFi) hold their
+ * own power management locks, so light sleep only happens when they are idle.
+ * They report that through setAwake(), and the stats count only waits with
+ * none of them holding a lock as light sleep.
+ */
+class LoopWaker {
+ public:
+  static LoopWaker& getInstance() {
+    static LoopWaker instance;
+    return instance;
+  }
+
+  struct Stats {
+    uint32_t sleeps = 0;          // sleepFor() calls that blocked
+    uint32_t earlyWakes = 0;      // Waits ended by wake() rather than the deadline
+    uint64_t idleMillis = 0;      // Time spent blocked
+    uint32_t longestSleep = 0;    // Longest single wait (ms)
+    uint64_t lightSleepMillis = 0;  // Blocked with light sleep enabled and no driver awake
+  };
+
+  // Drivers whose power management lock keeps the chip out of light sleep
+  enum class Holder : uint8_t { AUDIO = 0x01, ADC = 0x02, WIFI = 0x04 };
+
+  // Call from the loop task; with LIGHT_SLEEP_IDLE defined also enables light sleep
+  void begin();
+
+  void wake();
+  void wakeFromISR();
+
+  // Blocks the loop task for up to ms; returns true if woken before the deadline
+  bool sleepFor(unsigned long ms);
+
+  // Any task may call this as a driver takes or releases its lock
+  void setAwake(Holder holder, bool awake);
+
+  bool isLightSleepEnabled() const { return lightSleep; }
+  bool canLightSleep() const { return lightSleep && awakeHolders.load() == 0; }
+  const Stats& getStats() const { return stats; }
+
+ private:
+  LoopWaker() = default;
+  LoopWaker(const LoopWaker&) = delete;
+  LoopWaker& operator=(const LoopWaker&) = delete;
+
+  TaskHandle_t loopTask = nullptr;
+  bool lightSleep = false;
+  std::atomic<uint8_t> awakeHolders{0};
+  Stats stats;
+};
+
+#endif
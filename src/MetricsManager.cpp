@@ -5,6 +5,7 @@
 #include <WiFi.h>
 
 #include "OTAConfig.h"
+#include "PerfMonitor.h"
 #include "PowerManager.h"
 #include "Version.h"
 
@@ -325,6 +326,14 @@ bool MetricsManager::postMetrics(const char* trigger, bool ensureWiFiConnection)
   payload["lastSleepUsbPowered"] = lastSleepUsbPowered;
   payload["lastSleepBatteryPercent"] = lastSleepBatteryPercent;
 
+#ifdef PERF_PROBES
+  // Same report as /api/perf, embedded as-is
+  char perfJson[PerfMonitor::JSON_CAPACITY];
+  if (PerfMonitor::getInstance().writeJson(perfJson, sizeof(perfJson)) > 0) {
+    payload["perf"] = serialized(perfJson);
+  }
+#endif
+
   String body;
   serializeJson(payload, body);
   int statusCode = http.POST(body);
@@ -4,6 +4,9 @@
 #include <Arduino.h>
 #include "AudioManager.h"
 #include "Config.h"
+#include "MorseKeyer.h"
+#include "MorseTimeline.h"
+#include "RadioState.h"
 
 class MorseCode {
  public:
@@ -14,34 +17,41 @@ class MorseCode {
 
   void begin();
   void update();  // Call this in the main loop
+  unsigned long msUntilNextUpdate(unsigned long now) const;  // When update() next has work
   void startMessage(const String& message);
   void startMessage(const char* message);
   void stop();
 
   void setSpeed(MorseSpeed speed) { ConfigManager::getInstance().setMorseSpeed(speed); }
 
-  bool isPlaying() const { return ConfigManager::getInstance().isMorsePlaying(); }
+  bool isPlaying() const { return RadioState::getInstance().isMorsePlaying(); }
+
+  // Hardware-timed keying is used when available; disabling it falls back to tick polling
+  void setHardwareKeying(bool enabled);
+  bool isHardwareKeying() const { return hardwareKeying; }
 
  private:
+  friend class BenchCases;
+
   MorseCode() = default;
   MorseCode(const MorseCode&) = delete;
   MorseCode& operator=(const MorseCode&) = delete;
 
   String getSymbol(char c) const;
   void updateMorseLEDs(bool on);
+  void setKeyed(bool on, AudioManager& audio);
 
   // Helper methods to break down the update function
-  void handleTuneInDelay(unsigned long currentTime, ConfigManager& config, AudioManager& audio);
-  void handleWordSpace(unsigned long currentTime, const Audio::MorseTimings& timings,
-                       ConfigManager& config, AudioManager& audio);
-  void processSymbol(unsigned long currentTime, const Audio::MorseTimings& timings,
-                     ConfigManager& config, AudioManager& audio);
-
-  // Message state
-  String currentMessage;
-  size_t messageIndex = 0;  // Current character in message
-  size_t symbolIndex = 0;   // Current symbol in character
-  String currentMorseChar;  // Current character's morse code
+  void handleTuneInDelay(unsigned long currentTime, AudioManager& audio);
+  void advanceElement(unsigned long currentTime, AudioManager& audio);
+
+  // Message state, compiled once per message in startMessage()
+  MorseTimeline timeline;
+  size_t elementIndex = 0;  // Current element in the timeline (polled keying only)
+
+  // Keying backend
+  MorseKeyer keyer;
+  bool hardwareKeying = false;
 
   // Timing state
   unsigned long lastStateChange = 0;
@@ -50,7 +60,6 @@ class MorseCode {
 
   // Constants
   static constexpr unsigned long TUNE_IN_DELAY = 1000;  // 1 second delay before starting
-  static const char* const MORSE_PATTERNS[];
 };
 
 #endif
@@ -0,0 +1,129 @@
+#include "MorseKeyer.h"
+#include "AudioManager.h"
+#include "LoopWaker.h"
+#include "RadioState.h"
+
+bool MorseKeyer::begin() {
+  if (timer != nullptr) return true;
+
+  esp_timer_create_args_t timerConfig = {.callback = &MorseKeyer::onTimer,
+                                         .arg = this,
+                                         .dispatch_method = ESP_TIMER_TASK,
+                                         .name = "morse_keyer",
+                                         .skip_unhandled_events = false};
+  if (esp_timer_create(&timerConfig, &timer) != ESP_OK) {
+    timer = nullptr;
+    return false;
+  }
+  return true;
+}
+
+void MorseKeyer::start(const MorseTimeline& newTimeline) {
+  stop();
+  if (timer == nullptr || newTimeline.isEmpty()) return;
+
+  // Attach the speaker once; edges only change the duty from here on
+  AudioManager::getInstance().prepareMorseTone();
+
+  portENTER_CRITICAL(&lock);
+  timeline = &newTimeline;
+  elementIndex = 0;
+  nextEdgeUs = esp_timer_get_time();
+  running = true;
+  bool changed = enterCurrentElement();
+  int64_t edgeUs = nextEdgeUs;
+  portEXIT_CRITICAL(&lock);
+
+  if (changed) syncOutputs();
+  arm(edgeUs);
+}
+
+void MorseKeyer::stop() {
+  if (timer != nullptr) {
+    esp_timer_stop(timer);  // Fails harmlessly if the timer is not armed
+  }
+
+  portENTER_CRITICAL(&lock);
+  running = false;
+  bool changed = setKeyed(false);
+  portEXIT_CRITICAL(&lock);
+
+  if (changed) syncOutputs();
+}
+
+void MorseKeyer::onTimer(void* arg) { static_cast<MorseKeyer*>(arg)->advance(); }
+
+void MorseKeyer::advance() {
+  bool changed = false;
+  bool finished = false;
+  int64_t edgeUs = -1;
+  int64_t now = esp_timer_get_time();
+
+  portENTER_CRITICAL(&lock);
+  // stop() may have raced with a callback that was already dispatched
+  if (running) {
+    if (now < nextEdgeUs) {
+      // Armed for an edge of the previous message just before a restart: wait for this one
+      edgeUs = nextEdgeUs;
+    } else if (++elementIndex >= timeline->size()) {
+      changed = setKeyed(false);
+      running = false;
+      finished = true;
+    } else {
+      changed = enterCurrentElement();
+      edgeUs = nextEdgeUs;
+    }
+  }
+  portEXIT_CRITICAL(&lock);
+
+  if (changed) syncOutputs();
+  if (edgeUs >= 0) arm(edgeUs);
+
+  // The loop sleeps through the message and restarts it once woken here
+  if (finished) {
+    LoopWaker::getInstance().wake();
+  }
+}
+
+bool MorseKeyer::enterCurrentElement() {
+  MorseTimeline::Element element = timeline->at(elementIndex);
+  bool changed = setKeyed(MorseTimeline::isKeyed(element));
+
+  // Speed is read per element so the decode switches still apply mid-message
+  const auto& timings = ConfigManager::getInstance().getCurrentMorseTimings();
+  nextEdgeUs += static_cast<int64_t>(MorseTimeline::durationOf(element, timings)) * 1000;
+  return changed;
+}
+
+bool MorseKeyer::setKeyed(bool on) {
+  if (on == keyed) return false;
+  keyed = on;
+  keyChanges++;
+  return true;
+}
+
+void MorseKeyer::syncOutputs() {
+  // stop() on the loop task can change the state while the timer task is still driving the
+  // outputs for its edge. Whoever sees the state move under it goes round again, so the
+  // outputs always end on the latest state.
+  for (;;) {
+    portENTER_CRITICAL(&lock);
+    bool on = keyed;
+    uint32_t seen = keyChanges;
+    portEXIT_CRITICAL(&lock);
+
+    RadioState::getInstance().setMorseToneOn(on);
+    AudioManager::getInstance().gateMorseTone(on);
+    digitalWrite(Pins::MORSE_LEDS, on ? HIGH : LOW);
+
+    portENTER_CRITICAL(&lock);
+    bool settled = seen == keyChanges;
+    portEXIT_CRITICAL(&lock);
+    if (settled) return;
+  }
+}
+
+void MorseKeyer::arm(int64_t edgeUs) {
+  int64_t delayUs = edgeUs - esp_timer_get_time();
+  esp_timer_start_once(timer, delayUs > 0 ? static_cast<uint64_t>(delayUs) : 0);
+}
@@ -0,0 +1,49 @@
+#ifndef MORSE_KEYER_H
+#define MORSE_KEYER_H
+
+#include <Arduino.h>
+#include "MorseTimeline.h"
+#include "esp_timer.h"
+
+/**
+ * Hardware-timed keying backend.
+ *
+ * Plays a compiled MorseTimeline by arming a one-shot esp_timer for every
+ * keying edge, so edges land on time regardless of how late the 10 ms system
+ * tick runs. Edges are scheduled against the ideal start time of each element,
+ * so a late callback is caught up on the next edge instead of accumulating.
+ * The timer callback drives the morse LEDs and the speaker gate directly.
+ */
+class MorseKeyer {
+ public:
+  bool begin();  // Returns false if no timer is available (caller falls back to polling)
+  void start(const MorseTimeline& timeline);
+  void stop();
+
+  bool isAvailable() const { return timer != nullptr; }
+  bool isRunning() const { return running; }
+
+ private:
+  static void onTimer(void* arg);
+  void advance();
+
+  // Under the lock: state only. The outputs and the timer are driven after it is released,
+  // since GPIO, the audio gate and esp_timer all take locks of their own or notify tasks.
+  bool enterCurrentElement();
+  bool setKeyed(bool on);  // Returns true if the state changed
+
+  void syncOutputs();
+  void arm(int64_t edgeUs);
+
+  esp_timer_handle_t timer = nullptr;
+  portMUX_TYPE lock = portMUX_INITIALIZER_UNLOCKED;
+
+  const MorseTimeline* timeline = nullptr;
+  size_t elementIndex = 0;
+  int64_t nextEdgeUs = 0;
+  volatile bool running = false;
+  bool keyed = false;
+  uint32_t keyChanges = 0;  // Bumped with every change of keyed, so syncOutputs() sees races
+};
+
+#endif
@@ -0,0 +1,111 @@
+#include "MorseTimeline.h"
+
+// Morse code patterns stored in PROGMEM to save RAM
+static const char morse_A[] PROGMEM = ".-";
+static const char morse_B[] PROGMEM = "-...";
+static const char morse_C[] PROGMEM = "-.-.";
+static const char morse_D[] PROGMEM = "-..";
+static const char morse_E[] PROGMEM = ".";
+static const char morse_F[] PROGMEM = "..-.";
+static const char morse_G[] PROGMEM = "--.";
+static const char morse_H[] PROGMEM = "....";
+static const char morse_I[] PROGMEM = "..";
+static const char morse_J[] PROGMEM = ".---";
+static const char morse_K[] PROGMEM = "-.-";
+static const char morse_L[] PROGMEM = ".-..";
+static const char morse_M[] PROGMEM = "--";
+static const char morse_N[] PROGMEM = "-.";
+static const char morse_O[] PROGMEM = "---";
+static const char morse_P[] PROGMEM = ".--.";
+static const char morse_Q[] PROGMEM = "--.-";
+static const char morse_R[] PROGMEM = ".-.";
+static const char morse_S[] PROGMEM = "...";
+static const char morse_T[] PROGMEM = "-";
+static const char morse_U[] PROGMEM = "..-";
+static const char morse_V[] PROGMEM = "...-";
+static const char morse_W[] PROGMEM = ".--";
+static const char morse_X[] PROGMEM = "-..-";
+static const char morse_Y[] PROGMEM = "-.--";
+static const char morse_Z[] PROGMEM = "--..";
+static const char morse_0[] PROGMEM = "-----";
+static const char morse_1[] PROGMEM = ".----";
+static const char morse_2[] PROGMEM = "..---";
+static const char morse_3[] PROGMEM = "...--";
+static const char morse_4[] PROGMEM = "....-";
+static const char morse_5[] PROGMEM = ".....";
+static const char morse_6[] PROGMEM = "-....";
+static const char morse_7[] PROGMEM = "--...";
+static const char morse_8[] PROGMEM = "---..";
+static const char morse_9[] PROGMEM = "----.";
+
+const char* const MorseTimeline::MORSE_PATTERNS[] PROGMEM = {
+    morse_A, morse_B, morse_C, morse_D, morse_E, morse_F, morse_G, morse_H, morse_I,
+    morse_J, morse_K, morse_L, morse_M, morse_N, morse_O, morse_P, morse_Q, morse_R,
+    morse_S, morse_T, morse_U, morse_V, morse_W, morse_X, morse_Y, morse_Z,
+    morse_0, morse_1, morse_2, morse_3, morse_4, morse_5, morse_6, morse_7, morse_8, morse_9
+};
+
+void MorseTimeline::compile(const char* message) {
+  length = 0;
+  truncated = false;
+  if (message == nullptr) return;
+
+  for (const char* p = message; *p != '\0'; p++) {
+    if (*p == ' ') {
+      if (!append(Element::WORD_GAP)) return;
+      continue;
+    }
+
+    const char* pattern = getPattern(*p);
+    if (pattern == nullptr) continue;  // Unsupported characters are skipped
+
+    // Each symbol is followed by a gap, so a character needs twice its symbol count
+    size_t symbolCount = strlen_P(pattern);
+    if (length + symbolCount * 2 > MAX_ELEMENTS) {
+      truncated = true;
+      return;
+    }
+
+    for (size_t i = 0; i < symbolCount; i++) {
+      char symbol = static_cast<char>(pgm_read_byte(&pattern[i]));
+      append(symbol == '-' ? Element::DASH : Element::DOT);
+      append(i + 1 < symbolCount ? Element::SYMBOL_GAP : Element::LETTER_GAP);
+    }
+  }
+}
+
+bool MorseTimeline::append(Element element) {
+  if (length >= MAX_ELEMENTS) {
+    truncated = true;
+    return false;
+  }
+  elements[length++] = element;
+  return true;
+}
+
+unsigned long MorseTimeline::durationOf(Element element, const Audio::MorseTimings& timings) {
+  switch (element) {
+    case Element::DOT:
+      return timings.dotDuration;
+    case Element::DASH:
+      return timings.dashDuration;
+    case Element::SYMBOL_GAP:
+      return timings.symbolGap;
+    case Element::LETTER_GAP:
+      return timings.letterGap;
+    case Element::WORD_GAP:
+    default:
+      return timings.wordGap;
+  }
+}
+
+const char* MorseTimeline::getPattern(char c) {
+  c = toupper(c);
+  if (c >= 'A' && c <= 'Z') {
+    return (const char*)pgm_read_ptr(&MORSE_PATTERNS[c - 'A']);
+  }
+  if (c >= '0' && c <= '9') {
+    return (const char*)pgm_read_ptr(&MORSE_PATTERNS[26 + (c - '0')]);
+  }
+  return nullptr;
+}
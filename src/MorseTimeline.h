@@ -0,0 +1,49 @@
+#ifndef MORSE_TIMELINE_H
+#define MORSE_TIMELINE_H
+
+#include <Arduino.h>
+#include "Config.h"
+
+/**
+ * Precompiled keying timeline for a morse message.
+ *
+ * compile() walks the message once and flattens it into a run-length list of
+ * keyed (tone on) and unkeyed (tone off) elements. Elements store their kind
+ * rather than a duration in milliseconds so that a speed change from the
+ * decode switches still takes effect mid-message; durationOf() turns a kind
+ * into milliseconds using the current timing set.
+ */
+class MorseTimeline {
+ public:
+  enum class Element : uint8_t { DOT, DASH, SYMBOL_GAP, LETTER_GAP, WORD_GAP };
+
+  // Enough for ~140 characters of typical text (a digit is the worst case at 10 elements)
+  static constexpr size_t MAX_ELEMENTS = 1024;
+
+  void compile(const char* message);
+  void clear() { length = 0; }
+
+  size_t size() const { return length; }
+  bool isEmpty() const { return length == 0; }
+  Element at(size_t index) const { return elements[index]; }
+  bool wasTruncated() const { return truncated; }
+
+  static bool isKeyed(Element element) {
+    return element == Element::DOT || element == Element::DASH;
+  }
+  static unsigned long durationOf(Element element, const Audio::MorseTimings& timings);
+
+  // Dot/dash pattern for a character in PROGMEM, or nullptr if it has no morse representation
+  static const char* getPattern(char c);
+
+ private:
+  bool append(Element element);
+
+  Element elements[MAX_ELEMENTS];
+  size_t length = 0;
+  bool truncated = false;
+
+  static const char* const MORSE_PATTERNS[];
+};
+
+#endif
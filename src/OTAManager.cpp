@@ -1,6 +1,7 @@
 #include "OTAManager.h"
 #include "AudioManager.h"
 #include "MetricsManager.h"
+#include "PersistenceService.h"
 #include "PowerManager.h"
 
 void OTAManager::addWiFiCredentials(const char* ssid, const char* password) {
@@ -216,6 +217,9 @@ bool OTAManager::downloadAndInstall(const String& version) {
 
   setLEDState(LEDState::INSTALLING);
 
+  // The device reboots into the new image, so queued edits are written first
+  PersistenceService::getInstance().flush();
+
   // Begin OTA update
   if (!Update.begin(contentLength)) {
 #ifdef DEBUG_SERIAL_OUTPUT
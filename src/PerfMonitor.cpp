@@ -0,0 +1,119 @@
+#include "PerfMonitor.h"
+
+#ifdef PERF_PROBES
+
+#include <stdarg.h>
+#include <stdio.h>
+
+namespace {
+// Appends while there is room; once the buffer is full every later append is dropped
+void appendJson(char* buffer, size_t size, size_t& used, const char* format, ...) {
+  if (used >= size) return;
+  va_list args;
+  va_start(args, format);
+  int written = vsnprintf(buffer + used, size - used, format, args);
+  va_end(args);
+  used = written < 0 ? size : used + static_cast<size_t>(written);
+}
+}  // namespace
+
+const char* Perf::toString(Probe probe) {
+  switch (probe) {
+    case Probe::SYSTEM_UPDATE:
+      return "systemUpdate";
+    case Probe::TUNING:
+      return "tuning";
+    case Probe::PLAYBACK:
+      return "playback";
+    case Probe::WIFI_HANDLE:
+      return "wifiHandle";
+    case Probe::TICK_LATENESS:
+      return "tickLateness";
+    case Probe::WEB_REQUEST:
+      return "webRequest";
+    default:
+      return "unknown";
+  }
+}
+
+void PerfMonitor::Histogram::record(uint32_t sample) {
+  buckets[bucketFor(sample)]++;
+  count++;
+  totalCycles += sample;
+  lastCycles = sample;
+  if (sample > maxCycles) maxCycles = sample;
+}
+
+uint32_t PerfMonitor::Histogram::percentileCycles(uint8_t percent) const {
+  if (count == 0) return 0;
+
+  // Smallest bucket whose running total reaches the rank
+  uint64_t rank = (static_cast<uint64_t>(count) * percent + 99) / 100;
+  uint64_t seen = 0;
+  for (size_t i = 0; i < BUCKETS; i++) {
+    seen += buckets[i];
+    if (seen >= rank && seen > 0) {
+      uint32_t upper = i == 0 ? 0 : static_cast<uint32_t>((1ULL << i) - 1);
+      return upper < maxCycles ? upper : maxCycles;
+    }
+  }
+  return maxCycles;
+}
+
+void PerfMonitor::tickDue(Perf::Probe probe, unsigned long inMillis) {
+  size_t index = static_cast<size_t>(probe);
+  dueMicros[index] = micros() + inMillis * 1000UL;
+  dueArmed[index] = true;
+}
+
+void PerfMonitor::tickStarted(Perf::Probe probe) {
+  size_t index = static_cast<size_t>(probe);
+  if (!dueArmed[index]) return;
+  dueArmed[index] = false;
+
+  // A tick forced early by a wake is not a timer tick, so it is not counted as on time
+  long lateMicros = static_cast<long>(micros() - dueMicros[index]);
+  if (lateMicros < 0) return;
+  histograms[index].record(static_cast<uint32_t>(lateMicros) * getCpuFrequencyMhz());
+}
+
+void PerfMonitor::reset() {
+  for (size_t i = 0; i < static_cast<size_t>(Perf::Probe::COUNT); i++) {
+    histograms[i] = Histogram();
+    dueArmed[i] = false;
+  }
+}
+
+size_t PerfMonitor::writeJson(char* buffer, size_t size) const {
+  const uint32_t mhz = getCpuFrequencyMhz();
+  size_t used = 0;
+
+  appendJson(buffer, size, used, "{\"cpuMhz\":%lu,\"probes\":{", static_cast<unsigned long>(mhz));
+  for (size_t p = 0; p < static_cast<size_t>(Perf::Probe::COUNT); p++) {
+    const Histogram& h = histograms[p];
+    double meanUs = h.count > 0 ? double(h.totalCycles) / h.count / mhz : 0.0;
+
+    appendJson(buffer, size, used, "%s\"%s\":{\"count\":%lu,\"meanUs\":%.2f,", p > 0 ? "," : "",
+               Perf::toString(static_cast<Perf::Probe>(p)), static_cast<unsigned long>(h.count),
+               meanUs);
+    appendJson(buffer, size, used, "\"maxUs\":%.2f,\"lastUs\":%.2f,", double(h.maxCycles) / mhz,
+               double(h.lastCycles) / mhz);
+    appendJson(buffer, size, used, "\"p50Us\":%.2f,\"p99Us\":%.2f,\"buckets\":[",
+               double(h.percentileCycles(50)) / mhz, double(h.percentileCycles(99)) / mhz);
+
+    // Trailing empty buckets are left off
+    size_t last = Histogram::BUCKETS;
+    while (last > 0 && h.buckets[last - 1] == 0) last--;
+    for (size_t i = 0; i < last; i++) {
+      appendJson(buffer, size, used, "%s%lu", i > 0 ? "," : "",
+                 static_cast<unsigned long>(h.buckets[i]));
+    }
+    appendJson(buffer, size, used, "]}");
+  }
+  appendJson(buffer, size, used, "}}");
+
+  // A short buffer fails the whole write rather than return truncated JSON
+  return used < size ? used : 0;
+}
+
+#endif
@@ -0,0 +1,145 @@
+#ifndef PERF_MONITOR_H
+#define PERF_MONITOR_H
+
+#include <Arduino.h>
+
+// Arduino-ESP32 v2 (IDF 4.4) only has the Xtensa HAL name for the cycle counter
+#if defined(ESP_ARDUINO_VERSION_MAJOR) && (ESP_ARDUINO_VERSION_MAJOR < 3)
+#include <xtensa/hal.h>
+inline uint32_t esp_cpu_get_cycle_count() { return xthal_get_ccount(); }
+#else
+#include <esp_cpu.h>
+#endif
+
+/**
+ * Loop latency and jitter probes (only with PERF_PROBES defined).
+ *
+ * PERF_SCOPE(probe) times the rest of the enclosing block with the CPU cycle
+ * counter. PERF_TICK_DUE/PERF_TICK_START record how late a rescheduled task
+ * ran compared with when it was due. Each probe feeds a fixed-size log2
+ * histogram: bucket i counts samples of [2^(i-1), 2^i) cycles, bucket 0
+ * counts zero. Recording is a few adds and a count-leading-zeros, with no
+ * allocation and no locking.
+ *
+ * Every probe is recorded by one task only, and the cycle counter is per
+ * core, so a probe must start and stop on the same pinned task. Readers on
+ * other cores (/api/perf, the metrics upload) may see a sample half-added;
+ * that is fine for diagnostics.
+ *
+ * Without PERF_PROBES the macros expand to nothing and the monitor is not
+ * built.
+ */
+namespace Perf {
+enum class Probe : uint8_t {
+  SYSTEM_UPDATE,  // systemUpdateCallback() as a whole
+  TUNING,         // updateTuningAndStation()
+  PLAYBACK,       // AudioManager::handlePlayback()
+  WIFI_HANDLE,    // WiFiManager::handle() on the network task
+  TICK_LATENESS,  // How late tSystemUpdate ran after its deadline
+  WEB_REQUEST,    // One web route handler, from request parsed to response sent
+  COUNT
+};
+
+const char* toString(Probe probe);
+}  // namespace Perf
+
+class PerfMonitor {
+ public:
+  static PerfMonitor& getInstance() {
+    static PerfMonitor instance;
+    return instance;
+  }
+
+  struct Histogram {
+    static constexpr size_t BUCKETS = 32;
+
+    uint32_t buckets[BUCKETS] = {};
+    uint32_t count = 0;
+    uint32_t maxCycles = 0;
+    uint32_t lastCycles = 0;
+    uint64_t totalCycles = 0;
+
+    void record(uint32_t cycles);
+    // Upper edge of the bucket holding the given percentile, in cycles
+    uint32_t percentileCycles(uint8_t percent) const;
+
+    static size_t bucketFor(uint32_t cycles) {
+      size_t bucket = cycles == 0 ? 0 : 32 - __builtin_clz(cycles);
+      return bucket < BUCKETS ? bucket : BUCKETS - 1;
+    }
+  };
+
+  // writeJson's worst case: every probe with all buckets in use and every number at its
+  // widest. A count is at most 10 digits; a time is a 32-bit cycle count over at least
+  // 1 MHz, so at most 13 characters as %.2f.
+  static constexpr size_t JSON_NAME_CHARS = 12;   // Longest Perf::toString()
+  static constexpr size_t JSON_COUNT_CHARS = 10;  // uint32_t as %lu
+  static constexpr size_t JSON_TIME_CHARS = 13;   // uint32_t cycles / MHz as %.2f
+  static constexpr size_t JSON_PROBE_TEXT = 74;   // Keys, quotes and punctuation of one probe
+  static constexpr size_t JSON_PROBE_CHARS = JSON_PROBE_TEXT + JSON_NAME_CHARS +
+                                             JSON_COUNT_CHARS + 5 * JSON_TIME_CHARS +
+                                             Histogram::BUCKETS * (JSON_COUNT_CHARS + 1);
+  // {"cpuMhz":..,"probes":{ and }} plus the terminator
+  static constexpr size_t JSON_FRAME_CHARS = 21 + JSON_COUNT_CHARS + 2 + 1;
+  static constexpr size_t JSON_CAPACITY =
+      JSON_FRAME_CHARS + static_cast<size_t>(Perf::Probe::COUNT) * JSON_PROBE_CHARS;
+  // The report is built on the 8 KB stacks of the network and metrics upload tasks
+  static_assert(JSON_CAPACITY <= 4096, "Too many probes for a stack-allocated perf report");
+
+  static uint32_t cycles() { return esp_cpu_get_cycle_count(); }
+
+  void record(Perf::Probe probe, uint32_t cycles) {
+    histograms[static_cast<size_t>(probe)].record(cycles);
+  }
+
+  // Lateness is measured in wall time so light sleep and frequency scaling do not skew it
+  void tickDue(Perf::Probe probe, unsigned long inMillis);
+  void tickStarted(Perf::Probe probe);
+
+  const Histogram& get(Perf::Probe probe) const {
+    return histograms[static_cast<size_t>(probe)];
+  }
+  void reset();
+
+  // Writes {"cpuMhz":..,"probes":{..}}; returns the length, or 0 if it did not fit
+  size_t writeJson(char* buffer, size_t size) const;
+
+ private:
+  PerfMonitor() = default;
+  PerfMonitor(const PerfMonitor&) = delete;
+  PerfMonitor& operator=(const PerfMonitor&) = delete;
+
+  Histogram histograms[static_cast<size_t>(Perf::Probe::COUNT)];
+  unsigned long dueMicros[static_cast<size_t>(Perf::Probe::COUNT)] = {};
+  bool dueArmed[static_cast<size_t>(Perf::Probe::COUNT)] = {};
+};
+
+/**
+ * Records the cycles between construction and destruction.
+ */
+class ScopedPerfTimer {
+ public:
+  explicit ScopedPerfTimer(Perf::Probe probe) : probe(probe), start(PerfMonitor::cycles()) {}
+  ~ScopedPerfTimer() { PerfMonitor::getInstance().record(probe, PerfMonitor::cycles() - start); }
+
+ private:
+  ScopedPerfTimer(const ScopedPerfTimer&) = delete;
+  ScopedPerfTimer& operator=(const ScopedPerfTimer&) = delete;
+
+  const Perf::Probe probe;
+  const uint32_t start;
+};
+
+#ifdef PERF_PROBES
+#define PERF_CONCAT_INNER(a, b) a##b
+#define PERF_CONCAT(a, b) PERF_CONCAT_INNER(a, b)
+#define PERF_SCOPE(probe) ScopedPerfTimer PERF_CONCAT(perfScope, __LINE__)(probe)
+#define PERF_TICK_DUE(probe, inMillis) PerfMonitor::getInstance().tickDue((probe), (inMillis))
+#define PERF_TICK_START(probe) PerfMonitor::getInstance().tickStarted(probe)
+#else
+#define PERF_SCOPE(probe) ((void)0)
+#define PERF_TICK_DUE(probe, inMillis) ((void)0)
+#define PERF_TICK_START(probe) ((void)0)
+#endif
+
+#endif
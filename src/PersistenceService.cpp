@@ -0,0 +1,80 @@
+#include "PersistenceService.h"
+#include "StationManager.h"
+
+void PersistenceService::begin() {
+  std::lock_guard<std::mutex> guard(writeLock);
+  closed = false;
+}
+
+void PersistenceService::markDirty(Store store) {
+  // Time first, so a flush that sees the new bit also sees the quiet period restart
+  lastChangeTime.store(static_cast<uint32_t>(millis()));
+  pending.fetch_or(static_cast<uint8_t>(store));
+  stats.requests++;
+}
+
+void PersistenceService::update() {
+  uint32_t quiet = static_cast<uint32_t>(millis()) - lastChangeTime.load();
+  if (pending.load() != 0 && quiet >= Timing::PERSIST_QUIET_PERIOD) {
+    flush();
+  }
+}
+
+unsigned long PersistenceService::msUntilFlush(unsigned long now) const {
+  if (pending.load() == 0) return Timing::MAX_IDLE_INTERVAL;
+  uint32_t quiet = static_cast<uint32_t>(now) - lastChangeTime.load();
+  return quiet >= Timing::PERSIST_QUIET_PERIOD ? 0 : Timing::PERSIST_QUIET_PERIOD - quiet;
+}
+
+void PersistenceService::flush() {
+  std::lock_guard<std::mutex> guard(writeLock);
+  if (!closed) flushLocked();
+}
+
+void PersistenceService::flushAndClose() {
+  std::lock_guard<std::mutex> guard(writeLock);
+  if (!closed) flushLocked();
+  closed = true;
+}
+
+void PersistenceService::flushLocked() {
+  // Cleared first so an edit made while writing is picked up by the next flush
+  uint8_t stores = pending.exchange(0);
+  if (stores == 0) {
+    return;
+  }
+
+  unsigned long start = micros();
+  size_t bytes = 0;
+  size_t written = 0;
+  uint8_t failed = 0;
+  if (stores & static_cast<uint8_t>(Store::CONFIG)) {
+    if (!ConfigManager::getInstance().save(&written)) failed |= static_cast<uint8_t>(Store::CONFIG);
+    bytes += written;
+  }
+  if (stores & static_cast<uint8_t>(Store::STATIONS)) {
+    if (!StationManager::getInstance().flushPending(&written)) {
+      failed |= static_cast<uint8_t>(Store::STATIONS);
+    }
+    bytes += written;
+  }
+  uint32_t elapsed = micros() - start;
+
+  if (failed != 0) {
+    // Back in the pending set, written again once another quiet period has passed
+    lastChangeTime.store(static_cast<uint32_t>(millis()));
+    pending.fetch_or(failed);
+    stats.failures++;
+  } else {
+    stats.flushes++;
+  }
+  stats.bytesWritten += bytes;
+  stats.lastFlushMicros = elapsed;
+  stats.maxFlushMicros = elapsed > stats.maxFlushMicros ? elapsed : stats.maxFlushMicros;
+  stats.totalFlushMicros += elapsed;
+
+#ifdef DEBUG_SERIAL_OUTPUT
+  Serial.printf("Persisted %u bytes in %u us%s\n", static_cast<unsigned>(bytes),
+                static_cast<unsigned>(elapsed), failed != 0 ? ", will retry" : "");
+#endif
+}
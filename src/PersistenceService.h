@@ -0,0 +1,70 @@
+#ifndef PERSISTENCE_SERVICE_H
+#define PERSISTENCE_SERVICE_H
+
+#include <Arduino.h>
+#include <atomic>
+#include <mutex>
+#include "Config.h"
+
+/**
+ * Write-behind persistence for settings and the station catalogue.
+ *
+ * Edits only mark their store dirty; update() writes everything pending once
+ * no further edit has arrived for Timing::PERSIST_QUIET_PERIOD, so a burst of
+ * web requests or a settings page save turns into one batch of NVS writes and
+ * HTTP handlers never wait on flash. Paths that are about to lose RAM (deep
+ * sleep, OTA) call flush() to write immediately.
+ *
+ * update() runs on the network/UI task, which also makes the edits; flush()
+ * can also come from the real-time task on its way to deep sleep. The pending
+ * set is taken atomically so each store is written once, and writes hold a
+ * mutex so one task never returns while the other is still mid-write. A store
+ * whose write fails goes back into the pending set and is retried after
+ * another quiet period.
+ */
+class PersistenceService {
+ public:
+  static PersistenceService& getInstance() {
+    static PersistenceService instance;
+    return instance;
+  }
+
+  enum class Store : uint8_t { CONFIG = 0x01, STATIONS = 0x02 };
+
+  struct Stats {
+    uint32_t requests = 0;          // markDirty() calls, each a synchronous save before
+    uint32_t flushes = 0;           // Batches written in full
+    uint32_t failures = 0;          // Flushes that left a store to retry
+    uint32_t bytesWritten = 0;      // Payload bytes handed to NVS
+    uint32_t lastFlushMicros = 0;   // Time the most recent flush took
+    uint32_t maxFlushMicros = 0;    // Longest flush so far
+    uint64_t totalFlushMicros = 0;  // Sum over all flushes
+  };
+
+  void begin();                 // At boot; reopens after flushAndClose() on the host
+  void markDirty(Store store);  // Restarts the quiet period
+  void update();
+  void flush();
+  // Waits out any write in progress, writes what is pending and then ignores all further
+  // flushes, so nothing touches NVS while the chip goes to sleep
+  void flushAndClose();
+  unsigned long msUntilFlush(unsigned long now) const;  // When update() next writes
+
+  bool hasPending() const { return pending.load() != 0; }
+  const Stats& getStats() const { return stats; }
+
+ private:
+  PersistenceService() = default;
+  PersistenceService(const PersistenceService&) = delete;
+  PersistenceService& operator=(const PersistenceService&) = delete;
+
+  void flushLocked();
+
+  std::mutex writeLock;
+  bool closed = false;  // Guarded by writeLock
+  std::atomic<uint8_t> pending{0};
+  std::atomic<uint32_t> lastChangeTime{0};  // millis() of the last edit, from either core
+  Stats stats;
+};
+
+#endif
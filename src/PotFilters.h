@@ -0,0 +1,165 @@
+#pragma once
+
+#include <math.h>
+#include <stdint.h>
+
+/**
+ * Filter stages for the potentiometer readers, composed at compile time.
+ *
+ * Every stage has the same two members:
+ *   void reset(float value);                   // Settle the stage on a value
+ *   float apply(float sample, float dtSeconds);  // Filter one sample
+ *
+ * FilterChain<A, B, C> runs a sample through A, then B, then C. The chain is
+ * a plain template, so the calls inline and no stage costs a virtual call or
+ * an allocation. Parameters are template arguments in integer units, because
+ * C++11 does not allow float template arguments.
+ */
+namespace PotFilters {
+
+// Median of the last N samples; drops single-sample spikes without smearing edges
+template <int N>
+class MedianFilter {
+  static_assert(N > 0 && N % 2 == 1, "Median window must be odd");
+
+ public:
+  void reset(float value) {
+    for (int i = 0; i < N; i++) {
+      window_[i] = value;
+    }
+    index_ = 0;
+  }
+
+  float apply(float sample, float dtSeconds) {
+    (void)dtSeconds;
+    window_[index_] = sample;
+    index_ = (index_ + 1) % N;
+
+    // Insertion sort of a copy; N is tiny, so this beats anything cleverer
+    float sorted[N];
+    for (int i = 0; i < N; i++) {
+      float value = window_[i];
+      int j = i;
+      while (j > 0 && sorted[j - 1] > value) {
+        sorted[j] = sorted[j - 1];
+        j--;
+      }
+      sorted[j] = value;
+    }
+    return sorted[N / 2];
+  }
+
+ private:
+  float window_[N] = {};
+  int index_ = 0;
+};
+
+// Exponential moving average with a fixed weight of ALPHA_Q8 / 256 on the new sample
+template <int ALPHA_Q8>
+class EmaFilter {
+  static_assert(ALPHA_Q8 > 0 && ALPHA_Q8 <= 256, "EMA weight must be in (0, 256]");
+
+ public:
+  void reset(float value) { value_ = value; }
+
+  float apply(float sample, float dtSeconds) {
+    (void)dtSeconds;
+    value_ += (sample - value_) * (ALPHA_Q8 / 256.0f);
+    return value_;
+  }
+
+ private:
+  float value_ = 0.0f;
+};
+
+/**
+ * One-euro filter (Casiez et al.): a low-pass whose cutoff rises with speed.
+ * When the dial is still it sits at the minimum cutoff and removes jitter.
+ * During a sweep the cutoff rises by BETA times the speed, which removes the
+ * lag.
+ * MIN_CUTOFF_MILLIHZ and DCUTOFF_MILLIHZ are in mHz. BETA_MICRO is in
+ * millionths of a Hz per ADC count per second.
+ */
+template <int MIN_CUTOFF_MILLIHZ, int BETA_MICRO, int DCUTOFF_MILLIHZ = 1000>
+class OneEuroFilter {
+ public:
+  void reset(float value) {
+    value_ = value;
+    speed_ = 0.0f;
+  }
+
+  float apply(float sample, float dtSeconds) {
+    float speed = (sample - value_) / dtSeconds;
+    speed_ += (speed - speed_) * alpha(DCUTOFF_MILLIHZ / 1000.0f, dtSeconds);
+
+    float cutoff = MIN_CUTOFF_MILLIHZ / 1000.0f + BETA_MICRO / 1000000.0f * fabsf(speed_);
+    value_ += (sample - value_) * alpha(cutoff, dtSeconds);
+    return value_;
+  }
+
+ private:
+  // Smoothing factor of a one-pole low-pass at cutoffHz for this sample interval
+  static float alpha(float cutoffHz, float dtSeconds) {
+    float tau = 1.0f / (2.0f * 3.14159265f * cutoffHz);
+    return 1.0f / (1.0f + tau / dtSeconds);
+  }
+
+  float value_ = 0.0f;
+  float speed_ = 0.0f;
+};
+
+/**
+ * Holds the output until the input has moved more than THRESHOLD counts
+ * away, then jumps straight to the input. The smoothing stages before it
+ * remove the noise, so this only has to stop the last count or two flickering.
+ * It has no slew limit, so it adds no lag to a sweep.
+ */
+template <int THRESHOLD>
+class Hysteresis {
+ public:
+  void reset(float value) { held_ = value; }
+
+  float apply(float sample, float dtSeconds) {
+    (void)dtSeconds;
+    if (fabsf(sample - held_) > THRESHOLD) {
+      held_ = sample;
+    }
+    return held_;
+  }
+
+ private:
+  float held_ = 0.0f;
+};
+
+template <typename... Stages>
+class FilterChain;
+
+// The empty chain passes samples through
+template <>
+class FilterChain<> {
+ public:
+  void reset(float value) { (void)value; }
+  float apply(float sample, float dtSeconds) {
+    (void)dtSeconds;
+    return sample;
+  }
+};
+
+template <typename First, typename... Rest>
+class FilterChain<First, Rest...> {
+ public:
+  void reset(float value) {
+    first_.reset(value);
+    rest_.reset(value);
+  }
+
+  float apply(float sample, float dtSeconds) {
+    return rest_.apply(first_.apply(sample, dtSeconds), dtSeconds);
+  }
+
+ private:
+  First first_;
+  FilterChain<Rest...> rest_;
+};
+
+}  // namespace PotFilters
@@ -1,86 +1,88 @@
 #pragma once
 
+#include <Arduino.h>
+#include "PotFilters.h"
+
+/**
+ * Filtered reading of one potentiometer.
+ *
+ * StableChain produces read(): the value the radio acts on. It should end in a
+ * Hysteresis stage so the reading stays fixed while the pot is at rest.
+ * SmoothChain produces readRaw(): a display value that follows every small
+ * movement. The chains are compile-time FilterChain types, so each pot can
+ * have its own (see TuningPotReader/VolumePotReader below).
+ *
+ * The stages are timed from the sample timestamps, so the same chain behaves
+ * the same whether read() is polled from the loop or fed by the DMA sampler.
+ */
+template <typename StableChain, typename SmoothChain>
 class PotentiometerReader {
  public:
-  static constexpr int WINDOW_SIZE = 5;  // Size of moving average window
-
-  PotentiometerReader(int pin, int hysteresis = 10)
-      : pin_(pin),
-        hysteresis_(hysteresis),
-        lastStableValue_(0),
-        windowIndex_(0),
-        rawWindowIndex_(0) {
-    for (int i = 0; i < WINDOW_SIZE; i++) {
-      window_[i] = 0;
-      rawWindow_[i] = 0;
-    }
-  }
+  explicit PotentiometerReader(int pin) : pin_(pin) {}
 
-  void begin() {
-    // Initialize all window values with first reading
-    int initial = readRawDirect();
-    for (int i = 0; i < WINDOW_SIZE; i++) {
-      window_[i] = initial;
-      rawWindow_[i] = initial;
-    }
-    lastStableValue_ = initial;
-  }
+  void begin() { begin(readRawDirect()); }
 
-  // Get filtered reading with hysteresis and moving average
-  int read() {
-    // Add new reading to window
-    window_[windowIndex_] = readRawDirect();
-    windowIndex_ = (windowIndex_ + 1) % WINDOW_SIZE;
-
-    // Calculate moving average
-    long sum = 0;
-    for (int i = 0; i < WINDOW_SIZE; i++) {
-      sum += window_[i];
-    }
-    int currentValue = sum / WINDOW_SIZE;
-
-    // Apply hysteresis with adaptive threshold
-    int difference = currentValue - lastStableValue_;
-    int adaptiveThreshold = hysteresis_;
-
-    // Increase threshold for larger changes to prevent oscillation
-    if (abs(difference) > hysteresis_ * 2) {
-      adaptiveThreshold = hysteresis_ * 1.5;
-    }
-
-    // Only update if change exceeds threshold
-    if (abs(difference) > adaptiveThreshold) {
-      // Gradual change for smoother transitions
-      lastStableValue_ +=
-          (difference > 0) ? min(difference, hysteresis_ * 2) : max(difference, -hysteresis_ * 2);
-    }
-
-    return lastStableValue_;
+  // Settle both chains on a first reading
+  void begin(int initial, uint32_t nowMicros = micros()) {
+    stable_.reset(initial);
+    smooth_.reset(initial);
+    lastStable_ = initial;
+    stableMicros_ = nowMicros;
+    smoothMicros_ = nowMicros;
   }
 
-  // Get raw reading with moving average smoothing (no hysteresis)
-  int readRaw() {
-    // Add new reading to raw window
-    rawWindow_[rawWindowIndex_] = readRawDirect();
-    rawWindowIndex_ = (rawWindowIndex_ + 1) % WINDOW_SIZE;
-
-    // Calculate moving average
-    long sum = 0;
-    for (int i = 0; i < WINDOW_SIZE; i++) {
-      sum += rawWindow_[i];
-    }
-    return sum / WINDOW_SIZE;
-  }
+  // Get the reading through the stable chain
+  int read() { return push(readRawDirect()); }
+
+  // Get the reading through the smoothing chain (follows small movements)
+  int readRaw() { return pushRaw(readRawDirect()); }
 
   // Get direct reading without any filtering
   int readRawDirect() { return analogRead(pin_); }
 
+  // Same chains as read()/readRaw() for samples taken elsewhere (e.g. by the DMA sampler)
+  int push(int sample, uint32_t nowMicros = micros()) {
+    lastStable_ = lroundf(stable_.apply(sample, secondsSince(stableMicros_, nowMicros)));
+    return lastStable_;
+  }
+
+  int pushRaw(int sample, uint32_t nowMicros = micros()) {
+    return lroundf(smooth_.apply(sample, secondsSince(smoothMicros_, nowMicros)));
+  }
+
+  int getStable() const { return lastStable_; }
+  int getPin() const { return pin_; }
+
  private:
+  // Two reads in the same microsecond still need a usable interval
+  static constexpr uint32_t MIN_INTERVAL_MICROS = 100;
+
+  static float secondsSince(uint32_t& lastMicros, uint32_t nowMicros) {
+    uint32_t elapsed = nowMicros - lastMicros;
+    lastMicros = nowMicros;
+    return (elapsed > MIN_INTERVAL_MICROS ? elapsed : MIN_INTERVAL_MICROS) / 1000000.0f;
+  }
+
   const int pin_;
-  const int hysteresis_;
-  int lastStableValue_;
-  int window_[WINDOW_SIZE];
-  int windowIndex_;
-  int rawWindow_[WINDOW_SIZE];
-  int rawWindowIndex_;
+  StableChain stable_;
+  SmoothChain smooth_;
+  int lastStable_ = 0;
+  uint32_t stableMicros_ = 0;
+  uint32_t smoothMicros_ = 0;
 };
+
+namespace PotFilters {
+// Tuning: the median drops ADC spikes. The one-euro stage holds steady at 1 Hz
+// when the dial is still and opens up to ~20 Hz at a full-speed sweep. The
+// final hold stops the last count flickering across a station edge.
+using TuningChain = FilterChain<MedianFilter<3>, OneEuroFilter<1000, 5000>, Hysteresis<3>>;
+
+// Volume is only sampled every few hundred ms and needs no speed, just calm
+using VolumeChain = FilterChain<MedianFilter<3>, EmaFilter<64>, Hysteresis<8>>;
+
+// Display value for the web tuning view
+using SmoothChain = FilterChain<MedianFilter<3>, EmaFilter<128>>;
+}  // namespace PotFilters
+
+using TuningPotReader = PotentiometerReader<PotFilters::TuningChain, PotFilters::SmoothChain>;
+using VolumePotReader = PotentiometerReader<PotFilters::VolumeChain, PotFilters::SmoothChain>;
@@ -1,8 +1,10 @@
 #include "PowerManager.h"
+#include "InputScanner.h"
 #include "OTAConfig.h"
 #include "OTAManager.h"
 #include "PotentiometerReader.h"  // Include PotentiometerReader header
 #include "MetricsManager.h"
+#include "PersistenceService.h"
 #include "driver/gpio.h"
 #include "driver/rtc_io.h"
 
@@ -21,7 +23,20 @@
 static RTC_DATA_ATTR bool justWentToSleep = false;  // Flag to indicate we just went to sleep
 static RTC_DATA_ATTR bool rtcInitialized = false;   // Flag to track if RTC GPIO is initialized
 
-PowerManager::PowerManager() : tuningPot(Pins::TUNING_POT), volumePot(Pins::VOLUME_POT), ums3(new UMS3) {}
+// Inputs whose movement counts as user activity, in the order the reason is chosen
+static const struct {
+  int pin;
+  const char* name;
+} ACTIVITY_INPUTS[] = {{Pins::LW_BAND_SWITCH, "Long Wave Switch"},
+                       {Pins::MW_BAND_SWITCH, "Medium Wave Switch"},
+                       {Pins::SLOW_DECODE, "Slow Decode Switch"},
+                       {Pins::MED_DECODE, "Medium Decode Switch"},
+                       {Pins::WIFI_BUTTON, "WiFi Button"}};
+
+PowerManager::PowerManager()
+    : tuningPot(Pins::TUNING_POT),
+      volumePot(Pins::VOLUME_POT),
+      ums3(new UMS3) {}
 
 PowerManager::~PowerManager() {
   delete ums3;
@@ -63,10 +78,6 @@ void PowerManager::begin() {
   // Configure pins
   configurePins();
 
-  // Initialize potentiometers
-  tuningPot.begin();
-  volumePot.begin();
-
   ledcSetup(PWMChannels::POWER_LED, LEDConfig::PWM_FREQUENCY, LEDConfig::PWM_RESOLUTION);
   ledcAttachPin(Pins::POWER_LED, PWMChannels::POWER_LED);
 
@@ -268,11 +279,10 @@ void PowerManager::configurePins() {
 }
 
 void PowerManager::updatePinStates() {
-  lastLWState = digitalRead(Pins::LW_BAND_SWITCH) == LOW;
-  lastMWState = digitalRead(Pins::MW_BAND_SWITCH) == LOW;
-  lastSlowState = digitalRead(Pins::SLOW_DECODE) == LOW;
-  lastMedState = digitalRead(Pins::MED_DECODE) == LOW;
-  lastWiFiState = digitalRead(Pins::WIFI_BUTTON) == LOW;
+  // All input pins are configured by now, so the scanner can take its first snapshot
+  auto& inputs = InputScanner::getInstance();
+  inputs.begin();
+  lastInputLevels = inputs.getLevels();
 
   // Update LED states based on current mode
   WaveBand currentBand = ConfigManager::getInstance().getWaveBand();
@@ -289,48 +299,22 @@ bool PowerManager::checkForInputChanges() {
   }
   lastInputScan = now;
 
+  // One XOR against the last check finds every switch that moved since
+  uint64_t levels = InputScanner::getInstance().getLevels();
+  uint64_t moved = levels ^ lastInputLevels;
+  lastInputLevels = levels;
+
   bool activity = false;
   const char* activityReason = nullptr;
-
-  // Check digital inputs for state changes
-  bool currentLWState = digitalRead(Pins::LW_BAND_SWITCH) == LOW;
-  bool currentMWState = digitalRead(Pins::MW_BAND_SWITCH) == LOW;
-  bool currentSlowState = digitalRead(Pins::SLOW_DECODE) == LOW;
-  bool currentMedState = digitalRead(Pins::MED_DECODE) == LOW;
-  bool currentWiFiState = digitalRead(Pins::WIFI_BUTTON) == LOW;
-
-  if (currentLWState != lastLWState) {
-    activity = true;
-    activityReason = "Long Wave Switch";
-  }
-
-  if (currentMWState != lastMWState) {
-    activity = true;
-    activityReason = "Medium Wave Switch";
-  }
-
-  if (currentSlowState != lastSlowState) {
-    activity = true;
-    activityReason = "Slow Decode Switch";
-  }
-
-  if (currentMedState != lastMedState) {
-    activity = true;
-    activityReason = "Medium Decode Switch";
-  }
-
-  if (currentWiFiState != lastWiFiState) {
-    activity = true;
-    activityReason = "WiFi Button";
+  if (moved != 0) {
+    for (const auto& input : ACTIVITY_INPUTS) {
+      if (moved & InputScanner::bit(input.pin)) {
+        activity = true;
+        activityReason = input.name;
+      }
+    }
   }
 
-  // Update stored states
-  lastLWState = currentLWState;
-  lastMWState = currentMWState;
-  lastSlowState = currentSlowState;
-  lastMedState = currentMedState;
-  lastWiFiState = currentWiFiState;
-
   // Reset timer with reason if activity was detected
   if (activity && activityReason != nullptr) {
     resetActivityTimer(activityReason);
@@ -340,15 +324,46 @@ bool PowerManager::checkForInputChanges() {
 }
 
 int PowerManager::readADC(int pin) {
+#ifdef ADC_CONTINUOUS_SAMPLER
+  if (potSampler.isRunning() && potSampler.handles(pin)) {
+    return potSampler.getStable(pin);
+  }
+#endif
   if (pin == Pins::TUNING_POT) {
-    return tuningPot.read();
+    return trackPot(0, tuningPot.read());
   } else if (pin == Pins::VOLUME_POT) {
-    return volumePot.read();
+    return trackPot(1, volumePot.read());
   }
   return analogRead(pin);
 }
 
+// Notes when a polled pot was read and whether its stable value moved
+int PowerManager::trackPot(size_t index, int value) {
+  lastPotPoll = millis();
+  if (value != lastPotValues[index]) {
+    lastPotValues[index] = value;
+    lastPotMove = lastPotPoll;
+  }
+  return value;
+}
+
+unsigned long PowerManager::msUntilPotPoll(unsigned long now) const {
+  // The DMA sampler wakes the loop itself when a pot settles on a new value
+  if (arePotsSampled()) return Timing::MAX_IDLE_INTERVAL;
+
+  // A pot that just moved is likely still moving, so follow it on the system tick;
+  // at rest a coarser poll still catches the next turn within a fraction of a second
+  if (now - lastPotMove < Timing::POT_ACTIVE_WINDOW) return Timing::SYSTEM_UPDATE_INTERVAL;
+  unsigned long elapsed = now - lastPotPoll;
+  return elapsed >= Timing::POT_POLL_INTERVAL ? 0 : Timing::POT_POLL_INTERVAL - elapsed;
+}
+
 int PowerManager::readADCRaw(int pin) {
+#ifdef ADC_CONTINUOUS_SAMPLER
+  if (potSampler.isRunning() && potSampler.handles(pin)) {
+    return potSampler.getSmoothed(pin);
+  }
+#endif
   if (pin == Pins::TUNING_POT) {
     return tuningPot.readRaw();
   } else if (pin == Pins::VOLUME_POT) {
@@ -447,10 +462,18 @@ void PowerManager::displayBatteryLevel() {
 }
 
 void PowerManager::enterDeepSleep(SleepReason reason) {
+  // RAM does not survive deep sleep, so queued edits are written now. The network task may
+  // be mid-flush; this waits for it and keeps it from starting another before sleep.
+  PersistenceService::getInstance().flushAndClose();
+
   MetricsManager::getInstance().recordSleepEntry(static_cast<uint8_t>(reason), isUSBPowered(),
                                                  getBatteryPercent());
 
   stopLEDTask();
+#ifdef ADC_CONTINUOUS_SAMPLER
+  potSampler.end();
+#endif
+  InputScanner::getInstance().end();  // The wake source takes over the power switch pin
 
   // Prepare for sleep
   shutdownAllPins();
@@ -480,7 +503,7 @@ void PowerManager::enterDeepSleep(SleepReason reason) {
 }
 
 void PowerManager::checkPowerSwitch() {
-  bool switchPressed = (digitalRead(Pins::POWER_SWITCH) == LOW);
+  bool switchPressed = InputScanner::getInstance().isLow(Pins::POWER_SWITCH);
 
   // If momentary switch is pressed (connected to ground), go to sleep
   if (switchPressed) {
@@ -490,6 +513,13 @@ void PowerManager::checkPowerSwitch() {
 }
 
 void PowerManager::configureADC() {
+#ifdef ADC_CONTINUOUS_SAMPLER
+  // DMA sampling owns the pot pins when it starts; otherwise they are polled below
+  if (potSampler.begin()) {
+    return;
+  }
+#endif
+
   // Set ADC resolution to maximum
   analogReadResolution(12);
 
@@ -500,6 +530,10 @@ void PowerManager::configureADC() {
   // Set attenuation for the full voltage range (0-3.3V)
   analogSetPinAttenuation(Pins::TUNING_POT, ADC_11db);
   analogSetPinAttenuation(Pins::VOLUME_POT, ADC_11db);
+
+  // Initialize potentiometers
+  tuningPot.begin();
+  volumePot.begin();
 }
 
 void PowerManager::checkActivity() {
@@ -512,7 +546,7 @@ void PowerManager::checkActivity() {
   unsigned long inactivityTimeoutMs = ConfigManager::getInstance().getInactivityTimeout() * 60000UL;
   if (currentTime - lastActivityTime >= inactivityTimeoutMs) {
     // Only enter deep sleep if power switch is still ON
-    if (digitalRead(Pins::POWER_SWITCH) == HIGH) {
+    if (!InputScanner::getInstance().isLow(Pins::POWER_SWITCH)) {
 #ifndef DEBUG_SERIAL_OUTPUT
       // Enable deep sleep on inactivity for release builds only
 #ifdef DEBUG_SERIAL_OUTPUT
@@ -531,6 +565,14 @@ void PowerManager::checkActivity() {
   }
 }
 
+unsigned long PowerManager::msUntilInactivityTimeout() const {
+  unsigned long timeoutMs = ConfigManager::getInstance().getInactivityTimeout() * 60000UL;
+  unsigned long idle = millis() - lastActivityTime;
+  // Once past the timeout checkActivity() has already had its chance on this pass
+  if (idle >= timeoutMs) return Timing::MAX_IDLE_INTERVAL;
+  return min(timeoutMs - idle, Timing::MAX_IDLE_INTERVAL);
+}
+
 void PowerManager::resetActivityTimer(const char* reason) {
   lastActivityTime = millis();
   
@@ -550,7 +592,7 @@ void PowerManager::checkOTABootSequence() {
   }
 
   // Check if WiFi button is pressed
-  if (digitalRead(Pins::WIFI_BUTTON) == LOW) {
+  if (InputScanner::getInstance().isLow(Pins::WIFI_BUTTON)) {
     unsigned long currentTime = millis();
 
     // Debounce the button press
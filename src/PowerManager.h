@@ -4,6 +4,9 @@
 #include <Arduino.h>
 #include "Config.h"
 #include "MorseCode.h"
+#ifdef ADC_CONTINUOUS_SAMPLER
+#include "AdcSampler.h"
+#endif
 #include "PotentiometerReader.h"
 
 class UMS3;
@@ -27,6 +30,13 @@ class PowerManager {
   void checkActivity();
   bool checkForInputChanges();
   void resetActivityTimer(const char* reason = nullptr);
+  unsigned long msUntilInactivityTimeout() const;  // When checkActivity() next has work
+  unsigned long msUntilPotPoll(unsigned long now) const;  // When polled pots should be read again
+#ifdef ADC_CONTINUOUS_SAMPLER
+  bool arePotsSampled() const { return potSampler.isRunning(); }  // Sampler wakes the loop
+#else
+  bool arePotsSampled() const { return false; }
+#endif
   float getBatteryVoltage();
   float getBatteryPercent();  // Returns battery percentage using LiPo discharge curve
   bool isLowBattery();
@@ -85,16 +95,19 @@ class PowerManager {
   uint8_t currentBrightness = 0;
   unsigned long lastFlashUpdate = 0;
 
-  // Button states
-  bool lastLWState = false;
-  bool lastMWState = false;
-  bool lastSlowState = false;
-  bool lastMedState = false;
-  bool lastWiFiState = false;
-
-  // Potentiometer readers
-  PotentiometerReader tuningPot;
-  PotentiometerReader volumePot;
+  // Switch and button levels at the last activity check (InputScanner bits)
+  uint64_t lastInputLevels = 0;
+
+  // Potentiometer readers, polled with analogRead() unless the DMA sampler is running
+  TuningPotReader tuningPot;
+  VolumePotReader volumePot;
+  int lastPotValues[2] = {-1, -1};  // Tuning, volume: stable values at the last poll
+  unsigned long lastPotPoll = 0;
+  unsigned long lastPotMove = 0;
+  int trackPot(size_t index, int value);
+#ifdef ADC_CONTINUOUS_SAMPLER
+  AdcSampler potSampler{Pins::TUNING_POT, Pins::VOLUME_POT};
+#endif
 
   // Hardware instance
   UMS3* ums3 = nullptr;
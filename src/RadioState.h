@@ -0,0 +1,52 @@
+#ifndef RADIO_STATE_H
+#define RADIO_STATE_H
+
+#include <atomic>
+#include "Config.h"
+#include "Snapshot.h"
+
+/**
+ * Radio state shared between the real-time task and the network/UI task.
+ *
+ * The real-time task (keying, audio, tuning) is the only writer; the web
+ * server, status JSON and metrics only read. Single flags are atomics. The
+ * tuning result is several fields that belong together, so it is published
+ * as a Snapshot and always read as one consistent set.
+ */
+class RadioState {
+ public:
+  static RadioState& getInstance() {
+    static RadioState instance;
+    return instance;
+  }
+
+  struct Tuning {
+    int tuningValue = 0;          // Stable reading the radio tunes with
+    int displayValue = 0;         // Smoothed reading for the calibration view
+    int signalStrength = 0;       // Closest station, 0 when nothing is locked
+    int stationFrequency = -1;    // Tuning value of the closest station, -1 if none
+    WaveBand band = WaveBand::SHORT_WAVE;
+    unsigned long updatedAt = 0;  // millis() of the publish
+  };
+
+  // Keying flags; the keyer writes the tone from its timer callback
+  void setMorsePlaying(bool playing) { morsePlaying.store(playing, std::memory_order_release); }
+  void setMorseToneOn(bool on) { morseToneOn.store(on, std::memory_order_release); }
+  bool isMorsePlaying() const { return morsePlaying.load(std::memory_order_acquire); }
+  bool isMorseToneOn() const { return morseToneOn.load(std::memory_order_acquire); }
+
+  void publishTuning(const Tuning& value) { tuning.publish(value); }
+  Tuning getTuning() const { return tuning.read(); }
+  uint32_t getTuningVersion() const { return tuning.version(); }
+
+ private:
+  RadioState() = default;
+  RadioState(const RadioState&) = delete;
+  RadioState& operator=(const RadioState&) = delete;
+
+  std::atomic<bool> morsePlaying{false};
+  std::atomic<bool> morseToneOn{false};
+  Snapshot<Tuning> tuning;
+};
+
+#endif
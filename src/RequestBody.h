@@ -0,0 +1,47 @@
+#ifndef REQUEST_BODY_H
+#define REQUEST_BODY_H
+
+#include <Arduino.h>
+
+/**
+ * A POST body gathered piece by piece as the web server reads it off the socket.
+ *
+ * Left to itself the WebServer reads a whole body into a String before the
+ * handler runs, however large it is. Routes that take their body here get it
+ * in the server's read-sized pieces instead and keep at most CAPACITY bytes;
+ * a longer body is dropped as it arrives and only flagged, so it is answered
+ * with 413 without ever being held in memory.
+ */
+class RequestBody {
+ public:
+  // A new station (name, message, band, dial position, tone) with room for escapes
+  static constexpr size_t CAPACITY = 1024;
+
+  void begin() {
+    length = 0;
+    overflow = false;
+    data[0] = '\0';
+  }
+
+  void append(const uint8_t* bytes, size_t count) {
+    if (overflow) return;
+    if (count > CAPACITY - length) {
+      overflow = true;
+      return;
+    }
+    memcpy(data + length, bytes, count);
+    length += count;
+    data[length] = '\0';
+  }
+
+  const char* c_str() const { return data; }
+  size_t size() const { return length; }
+  bool isTooLarge() const { return overflow; }
+
+ private:
+  char data[CAPACITY + 1] = {};
+  size_t length = 0;
+  bool overflow = false;
+};
+
+#endif
@@ -0,0 +1,209 @@
+#include "SampleAudioEngine.h"
+#include "Config.h"
+#include "LoopWaker.h"
+
+#if SAMPLE_AUDIO_ENGINE_SUPPORTED
+
+namespace {
+constexpr uint32_t RENDER_TASK_STACK = 3072;
+constexpr UBaseType_t RENDER_TASK_PRIORITY = configMAX_PRIORITIES - 2;
+constexpr BaseType_t RENDER_TASK_CORE = 1;
+constexpr uint32_t WRITE_TIMEOUT_MS = 100;  // Bounds how long end() waits for the task
+constexpr i2s_port_t I2S_PORT = I2S_NUM_0;  // The only port with PDM TX on the S3
+}  // namespace
+
+bool SampleAudioEngine::begin() {
+  if (running) return true;
+
+  if (!openOutput()) {
+    return false;
+  }
+
+  renderer.silence();
+  parked = false;
+  running = true;
+  LoopWaker::getInstance().setAwake(LoopWaker::Holder::AUDIO, true);
+  BaseType_t taskResult =
+      xTaskCreatePinnedToCore(SampleAudioEngine::renderTaskEntry, "audio_render",
+                              RENDER_TASK_STACK, this, RENDER_TASK_PRIORITY, &renderTask,
+                              RENDER_TASK_CORE);
+  if (taskResult != pdPASS) {
+    running = false;
+    renderTask = nullptr;
+    end();
+    return false;
+  }
+
+  return true;
+}
+
+void SampleAudioEngine::end() {
+  running = false;
+  // The task notices within one write timeout, or at once if parked, and clears its handle
+  wake();
+  while (renderTask != nullptr) {
+    vTaskDelay(pdMS_TO_TICKS(1));
+  }
+
+  if (outputOpen) {
+    if (!parked) disableOutput();
+    closeOutput();
+  }
+  parked = false;
+  LoopWaker::getInstance().setAwake(LoopWaker::Holder::AUDIO, false);
+}
+
+void SampleAudioEngine::wake() {
+  // Not only when parked: the task may be about to park on a block rendered before the post
+  if (renderTask != nullptr) {
+    xTaskNotifyGive(renderTask);
+  }
+}
+
+void SampleAudioEngine::renderTaskEntry(void* parameter) {
+  SampleAudioEngine* engine = static_cast<SampleAudioEngine*>(parameter);
+  engine->renderLoop();
+  engine->renderTask = nullptr;
+  vTaskDelete(nullptr);
+}
+
+void SampleAudioEngine::renderLoop() {
+  size_t silentBlocks = 0;
+  while (running) {
+    renderer.render(block, BLOCK_SAMPLES);
+
+    if (!renderer.isSilent()) {
+      silentBlocks = 0;
+      if (parked) {
+        enableOutput();
+        parked = false;
+        LoopWaker::getInstance().setAwake(LoopWaker::Holder::AUDIO, true);
+      }
+    } else if (!parked && ++silentBlocks > DMA_BLOCKS) {
+      // The queue has played out the release, so the channel can go and the chip sleep
+      disableOutput();
+      parked = true;
+      LoopWaker::getInstance().setAwake(LoopWaker::Holder::AUDIO, false);
+    }
+
+    if (parked) {
+      // A wake() posted before this point is still pending, so no post is missed
+      ulTaskNotifyTake(pdTRUE, portMAX_DELAY);
+      continue;
+    }
+
+    // Blocks until a DMA descriptor frees up, which paces the loop at the sample rate
+    writeBlock();
+  }
+}
+
+#if SAMPLE_AUDIO_ENGINE_LEGACY_I2S
+
+bool SampleAudioEngine::openOutput() {
+  i2s_config_t config = {};
+  config.mode = static_cast<i2s_mode_t>(I2S_MODE_MASTER | I2S_MODE_TX | I2S_MODE_PDM);
+  config.sample_rate = AudioSynth::SAMPLE_RATE;
+  config.bits_per_sample = I2S_BITS_PER_SAMPLE_16BIT;
+  config.channel_format = I2S_CHANNEL_FMT_ONLY_LEFT;
+  config.communication_format = I2S_COMM_FORMAT_STAND_I2S;
+  config.dma_buf_count = DMA_BLOCKS;
+  config.dma_buf_len = BLOCK_SAMPLES;
+  config.tx_desc_auto_clear = true;  // Play silence rather than stale samples on underrun
+  if (i2s_driver_install(I2S_PORT, &config, 0, nullptr) != ESP_OK) {
+    return false;
+  }
+
+  i2s_pin_config_t pinConfig = {};
+  pinConfig.mck_io_num = I2S_PIN_NO_CHANGE;
+  pinConfig.bck_io_num = I2S_PIN_NO_CHANGE;
+  pinConfig.ws_io_num = I2S_PIN_NO_CHANGE;  // PDM clock; the speaker only needs the data line
+  pinConfig.data_out_num = Pins::SPEAKER;
+  pinConfig.data_in_num = I2S_PIN_NO_CHANGE;
+  if (i2s_set_pin(I2S_PORT, &pinConfig) != ESP_OK) {
+    i2s_driver_uninstall(I2S_PORT);
+    return false;
+  }
+
+  // Installing starts the driver, as i2s_channel_enable() does on the channel API
+  outputOpen = true;
+  return true;
+}
+
+void SampleAudioEngine::closeOutput() {
+  i2s_driver_uninstall(I2S_PORT);
+  outputOpen = false;
+}
+
+void SampleAudioEngine::enableOutput() { i2s_start(I2S_PORT); }
+
+void SampleAudioEngine::disableOutput() {
+  i2s_stop(I2S_PORT);
+  i2s_zero_dma_buffer(I2S_PORT);  // Restart on silence, not on the tail of the release
+}
+
+void SampleAudioEngine::writeBlock() {
+  size_t bytesWritten = 0;
+  i2s_write(I2S_PORT, block, sizeof(block), &bytesWritten, pdMS_TO_TICKS(WRITE_TIMEOUT_MS));
+}
+
+#else
+
+bool SampleAudioEngine::openOutput() {
+  i2s_chan_config_t channelConfig = I2S_CHANNEL_DEFAULT_CONFIG(I2S_PORT, I2S_ROLE_MASTER);
+  channelConfig.dma_desc_num = DMA_BLOCKS;
+  channelConfig.dma_frame_num = BLOCK_SAMPLES;
+  channelConfig.auto_clear = true;  // Play silence rather than stale samples on underrun
+  if (i2s_new_channel(&channelConfig, &txChannel, nullptr) != ESP_OK) {
+    txChannel = nullptr;
+    return false;
+  }
+
+  i2s_pdm_tx_config_t pdmConfig = {};
+  pdmConfig.clk_cfg = I2S_PDM_TX_CLK_DEFAULT_CONFIG(AudioSynth::SAMPLE_RATE);
+  pdmConfig.slot_cfg =
+      I2S_PDM_TX_SLOT_DEFAULT_CONFIG(I2S_DATA_BIT_WIDTH_16BIT, I2S_SLOT_MODE_MONO);
+  pdmConfig.gpio_cfg.clk = I2S_GPIO_UNUSED;  // The speaker only needs the data line
+  pdmConfig.gpio_cfg.dout = static_cast<gpio_num_t>(Pins::SPEAKER);
+
+  if (i2s_channel_init_pdm_tx_mode(txChannel, &pdmConfig) != ESP_OK ||
+      i2s_channel_enable(txChannel) != ESP_OK) {
+    i2s_del_channel(txChannel);
+    txChannel = nullptr;
+    return false;
+  }
+
+  outputOpen = true;
+  return true;
+}
+
+void SampleAudioEngine::closeOutput() {
+  i2s_del_channel(txChannel);
+  txChannel = nullptr;
+  outputOpen = false;
+}
+
+void SampleAudioEngine::enableOutput() { i2s_channel_enable(txChannel); }
+
+void SampleAudioEngine::disableOutput() { i2s_channel_disable(txChannel); }
+
+void SampleAudioEngine::writeBlock() {
+  size_t bytesWritten = 0;
+  i2s_channel_write(txChannel, block, sizeof(block), &bytesWritten,
+                    pdMS_TO_TICKS(WRITE_TIMEOUT_MS));
+}
+
+#endif
+
+#else
+
+bool SampleAudioEngine::begin() { return false; }
+
+void SampleAudioEngine::end() { running = false; }
+
+void SampleAudioEngine::wake() {}
+
+void SampleAudioEngine::renderTaskEntry(void* parameter) { (void)parameter; }
+
+void SampleAudioEngine::renderLoop() {}
+
+#endif
@@ -0,0 +1,74 @@
+#ifndef SAMPLE_AUDIO_ENGINE_H
+#define SAMPLE_AUDIO_ENGINE_H
+
+#include <Arduino.h>
+#include "AudioSynth.h"
+
+// Arduino-ESP32 v3 (ESP-IDF 5) has the I2S channel API; v2 (ESP-IDF 4.4), which the stock
+// espressif32 platform still ships, only has the legacy driver. Both can do PDM TX on I2S0.
+#if defined(ESP_ARDUINO_VERSION_MAJOR) && (ESP_ARDUINO_VERSION_MAJOR >= 3)
+#define SAMPLE_AUDIO_ENGINE_SUPPORTED 1
+#define SAMPLE_AUDIO_ENGINE_LEGACY_I2S 0
+#include <driver/i2s_pdm.h>
+#elif defined(ESP_ARDUINO_VERSION_MAJOR)
+#define SAMPLE_AUDIO_ENGINE_SUPPORTED 1
+#define SAMPLE_AUDIO_ENGINE_LEGACY_I2S 1
+#include <driver/i2s.h>
+#else
+#define SAMPLE_AUDIO_ENGINE_SUPPORTED 0
+#endif
+
+/**
+ * I2S/DMA sample output for the speaker.
+ *
+ * Streams AudioSynth blocks out of the speaker pin as PDM through an I2S
+ * channel. A dedicated render task fills each block and then blocks in the
+ * DMA write, so the DMA queue paces the task and the main loop never touches
+ * the waveform: it only posts tone and static parameters to synth().
+ *
+ * Once the synth falls silent and the queued blocks have played out, the
+ * channel is disabled, which releases the I2S power-management lock, and the
+ * task parks until wake(). Callers wake it after posting anything that can
+ * make sound; a parked task renders one block to latch the new parameters and
+ * only re-enables the channel if that block is audible.
+ */
+class SampleAudioEngine {
+ public:
+  bool begin();  // Returns false if I2S is unavailable (caller keeps the LEDC path)
+  void end();
+
+  void wake();  // After posting a parameter that may end the silence
+
+  bool isRunning() const { return running; }
+  bool isParked() const { return parked; }
+  AudioSynth& synth() { return renderer; }
+
+ private:
+  static void renderTaskEntry(void* parameter);
+  void renderLoop();
+
+  // The I2S driver calls, one version per driver API
+  bool openOutput();
+  void closeOutput();
+  void enableOutput();
+  void disableOutput();  // Releases the driver's power management lock
+  void writeBlock();
+
+  static constexpr size_t BLOCK_SAMPLES = 64;  // 4 ms at 16 kHz: worst-case parameter latency
+  static constexpr size_t DMA_BLOCKS = 4;
+
+  AudioSynth renderer;
+  int16_t block[BLOCK_SAMPLES];
+  volatile bool running = false;
+  volatile bool parked = false;  // Channel disabled until a post makes the synth audible
+
+#if SAMPLE_AUDIO_ENGINE_SUPPORTED
+#if !SAMPLE_AUDIO_ENGINE_LEGACY_I2S
+  i2s_chan_handle_t txChannel = nullptr;
+#endif
+  bool outputOpen = false;
+  TaskHandle_t renderTask = nullptr;
+#endif
+};
+
+#endif
@@ -0,0 +1,49 @@
+#ifndef SNAPSHOT_H
+#define SNAPSHOT_H
+
+#include <atomic>
+#include <stdint.h>
+
+/**
+ * Lock-free single-writer snapshot of a small plain struct (a seqlock).
+ *
+ * The writer bumps the sequence to odd, copies the value in and bumps it back
+ * to even. A reader copies the value out and retries if the sequence was odd
+ * or moved while it copied, so it always gets one consistent publish and the
+ * writer never waits. The writer should not be preempted by a reader on the
+ * same core; here the writer is the real-time task on core 1 and the readers
+ * run on core 0.
+ */
+template <typename T>
+class Snapshot {
+ public:
+  void publish(const T& value) {
+    uint32_t sequence = sequence_.load(std::memory_order_relaxed);
+    sequence_.store(sequence + 1, std::memory_order_relaxed);
+    std::atomic_thread_fence(std::memory_order_release);
+    value_ = value;
+    sequence_.store(sequence + 2, std::memory_order_release);
+  }
+
+  T read() const {
+    T copy;
+    uint32_t before;
+    uint32_t after;
+    do {
+      before = sequence_.load(std::memory_order_acquire);
+      copy = value_;
+      std::atomic_thread_fence(std::memory_order_acquire);
+      after = sequence_.load(std::memory_order_relaxed);
+    } while ((before & 1) != 0 || before != after);
+    return copy;
+  }
+
+  // Number of publishes so far; readers compare it to skip unchanged snapshots
+  uint32_t version() const { return sequence_.load(std::memory_order_acquire) >> 1; }
+
+ private:
+  T value_{};
+  std::atomic<uint32_t> sequence_{0};
+};
+
+#endif
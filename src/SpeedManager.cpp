@@ -1,4 +1,5 @@
 #include "SpeedManager.h"
+#include "InputScanner.h"
 
 void SpeedManager::begin() {
   pinMode(Pins::SLOW_DECODE, INPUT_PULLUP);
@@ -7,14 +8,24 @@ void SpeedManager::begin() {
   // Setup PWM for decode speed control using dedicated channel
   ledcSetup(PWMChannels::DECODE, 5000, 8);  // 5kHz frequency, 8-bit resolution
   ledcAttachPin(Pins::DECODE_PWM, PWMChannels::DECODE);
+  switchesRead = false;
 }
 
 void SpeedManager::update() {
   auto& config = ConfigManager::getInstance();
 
-  // Read the decode speed switches
-  bool slowSwitch = (digitalRead(Pins::SLOW_DECODE) == LOW);
-  bool medSwitch = (digitalRead(Pins::MED_DECODE) == LOW);
+  // React only when a speed switch has moved since the last update
+  auto& inputs = InputScanner::getInstance();
+  uint64_t switches = inputs.getLevels() & SWITCH_MASK;
+  if (switchesRead && switches == lastSwitches) {
+    return;
+  }
+  lastSwitches = switches;
+  switchesRead = true;
+
+  // Read the decode speed switches from this pass's input snapshot
+  bool slowSwitch = inputs.isLow(Pins::SLOW_DECODE);
+  bool medSwitch = inputs.isLow(Pins::MED_DECODE);
 
   MorseSpeed targetSpeed = MorseSpeed::MEDIUM;
   int pwmDuty = 171;
@@ -17,6 +17,12 @@ class SpeedManager {
   SpeedManager() = default;
   SpeedManager(const SpeedManager&) = delete;
   SpeedManager& operator=(const SpeedManager&) = delete;
+
+  static constexpr uint64_t SWITCH_MASK =
+      (1ULL << Pins::SLOW_DECODE) | (1ULL << Pins::MED_DECODE);
+
+  uint64_t lastSwitches = 0;  // Speed switch levels the current speed was chosen from
+  bool switchesRead = false;
 };
 
 #endif
\ No newline at end of file
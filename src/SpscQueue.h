@@ -0,0 +1,55 @@
+#ifndef SPSC_QUEUE_H
+#define SPSC_QUEUE_H
+
+#include <atomic>
+#include <stddef.h>
+#include <stdint.h>
+
+/**
+ * Lock-free single-producer/single-consumer ring.
+ *
+ * One side (an ISR) only calls push(), the other (the main loop) only calls
+ * pop(). Each index is written by exactly one side and published with
+ * release/acquire ordering, so neither side needs a critical section and the
+ * ISR never waits. push() fails rather than overwrite when the ring is full.
+ *
+ * push() is forced inline: a template member is emitted in flash, so an IRAM
+ * ISR must not call it out of line (it would fault with the cache disabled).
+ */
+template <typename T, size_t CAPACITY>
+class SpscQueue {
+  static_assert(CAPACITY >= 2 && (CAPACITY & (CAPACITY - 1)) == 0,
+                "Capacity must be a power of two");
+
+ public:
+  inline __attribute__((always_inline)) bool push(const T& item) {
+    uint32_t head = head_.load(std::memory_order_relaxed);
+    if (head - tail_.load(std::memory_order_acquire) == CAPACITY) {
+      return false;
+    }
+    items_[head & (CAPACITY - 1)] = item;
+    head_.store(head + 1, std::memory_order_release);
+    return true;
+  }
+
+  bool pop(T& item) {
+    uint32_t tail = tail_.load(std::memory_order_relaxed);
+    if (head_.load(std::memory_order_acquire) == tail) {
+      return false;
+    }
+    item = items_[tail & (CAPACITY - 1)];
+    tail_.store(tail + 1, std::memory_order_release);
+    return true;
+  }
+
+  bool empty() const {
+    return head_.load(std::memory_order_acquire) == tail_.load(std::memory_order_acquire);
+  }
+
+ private:
+  T items_[CAPACITY];
+  std::atomic<uint32_t> head_{0};  // Written by the producer only
+  std::atomic<uint32_t> tail_{0};  // Written by the consumer only
+};
+
+#endif
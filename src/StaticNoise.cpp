@@ -0,0 +1,14 @@
+#include "StaticNoise.h"
+#include "AudioSynth.h"
+
+void StaticNoise::beginBlock(size_t samples, uint8_t crackleChance) {
+  samplesUntilRoll -= static_cast<int32_t>(samples);
+  if (samplesUntilRoll > 0) return;
+
+  samplesUntilRoll += AudioSynth::SAMPLE_RATE * Audio::CRACKLE_ROLL_INTERVAL / 1000;
+  if (crackleSamplesLeft > 0 || nextRandom() % 100 >= crackleChance) return;
+
+  uint32_t span = Audio::CRACKLE_DURATION_MAX - Audio::CRACKLE_DURATION_MIN;
+  uint32_t durationMs = Audio::CRACKLE_DURATION_MIN + nextRandom() % span;
+  crackleSamplesLeft = durationMs * AudioSynth::SAMPLE_RATE / 1000;
+}
@@ -0,0 +1,80 @@
+#ifndef STATIC_NOISE_H
+#define STATIC_NOISE_H
+
+#include <Arduino.h>
+#include "Config.h"
+
+/**
+ * Per-sample static generator for the sample audio path.
+ *
+ * A xorshift32 white noise source is band-limited to roughly 300 Hz-3 kHz
+ * by a one-pole high-pass and a one-pole low-pass, which sounds like an AM
+ * receiver's hiss rather than a buzzing square wave. Crackle keeps the
+ * LEDC model's chance and burst lengths (Audio::MAX_CRACKLE_CHANCE,
+ * Audio::CRACKLE_DURATION_*) but a burst is now a run of sparse decaying
+ * impulses layered on the hiss.
+ *
+ * next() is integer-only and inline so the renderer can call it per sample.
+ */
+class StaticNoise {
+ public:
+  static constexpr int32_t PEAK = 16383;  // Output stays within +/-PEAK
+
+  explicit StaticNoise(uint32_t seed = 0x9E3779B9u) : state(seed != 0 ? seed : 1) {}
+
+  // Rolls the crackle chance for the coming block; chance is % per CRACKLE_ROLL_INTERVAL
+  void beginBlock(size_t samples, uint8_t crackleChance);
+
+  bool isCrackling() const { return crackleSamplesLeft > 0; }
+
+  // Uniform in [low, high), like Arduino's random(low, high) without its libc call
+  int32_t between(int32_t low, int32_t high) {
+    if (high <= low) return low;
+    return low + static_cast<int32_t>(nextRandom() % static_cast<uint32_t>(high - low));
+  }
+
+  int32_t next() {
+    uint32_t random = nextRandom();
+
+    // Top 16 bits as white noise at half scale so the filter maths fits in 32 bits
+    int32_t white = static_cast<int16_t>(random >> 16) >> 1;
+    highPassState += ((white - highPassState) * HIGH_PASS_COEFFICIENT) >> 15;
+    lowPassState += ((white - highPassState - lowPassState) * LOW_PASS_COEFFICIENT) >> 15;
+    int32_t sample = lowPassState;
+
+    if (crackleSamplesLeft > 0) {
+      crackleSamplesLeft--;
+      // Low bits pick sparse impulses, bit 7 their polarity
+      if ((random & CRACKLE_DENSITY_MASK) == 0) {
+        int32_t amplitude = PEAK - static_cast<int32_t>((random >> 8) & 0x1FFF);
+        crackle = (random & 0x80) ? amplitude : -amplitude;
+      }
+    }
+    crackle -= crackle >> 2;  // Each impulse rings down in well under a millisecond
+    sample += crackle;
+
+    return sample > PEAK ? PEAK : (sample < -PEAK ? -PEAK : sample);
+  }
+
+ private:
+  uint32_t nextRandom() {
+    state ^= state << 13;
+    state ^= state >> 17;
+    state ^= state << 5;
+    return state;
+  }
+
+  // One-pole coefficients in Q15 for 16 kHz: 1 - exp(-2 * pi * fc / fs)
+  static constexpr int32_t HIGH_PASS_COEFFICIENT = 3637;  // ~300 Hz
+  static constexpr int32_t LOW_PASS_COEFFICIENT = 22679;  // ~3 kHz
+  static constexpr uint32_t CRACKLE_DENSITY_MASK = 0x7F;  // ~1 impulse per 128 samples
+
+  uint32_t state;
+  int32_t highPassState = 0;
+  int32_t lowPassState = 0;
+  int32_t crackle = 0;
+  uint32_t crackleSamplesLeft = 0;
+  int32_t samplesUntilRoll = 0;
+};
+
+#endif
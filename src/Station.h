@@ -4,21 +4,33 @@
 #include <Arduino.h>
 #include "Config.h"
 
+/**
+ * A station in the catalogue. Name and message are borrowed pointers, either
+ * to the PROGMEM defaults or into StationManager's string arena; only
+ * StationManager repoints them.
+ */
 class Station {
  public:
-  Station(const char* name, int frequency, WaveBand band, const String& message)
-      : name(name), frequency(frequency), band(band), message(message), enabled(true) {}
+  Station(const char* name, int frequency, WaveBand band, const char* message,
+          uint16_t toneFrequency = 0)
+      : name(name),
+        message(message),
+        frequency(frequency),
+        band(band),
+        toneFrequency(toneFrequency),
+        enabled(true) {}
 
   // Getters
   const char* getName() const { return name; }
   int getFrequency() const { return frequency; }
   WaveBand getBand() const { return band; }
-  String getMessage() const { return message; }
+  const char* getMessage() const { return message; }
+  uint16_t getToneFrequency() const { return toneFrequency; }  // 0 = receiver default
   bool isEnabled() const { return enabled; }
 
   // Setters
   void setFrequency(int newFreq) { frequency = newFreq; }
-  void setMessage(const String& newMsg) { message = newMsg; }
+  void setToneFrequency(uint16_t newTone) { toneFrequency = newTone; }
   void setEnabled(bool state) { enabled = state; }
 
   // Station tuning logic
@@ -26,10 +38,14 @@ class Station {
   bool isInRange(int tuningValue) const;
 
  private:
+  friend class StationManager;
+  friend class StationStorage;
+
   const char* name;
+  const char* message;
   int frequency;
   WaveBand band;
-  String message;
+  uint16_t toneFrequency;
   bool enabled;
 };
 
@@ -0,0 +1,110 @@
+#include "StationImport.h"
+#include <ArduinoJson.h>
+#include <cstring>
+#include "StationManager.h"
+
+void StationImport::begin(Mode newMode) {
+  reader.begin();
+  staged.clear();
+  mode = newMode;
+  rejected = 0;
+  failure = nullptr;
+  failedIndex = -1;
+}
+
+void StationImport::feed(const char* data, size_t length) {
+  while (length > 0) {
+    size_t consumed = reader.feed(data, length);
+    data += consumed;
+    length -= consumed;
+    if (reader.hasRecord()) {
+      stage(reader.record(), reader.recordLength());
+    }
+  }
+}
+
+void StationImport::fail(const char* reason, int index) {
+  if (mode == Mode::CONFIG) {
+    if (failure == nullptr) {
+      failure = reason;
+      failedIndex = index;
+    }
+  } else {
+    rejected++;
+  }
+}
+
+void StationImport::stage(const char* json, size_t length) {
+  // The first refused station decides a CONFIG batch, so nothing after it matters
+  if (failure != nullptr) return;
+
+  JsonDocument station;
+  if (deserializeJson(station, json, length)) {
+    fail("Invalid JSON format", -1);
+    return;
+  }
+
+  int index = station["index"] | -1;
+  const char* message = station["message"].as<const char*>();
+  Edit edit = {index, 0, -1, {}};
+
+  if (mode == Mode::CONFIG) {
+    edit.frequency = station["frequency"].as<int>();
+    edit.enabled = station["enabled"].as<bool>() ? 1 : 0;
+    if (edit.frequency <= 0) {
+      fail("Invalid frequency value for station ", index);
+      return;
+    }
+  } else if (station["enabled"].is<bool>()) {
+    edit.enabled = station["enabled"].as<bool>() ? 1 : 0;
+  }
+
+  if (index < 0 || StationManager::getInstance().getStation(index) == nullptr ||
+      message == nullptr) {
+    fail("Invalid station data for station ", index);
+    return;
+  }
+  if (strlen(message) > Radio::MAX_MESSAGE_LENGTH) {
+    fail("Message too long or storage full for station ", index);
+    return;
+  }
+  strcpy(edit.message, message);
+
+  for (Edit& existing : staged) {
+    if (existing.index == index) {
+      existing = edit;
+      return;
+    }
+  }
+  staged.push_back(edit);
+}
+
+StationImport::Result StationImport::apply() {
+  Result result;
+  result.complete = reader.isComplete();
+  result.foundArray = reader.foundArray();
+
+  if (result.complete && result.foundArray && failure == nullptr) {
+    auto& stationManager = StationManager::getInstance();
+    for (const Edit& edit : staged) {
+      // Only a full string arena refuses a message that passed staging
+      if (!stationManager.setStationMessage(edit.index, edit.message)) {
+        fail("Message too long or storage full for station ", edit.index);
+        if (mode == Mode::CONFIG) break;
+        continue;
+      }
+      Station* station = stationManager.getStation(edit.index);
+      if (edit.frequency > 0) station->setFrequency(edit.frequency);
+      if (edit.enabled >= 0) station->setEnabled(edit.enabled != 0);
+      result.applied++;
+    }
+    // Whatever changed is saved, so memory never holds edits flash does not
+    if (result.applied > 0) stationManager.saveToPreferences();
+  }
+
+  result.skipped = rejected + reader.getSkipped();
+  result.failure = failure;
+  result.failedIndex = failedIndex;
+  begin(mode);
+  return result;
+}
@@ -0,0 +1,62 @@
+#ifndef STATION_IMPORT_H
+#define STATION_IMPORT_H
+
+#include <Arduino.h>
+#include <vector>
+#include "Config.h"
+#include "JsonRecordReader.h"
+
+/**
+ * Station edits from a {"stations":[...]} POST body, applied only once the body is whole.
+ *
+ * feed() takes the body as the web server reads it. Each station is parsed
+ * and checked as its object closes, then staged: the catalogue is not
+ * touched. apply() makes the staged edits and saves them, but only if the
+ * body closed properly; a body that broke off (RAW_ABORTED, or one that
+ * simply stops) is dropped by begin() and leaves every station as it was.
+ *
+ * A station named twice keeps its last edit, so the staging never holds more
+ * entries than the catalogue has stations.
+ */
+class StationImport {
+ public:
+  enum class Mode : uint8_t {
+    MESSAGES,  // /api/messages: index and message, enabled optional; bad entries are skipped
+    CONFIG,    // /save: index, frequency, message and enabled; the first bad entry fails it all
+  };
+
+  struct Result {
+    bool complete = false;    // The body closed with nothing malformed
+    bool foundArray = false;  // It held a stations array
+    size_t applied = 0;       // Stations changed and saved
+    size_t skipped = 0;       // Entries rejected (MESSAGES) or too large to read
+    const char* failure = nullptr;  // CONFIG: why the batch was refused, or nullptr
+    int failedIndex = -1;           // CONFIG: the station that was refused, -1 if none
+  };
+
+  void begin(Mode mode);
+  void feed(const char* data, size_t length);
+
+  // Applies and saves what was staged if the body is complete, then begins again
+  Result apply();
+
+ private:
+  struct Edit {
+    int index;
+    int frequency;   // 0 keeps the station's
+    int8_t enabled;  // -1 keeps the station's
+    char message[Radio::MAX_MESSAGE_LENGTH + 1];
+  };
+
+  void stage(const char* json, size_t length);
+  void fail(const char* reason, int index);
+
+  JsonRecordReader reader{"stations"};
+  std::vector<Edit> staged;
+  Mode mode = Mode::MESSAGES;
+  size_t rejected = 0;
+  const char* failure = nullptr;
+  int failedIndex = -1;
+};
+
+#endif
@@ -1,4 +1,7 @@
 #include "StationManager.h"
+#include "PersistenceService.h"
+#include <algorithm>
+#include <cstring>
 
 void StationManager::begin() {
   SignalManager::getInstance().begin();
@@ -7,45 +10,77 @@ void StationManager::begin() {
   Serial.println("StationManager initialized");
 #endif
 
-  initializeDefaultStations();
   loadFromPreferences();
 }
 
 void StationManager::initializeDefaultStations() {
   stations.clear();
+  strings.clear();  // Defaults point into PROGMEM, so nothing in the arena is live any more
   stations.reserve(StationDefaults::STATION_COUNT);
 
   for (size_t i = 0; i < StationDefaults::STATION_COUNT; i++) {
     const auto& def = StationDefaults::STATIONS[i];
     stations.emplace_back(def.name, def.frequency, def.band, def.message);
   }
+
+  // The vector was rebuilt, so the index must not keep pointing into the old one
+  rebuildTuningIndex();
 }
 
 Station* StationManager::findClosestStation(int tuningValue, WaveBand band, int& signalStrength) {
-  Station* closestStation = nullptr;
-  int bestSignalStrength = 0;
+  StationCandidate best;
+  if (findStationCandidates(tuningValue, band, &best, 1) == 0) {
+    signalStrength = 0;
+    return nullptr;
+  }
 
-  // Iterate through all stations to find the closest one for the current band
-  for (auto& station : stations) {
-    // Skip stations that are not enabled or not on the current band
-    if (!station.isEnabled() || station.getBand() != band) {
+  signalStrength = best.signalStrength;
+  return best.station;
+}
+
+/**
+ * Collect the strongest stations audible at a tuning position in a single pass
+ *
+ * @param candidates Output array, filled strongest first
+ * @param maxCandidates Capacity of the output array
+ * @return Number of candidates written
+ */
+size_t StationManager::findStationCandidates(int tuningValue, WaveBand band,
+                                             StationCandidate* candidates,
+                                             size_t maxCandidates) {
+  const TuningIndex& index = tuningIndex[static_cast<size_t>(band)];
+  int low = constrain(tuningValue - Radio::TUNING_LEEWAY, 0, Radio::ADC_MAX);
+  size_t count = 0;
+
+  // Jump to the bucket holding the lowest frequency in range, then walk up the dial
+  for (size_t i = index.bucketStart[low >> TUNING_BUCKET_SHIFT]; i < index.stations.size(); i++) {
+    Station* station = index.stations[i];
+    int distance = station->getFrequency() - tuningValue;
+    if (distance > Radio::TUNING_LEEWAY) break;
+    if (distance < -Radio::TUNING_LEEWAY) continue;
+
+    int strength = strengthAtDistance[abs(distance)];
+    if (strength <= 0) {
       continue;
     }
 
-    // Calculate signal strength for this station
-    int strength = station.getSignalStrength(tuningValue);
-
-    // If this station has a better signal than what we've found so far, update our best match
-    if (strength > bestSignalStrength) {
-      bestSignalStrength = strength;
-      closestStation = &station;
+    // Insertion into the short sorted list; equal strengths keep catalogue order
+    size_t position = count;
+    while (position > 0 && (candidates[position - 1].signalStrength < strength ||
+                            (candidates[position - 1].signalStrength == strength &&
+                             candidates[position - 1].station > station))) {
+      if (position < maxCandidates) {
+        candidates[position] = candidates[position - 1];
+      }
+      position--;
+    }
+    if (position < maxCandidates) {
+      candidates[position] = {station, strength};
+      if (count < maxCandidates) count++;
     }
   }
 
-  // Update the output parameter with the best signal strength we found
-  signalStrength = bestSignalStrength;
-
-  return closestStation;
+  return count;
 }
 
 Station* StationManager::getStation(size_t index) {
@@ -87,16 +122,192 @@ void StationManager::updateStation(size_t index, int frequency, const String& me
 
   // Update the station properties
   stations[index].setFrequency(frequency);
-  stations[index].setMessage(message);
+  setStationMessage(index, message.c_str());
   stations[index].setEnabled(enabled);
 
-  // Save changes to persistent storage
-  saveToPreferences();
+  // Save changes to persistent storage; only this station's page can have changed
+  persist(index, index);
 }
 
-void StationManager::saveToPreferences() { StationStorage::getInstance().saveStations(stations); }
+/**
+ * Replace a station's message, keeping the text in the string arena
+ *
+ * @return false if the index is invalid, the message is too long or the arena is full
+ */
+bool StationManager::setStationMessage(size_t index, const char* message) {
+  if (index >= stations.size() || message == nullptr ||
+      strlen(message) > Radio::MAX_MESSAGE_LENGTH) {
+    return false;
+  }
+
+  Station& station = stations[index];
+  if (strcmp(station.message, message) == 0) {
+    return true;  // Unchanged, which also covers passing the station's own text back in
+  }
+
+  const char* copy = storeString(message);
+  if (copy == nullptr) {
+    return false;
+  }
+  strings.release(station.message);
+  station.message = copy;
+  return true;
+}
+
+/**
+ * Append a station to the catalogue
+ *
+ * @param toneFrequency Morse tone in Hz, or 0 for the receiver default
+ * @return false if a field is out of range or the string arena is full
+ */
+bool StationManager::addStation(const char* name, WaveBand band, int frequency,
+                                const char* message, uint16_t toneFrequency) {
+  if (name == nullptr || message == nullptr) {
+    return false;
+  }
+
+  size_t nameLength = strlen(name);
+  if (nameLength == 0 || nameLength > Radio::MAX_NAME_LENGTH ||
+      strlen(message) > Radio::MAX_MESSAGE_LENGTH || frequency < 0 ||
+      frequency > Radio::ADC_MAX) {
+    return false;
+  }
+  if (toneFrequency != 0 && (toneFrequency < Radio::MIN_TONE_FREQUENCY ||
+                             toneFrequency > Radio::MAX_TONE_FREQUENCY)) {
+    return false;
+  }
+
+  const char* storedName = storeString(name);
+  if (storedName == nullptr) {
+    return false;
+  }
+
+  // The station holds its name before the message is stored, so a compaction keeps it
+  stations.emplace_back(storedName, frequency, band, "", toneFrequency);
+  const char* storedMessage = storeString(message);
+  if (storedMessage == nullptr) {
+    strings.release(stations.back().name);
+    stations.pop_back();
+    rebuildTuningIndex();  // emplace_back may have moved the vector
+    return false;
+  }
+  stations.back().message = storedMessage;
+
+  persist(stations.size() - 1, StationStorage::ALL);
+  return true;
+}
+
+bool StationManager::removeStation(size_t index) {
+  if (index >= stations.size()) {
+    return false;
+  }
+
+  strings.release(stations[index].name);
+  strings.release(stations[index].message);
+  stations.erase(stations.begin() + index);
 
-void StationManager::loadFromPreferences() { StationStorage::getInstance().loadStations(stations); }
+  // Everything after the removed station moved down a slot
+  persist(index, StationStorage::ALL);
+  return true;
+}
+
+const char* StationManager::storeString(const char* text) {
+  const char* copy = strings.store(text);
+
+  // Reclaim released strings and retry, unless text is itself in the arena and would move
+  if (copy == nullptr && strings.getGarbage() > 0 && !strings.owns(text)) {
+    compactStrings();
+    copy = strings.store(text);
+  }
+  return copy;
+}
+
+void StationManager::compactStrings() {
+  // Two slots per station, name then message; anything not listed is treated as released
+  std::vector<const char*> live;
+  live.reserve(stations.size() * 2);
+  for (const Station& station : stations) {
+    live.push_back(station.name);
+    live.push_back(station.message);
+  }
+
+  strings.compact(live.data(), live.size());
+
+  for (size_t i = 0; i < stations.size(); i++) {
+    stations[i].name = live[i * 2];
+    stations[i].message = live[i * 2 + 1];
+  }
+}
+
+void StationManager::saveToPreferences() {
+  // Web handlers edit stations in place, so any of them may be dirty
+  persist(0, StationStorage::ALL);
+}
+
+void StationManager::persist(size_t firstDirty, size_t lastDirty) {
+  // Every edit path (updateStation, web handlers, reset) ends here. Tuning sees the edit
+  // at once; the write waits until edits stop arriving.
+  rebuildTuningIndex();
+  dirtyFirst = firstDirty < dirtyFirst ? firstDirty : dirtyFirst;
+  dirtyLast = lastDirty > dirtyLast ? lastDirty : dirtyLast;
+  PersistenceService::getInstance().markDirty(PersistenceService::Store::STATIONS);
+}
+
+bool StationManager::flushPending(size_t* bytesWritten) {
+  if (bytesWritten != nullptr) *bytesWritten = 0;
+  if (dirtyFirst > dirtyLast) {
+    return true;
+  }
+
+  // The dirty range is kept until a save lands, so a failed one is retried in full
+  if (!StationStorage::getInstance().saveStations(stations, dirtyFirst, dirtyLast, bytesWritten)) {
+    return false;
+  }
+  dirtyFirst = StationStorage::ALL;
+  dirtyLast = 0;
+  return true;
+}
+
+void StationManager::loadFromPreferences() {
+  // Storage replaces the defaults if it holds a catalogue, and the arena starts out empty.
+  // Edits not yet flushed are dropped along with the stations they applied to.
+  initializeDefaultStations();
+  dirtyFirst = StationStorage::ALL;
+  dirtyLast = 0;
+  StationStorage::getInstance().loadStations(stations, strings);
+  rebuildTuningIndex();
+}
+
+void StationManager::rebuildTuningIndex() {
+  for (int distance = 0; distance <= Radio::TUNING_LEEWAY; distance++) {
+    strengthAtDistance[distance] = map(distance, 0, Radio::TUNING_LEEWAY, 255, 0);
+  }
+
+  for (size_t band = 0; band < BAND_COUNT; band++) {
+    TuningIndex& index = tuningIndex[band];
+    index.stations.clear();
+    for (auto& station : stations) {
+      if (station.isEnabled() && static_cast<size_t>(station.getBand()) == band) {
+        index.stations.push_back(&station);
+      }
+    }
+
+    // Stations live in one vector, so pointer order is catalogue order
+    std::sort(index.stations.begin(), index.stations.end(), [](Station* a, Station* b) {
+      return a->getFrequency() != b->getFrequency() ? a->getFrequency() < b->getFrequency()
+                                                    : a < b;
+    });
+
+    size_t next = 0;
+    for (size_t bucket = 0; bucket <= TUNING_BUCKETS; bucket++) {
+      int bucketLow = static_cast<int>(bucket << TUNING_BUCKET_SHIFT);
+      while (next < index.stations.size() && index.stations[next]->getFrequency() < bucketLow) {
+        next++;
+      }
+      index.bucketStart[bucket] = static_cast<uint16_t>(next);
+    }
+  }
+}
 
 void StationManager::resetToDefaults() {
   initializeDefaultStations();
@@ -7,6 +7,13 @@
 #include "Station.h"
 #include "StationDefaults.h"
 #include "StationStorage.h"
+#include "StringArena.h"
+
+// A station audible at the current tuning position and how strongly it is received
+struct StationCandidate {
+  Station* station;
+  int signalStrength;
+};
 
 class StationManager {
  public:
@@ -20,6 +27,8 @@ class StationManager {
 
   // Station finding and access
   Station* findClosestStation(int tuningValue, WaveBand band, int& signalStrength);
+  size_t findStationCandidates(int tuningValue, WaveBand band, StationCandidate* candidates,
+                               size_t maxCandidates);
   const std::vector<Station>& getAllStations() const { return stations; }
   Station* getStation(size_t index);
   size_t getStationCount() const { return stations.size(); }
@@ -27,12 +36,20 @@ class StationManager {
   // Station configuration
   void updateStation(size_t index, int frequency, const String& message);
   void updateStation(size_t index, int frequency, const String& message, bool enabled);
+  bool setStationMessage(size_t index, const char* message);  // Caller saves
+
+  // Catalogue editing; both save, and return false when the request is rejected
+  bool addStation(const char* name, WaveBand band, int frequency, const char* message,
+                  uint16_t toneFrequency = 0);
+  bool removeStation(size_t index);
+  const StringArena& getStringArena() const { return strings; }
 
   // Band-specific operations
   std::vector<Station*> getStationsForBand(WaveBand band);
 
-  // Persistence
+  // Persistence; saves are queued with PersistenceService and written by flushPending()
   void saveToPreferences();
+  bool flushPending(size_t* bytesWritten = nullptr);  // False if the edits are still to write
   void loadFromPreferences();
   void resetToDefaults();
 
@@ -42,8 +59,36 @@ class StationManager {
   StationManager& operator=(const StationManager&) = delete;
 
   void initializeDefaultStations();
+  void rebuildTuningIndex();
+  void persist(size_t firstDirty, size_t lastDirty);
+  const char* storeString(const char* text);
+  void compactStrings();
 
   std::vector<Station> stations;
+
+  // Stations edited since the last flush; empty when first > last
+  size_t dirtyFirst = StationStorage::ALL;
+  size_t dirtyLast = 0;
+
+  // Names and messages that differ from the PROGMEM defaults
+  StringArena strings{Radio::STRING_ARENA_SIZE};
+
+  /**
+   * Per-band tuning index, rebuilt whenever stations are saved or loaded.
+   * Enabled stations are sorted by frequency, and a coarse bucket table maps
+   * an ADC value straight to the first station that could be in range, so a
+   * lookup only touches the stations near the dial whatever the catalogue size.
+   */
+  static constexpr int TUNING_BUCKET_SHIFT = 6;  // 64 ADC steps per bucket, wider than the leeway
+  static constexpr size_t TUNING_BUCKETS = (Radio::ADC_MAX >> TUNING_BUCKET_SHIFT) + 1;
+  static constexpr size_t BAND_COUNT = 3;
+
+  struct TuningIndex {
+    std::vector<Station*> stations;  // Sorted by frequency, then by catalogue order
+    uint16_t bucketStart[TUNING_BUCKETS + 1] = {};
+  };
+  TuningIndex tuningIndex[BAND_COUNT];
+  uint8_t strengthAtDistance[Radio::TUNING_LEEWAY + 1];
 };
 
 #endif
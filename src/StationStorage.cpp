@@ -1,40 +1,316 @@
 #include "StationStorage.h"
 #include "Config.h"
+#include <cstddef>
 #include <cstdio>
+#include <cstring>
+
+namespace {
+// Blobs are little-endian whatever the host, so the host tests read what the device writes
+void put16(uint8_t* out, uint16_t value) {
+  out[0] = value & 0xFF;
+  out[1] = value >> 8;
+}
+
+void put32(uint8_t* out, uint32_t value) {
+  put16(out, value & 0xFFFF);
+  put16(out + 2, value >> 16);
+}
+
+uint16_t get16(const uint8_t* in) { return in[0] | (in[1] << 8); }
+
+uint32_t get32(const uint8_t* in) { return get16(in) | (static_cast<uint32_t>(get16(in + 2)) << 16); }
+
+constexpr size_t HEADER_FIXED_BYTES = 10;  // magic(4) version(1) perPage(1) count(2) pages(2)
+
+const char* const CATALOGUE_NAMESPACE = "catalogue";
+const char* const LEGACY_NAMESPACE = "stations";
+}  // namespace
 
 // Optimized: Generate preference keys without String allocations
 void StationStorage::generatePreferenceKey(char* buffer, size_t bufferSize, const char* prefix, size_t index) const {
   snprintf(buffer, bufferSize, "%s%zu", prefix, index);
 }
 
-void StationStorage::saveStations(const std::vector<Station>& stations) {
+uint32_t StationStorage::crc32(const uint8_t* data, size_t length) {
+  // Reflected CRC-32 (as zlib), a nibble at a time to keep the table to 16 entries
+  static const uint32_t table[16] = {
+      0x00000000, 0x1DB71064, 0x3B6E20C8, 0x26D930AC, 0x76DC4190, 0x6B6B51F4,
+      0x4DB26158, 0x5005713C, 0xEDB88320, 0xF00F9344, 0xD6D6A3E8, 0xCB61B38C,
+      0x9B64C2B0, 0x86D3D2D4, 0xA00AE278, 0xBDBDF21C};
+  uint32_t crc = 0xFFFFFFFF;
+  for (size_t i = 0; i < length; i++) {
+    crc = table[(crc ^ data[i]) & 0x0F] ^ (crc >> 4);
+    crc = table[(crc ^ (data[i] >> 4)) & 0x0F] ^ (crc >> 4);
+  }
+  return ~crc;
+}
+
+size_t StationStorage::serializePage(const std::vector<Station>& stations, size_t page) {
+  size_t first = page * RECORDS_PER_PAGE;
+  size_t last = first + RECORDS_PER_PAGE < stations.size() ? first + RECORDS_PER_PAGE
+                                                           : stations.size();
+  uint8_t* out = pageBuffer;
+
+  for (size_t i = first; i < last; i++) {
+    const Station& station = stations[i];
+    // Text beyond the catalogue limits is cut rather than overflowing the record
+    size_t nameLength = strnlen(station.getName(), Radio::MAX_NAME_LENGTH);
+    size_t messageLength = strnlen(station.getMessage(), Radio::MAX_MESSAGE_LENGTH);
+
+    put16(out, static_cast<uint16_t>(station.getFrequency()));
+    out[2] = static_cast<uint8_t>(station.getBand());
+    out[3] = station.isEnabled() ? FLAG_ENABLED : 0;
+    put16(out + 4, station.getToneFrequency());
+    out[6] = static_cast<uint8_t>(nameLength);
+    out[7] = static_cast<uint8_t>(messageLength);
+    out += RECORD_HEADER_BYTES;
+
+    memcpy(out, station.getName(), nameLength);
+    out += nameLength;
+    memcpy(out, station.getMessage(), messageLength);
+    out += messageLength;
+  }
+
+  return out - pageBuffer;
+}
+
+// Returns the bytes written, or 0 unless the whole header was
+size_t StationStorage::writeHeader(Preferences& prefs, size_t count, size_t pageCount) {
+  std::vector<uint8_t> header(HEADER_FIXED_BYTES + pageCount * 4 + 4);
+  put32(&header[0], FORMAT_MAGIC);
+  header[4] = FORMAT_VERSION;
+  header[5] = RECORDS_PER_PAGE;
+  put16(&header[6], static_cast<uint16_t>(count));
+  put16(&header[8], static_cast<uint16_t>(pageCount));
+  for (size_t page = 0; page < pageCount; page++) {
+    put32(&header[HEADER_FIXED_BYTES + page * 4], pageCrcs[page]);
+  }
+  size_t crcOffset = header.size() - 4;
+  put32(&header[crcOffset], crc32(header.data(), crcOffset));
+
+  blobWrites++;
+  size_t written = prefs.putBytes("header", header.data(), header.size());
+  return written == header.size() ? written : 0;
+}
+
+bool StationStorage::saveStations(const std::vector<Station>& stations, size_t firstDirty,
+                                  size_t lastDirty, size_t* bytesWritten) {
+  if (bytesWritten != nullptr) *bytesWritten = 0;
   Preferences prefs;
-  if (!prefs.begin("stations", false)) {
-    return;
+  if (!prefs.begin(CATALOGUE_NAMESPACE, false)) {
+    return false;
   }
 
-  char keyBuffer[32];  // Buffer for key generation (e.g., "freq0", "msg15", etc.)
+  char keyBuffer[32];  // Buffer for key generation (e.g., "page0")
+  size_t pageCount = (stations.size() + RECORDS_PER_PAGE - 1) / RECORDS_PER_PAGE;
+  size_t storedPages = pageCrcs.size();
+  bool headerChanged = headerStale || stations.size() != storedCount || pageCount != storedPages;
 
-  for (size_t i = 0; i < stations.size(); i++) {
-    generatePreferenceKey(keyBuffer, sizeof(keyBuffer), "freq", i);
-    prefs.putInt(keyBuffer, stations[i].getFrequency());
+  // Pages flash has never held are dirty whatever the caller says
+  size_t firstPage = firstDirty / RECORDS_PER_PAGE;
+  size_t lastPage = lastDirty == ALL ? pageCount : lastDirty / RECORDS_PER_PAGE + 1;
+  if (pageCount > storedPages) {
+    firstPage = firstPage < storedPages ? firstPage : storedPages;
+    lastPage = pageCount;
+    pageCrcs.resize(pageCount, 0);
+  }
+  lastPage = lastPage < pageCount ? lastPage : pageCount;
+  // After a failed save every page is checked against the cache, not just the dirty range
+  if (headerStale) {
+    firstPage = 0;
+    lastPage = pageCount;
+  }
 
-    generatePreferenceKey(keyBuffer, sizeof(keyBuffer), "msg", i);
-    prefs.putString(keyBuffer, stations[i].getMessage());
+  size_t bytes = 0;
+  bool pagesSaved = true;
+  for (size_t page = firstPage; page < lastPage; page++) {
+    size_t length = serializePage(stations, page);
+    uint32_t crc = crc32(pageBuffer, length);
+    if (crc == pageCrcs[page]) {
+      continue;
+    }
 
-    generatePreferenceKey(keyBuffer, sizeof(keyBuffer), "enabled", i);
-    prefs.putBool(keyBuffer, stations[i].isEnabled());
+    generatePreferenceKey(keyBuffer, sizeof(keyBuffer), "page", page);
+    size_t written = prefs.putBytes(keyBuffer, pageBuffer, length);
+    blobWrites++;
+    bytes += written;
+    if (written != length) {
+      // The cached CRC still describes what flash holds, so the next save retries this page
+      pagesSaved = false;
+      continue;
+    }
+    headerChanged = true;
+    pageCrcs[page] = crc;
+  }
+
+  // A header naming a page that failed would make the next boot reject the whole catalogue
+  bool saved = pagesSaved;
+  if (saved && headerChanged) {
+    size_t written = writeHeader(prefs, stations.size(), pageCount);
+    bytes += written;
+    saved = written > 0;
+  }
+
+  if (saved) {
+    // Pages past the end of a shrunken catalogue go once no header refers to them
+    for (size_t page = pageCount; page < storedPages; page++) {
+      generatePreferenceKey(keyBuffer, sizeof(keyBuffer), "page", page);
+      prefs.remove(keyBuffer);
+    }
+    pageCrcs.resize(pageCount);
+    storedCount = stations.size();
+    headerStale = false;
+  } else {
+    headerStale = headerChanged;
   }
 
   prefs.end();
+  if (bytesWritten != nullptr) *bytesWritten = bytes;
+  return saved;
 }
 
-void StationStorage::loadStations(std::vector<Station>& stations) {
+bool StationStorage::parsePage(const uint8_t* data, size_t length, size_t records,
+                               std::vector<Station>& stations, StringArena& strings) {
+  char name[Radio::MAX_NAME_LENGTH + 1];
+  char message[Radio::MAX_MESSAGE_LENGTH + 1];
+  const uint8_t* end = data + length;
+
+  for (size_t i = 0; i < records; i++) {
+    if (end - data < static_cast<ptrdiff_t>(RECORD_HEADER_BYTES)) return false;
+
+    int frequency = get16(data);
+    uint8_t band = data[2];
+    bool enabled = data[3] & FLAG_ENABLED;
+    uint16_t tone = get16(data + 4);
+    size_t nameLength = data[6];
+    size_t messageLength = data[7];
+    data += RECORD_HEADER_BYTES;
+
+    if (nameLength == 0 || nameLength > Radio::MAX_NAME_LENGTH ||
+        messageLength > Radio::MAX_MESSAGE_LENGTH ||
+        band > static_cast<uint8_t>(WaveBand::SHORT_WAVE) ||
+        end - data < static_cast<ptrdiff_t>(nameLength + messageLength)) {
+      return false;
+    }
+
+    memcpy(name, data, nameLength);
+    name[nameLength] = '\0';
+    data += nameLength;
+    memcpy(message, data, messageLength);
+    message[messageLength] = '\0';
+    data += messageLength;
+
+    const char* storedName = strings.store(name);
+    const char* storedMessage = storedName != nullptr ? strings.store(message) : nullptr;
+    if (storedMessage == nullptr) return false;
+
+    stations.emplace_back(storedName, frequency, static_cast<WaveBand>(band), storedMessage, tone);
+    stations.back().setEnabled(enabled);
+  }
+
+  return data == end;
+}
+
+bool StationStorage::loadBlobs(Preferences& prefs, std::vector<Station>& stations,
+                               StringArena& strings) {
+  size_t headerLength = prefs.getBytesLength("header");
+  if (headerLength < HEADER_FIXED_BYTES + 4) {
+    return false;
+  }
+
+  std::vector<uint8_t> header(headerLength);
+  prefs.getBytes("header", header.data(), headerLength);
+  size_t count = get16(&header[6]);
+  size_t pageCount = get16(&header[8]);
+  if (get32(&header[0]) != FORMAT_MAGIC || header[4] != FORMAT_VERSION ||
+      header[5] != RECORDS_PER_PAGE || headerLength != HEADER_FIXED_BYTES + pageCount * 4 + 4 ||
+      pageCount != (count + RECORDS_PER_PAGE - 1) / RECORDS_PER_PAGE ||
+      get32(&header[headerLength - 4]) != crc32(header.data(), headerLength - 4)) {
+    return false;
+  }
+
+  // Parse into a scratch list so a corrupt page leaves the defaults untouched
+  std::vector<Station> loaded;
+  loaded.reserve(count);
+  std::vector<uint32_t> crcs(pageCount);
+  char keyBuffer[32];
+
+  for (size_t page = 0; page < pageCount; page++) {
+    crcs[page] = get32(&header[HEADER_FIXED_BYTES + page * 4]);
+    generatePreferenceKey(keyBuffer, sizeof(keyBuffer), "page", page);
+    size_t length = prefs.getBytesLength(keyBuffer);
+    size_t records = count - page * RECORDS_PER_PAGE < RECORDS_PER_PAGE
+                         ? count - page * RECORDS_PER_PAGE
+                         : RECORDS_PER_PAGE;
+
+    if (length > MAX_PAGE_BYTES || prefs.getBytes(keyBuffer, pageBuffer, length) != length ||
+        crc32(pageBuffer, length) != crcs[page] ||
+        !parsePage(pageBuffer, length, records, loaded, strings)) {
+#ifdef DEBUG_SERIAL_OUTPUT
+      Serial.printf("Station page %u is corrupt, keeping defaults\n", static_cast<unsigned>(page));
+#endif
+      strings.clear();
+      return true;  // A catalogue exists, so do not fall back to the legacy keys
+    }
+  }
+
+  stations.swap(loaded);
+  pageCrcs.swap(crcs);
+  storedCount = count;
+  return true;
+}
+
+void StationStorage::loadStations(std::vector<Station>& stations, StringArena& strings) {
+  // Until a catalogue is read, assume flash holds nothing so the next save writes every page
+  pageCrcs.clear();
+  storedCount = 0;
+  headerStale = false;
+
   Preferences prefs;
-  if (!prefs.begin("stations", true)) {
+  if (!prefs.begin(CATALOGUE_NAMESPACE, true)) {
     return;
   }
+  bool found = loadBlobs(prefs, stations, strings);
+  prefs.end();
+
+  if (!found) {
+    migrateLegacyKeys(stations, strings);
+  }
+}
+
+/**
+ * Move the freqN/msgN/enabledN keys older firmware wrote into blobs
+ *
+ * @return true if there was anything to migrate
+ */
+bool StationStorage::migrateLegacyKeys(std::vector<Station>& stations, StringArena& strings) {
+  Preferences prefs;
+  if (!prefs.begin(LEGACY_NAMESPACE, false)) {
+    return false;
+  }
 
+  bool found = prefs.isKey("freq0");
+  if (found) {
+    loadLegacyOverlay(prefs, stations, strings);
+#ifdef DEBUG_SERIAL_OUTPUT
+    Serial.printf("Migrating %u stations from legacy keys\n",
+                  static_cast<unsigned>(stations.size()));
+#endif
+    // The old keys are only erased once the blobs hold everything they did
+    if (saveStations(stations)) {
+      prefs.clear();
+    } else {
+#ifdef DEBUG_SERIAL_OUTPUT
+      Serial.println("Station blobs not saved, keeping legacy keys");
+#endif
+    }
+  }
+  prefs.end();
+  return found;
+}
+
+void StationStorage::loadLegacyOverlay(Preferences& prefs, std::vector<Station>& stations,
+                                       StringArena& strings) {
   char keyBuffer[32];  // Buffer for key generation
 
   for (size_t i = 0; i < stations.size(); i++) {
@@ -48,9 +324,25 @@ void StationStorage::loadStations(std::vector<Station>& stations) {
     bool enabled = prefs.getBool(keyBuffer, true);  // Default to enabled
 
     stations[i].setFrequency(freq);
-    stations[i].setMessage(msg);
     stations[i].setEnabled(enabled);
-  }
 
-  prefs.end();
+    // Old firmware took messages of any length; a record cannot hold more than
+    // MAX_MESSAGE_LENGTH, so a longer one keeps the default rather than being cut
+    if (msg.length() > Radio::MAX_MESSAGE_LENGTH) {
+#ifdef DEBUG_SERIAL_OUTPUT
+      Serial.printf("Station %u message is %u characters, over the %u limit; keeping default\n",
+                    static_cast<unsigned>(i), static_cast<unsigned>(msg.length()),
+                    static_cast<unsigned>(Radio::MAX_MESSAGE_LENGTH));
+#endif
+      continue;
+    }
+
+    // Unedited messages keep pointing at their PROGMEM default
+    if (strcmp(msg.c_str(), stations[i].getMessage()) != 0) {
+      const char* storedMessage = strings.store(msg.c_str());
+      if (storedMessage != nullptr) {
+        stations[i].message = storedMessage;
+      }
+    }
+  }
 }
@@ -4,7 +4,21 @@
 #include <Preferences.h>
 #include <vector>
 #include "Station.h"
+#include "StringArena.h"
 
+/**
+ * Persists the station catalogue as packed binary blobs in NVS.
+ *
+ * Stations are grouped into pages of RECORDS_PER_PAGE records, one blob per
+ * page, with a header blob holding the format version, station count and a
+ * CRC32 per page. A save only serializes the pages covering the dirty range it
+ * is given and only writes those whose CRC changed, so editing one message
+ * rewrites one page and the header instead of every key of every station.
+ *
+ * Older firmware stored freqN/msgN/enabledN keys in the "stations"
+ * namespace; those are migrated into blobs on the first load and then
+ * erased. Messages longer than MAX_MESSAGE_LENGTH keep their default.
+ */
 class StationStorage {
  public:
   static StationStorage& getInstance() {
@@ -12,16 +26,54 @@ class StationStorage {
     return instance;
   }
 
-  void saveStations(const std::vector<Station>& stations);
-  void loadStations(std::vector<Station>& stations);
+  static constexpr size_t ALL = static_cast<size_t>(-1);
+
+  // Stations [firstDirty, lastDirty] may have changed; the rest are known to match flash.
+  // Returns true once flash holds them all; bytesWritten counts what was handed to NVS.
+  bool saveStations(const std::vector<Station>& stations, size_t firstDirty = 0,
+                    size_t lastDirty = ALL, size_t* bytesWritten = nullptr);
+  // Replaces the catalogue if one was saved, else keeps the defaults in stations
+  void loadStations(std::vector<Station>& stations, StringArena& strings);
+
+  // Blobs written by saveStations() since start-up, header included
+  size_t getBlobWrites() const { return blobWrites; }
 
  private:
   StationStorage() = default;
   StationStorage(const StationStorage&) = delete;
   StationStorage& operator=(const StationStorage&) = delete;
 
+  static constexpr uint32_t FORMAT_MAGIC = 0x5453524D;  // "MRST"
+  static constexpr uint8_t FORMAT_VERSION = 1;
+  static constexpr size_t RECORDS_PER_PAGE = 16;
+  // frequency(2) band(1) flags(1) tone(2) nameLength(1) messageLength(1)
+  static constexpr size_t RECORD_HEADER_BYTES = 8;
+  static constexpr size_t MAX_RECORD_BYTES =
+      RECORD_HEADER_BYTES + Radio::MAX_NAME_LENGTH + Radio::MAX_MESSAGE_LENGTH;
+  static constexpr size_t MAX_PAGE_BYTES = RECORDS_PER_PAGE * MAX_RECORD_BYTES;
+  static constexpr uint8_t FLAG_ENABLED = 0x01;
+
+  size_t serializePage(const std::vector<Station>& stations, size_t page);
+  bool parsePage(const uint8_t* data, size_t length, size_t records,
+                 std::vector<Station>& stations, StringArena& strings);
+  size_t writeHeader(Preferences& prefs, size_t count, size_t pageCount);
+  bool loadBlobs(Preferences& prefs, std::vector<Station>& stations, StringArena& strings);
+
+  bool migrateLegacyKeys(std::vector<Station>& stations, StringArena& strings);
+  void loadLegacyOverlay(Preferences& prefs, std::vector<Station>& stations, StringArena& strings);
+
   // Optimized: Generate preference keys without String allocations
   void generatePreferenceKey(char* buffer, size_t bufferSize, const char* prefix, size_t index) const;
+
+  static uint32_t crc32(const uint8_t* data, size_t length);
+
+  // What flash holds, so unchanged pages are never rewritten
+  std::vector<uint32_t> pageCrcs;
+  size_t storedCount = 0;
+  bool headerStale = false;  // Pages were rewritten but the header describing them was not
+  size_t blobWrites = 0;
+
+  uint8_t pageBuffer[MAX_PAGE_BYTES];
 };
 
 #endif
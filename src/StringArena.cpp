@@ -0,0 +1,49 @@
+#include "StringArena.h"
+#include <algorithm>
+#include <vector>
+
+StringArena::StringArena(size_t capacity) : buffer(new char[capacity]), capacity(capacity) {}
+
+StringArena::~StringArena() { delete[] buffer; }
+
+const char* StringArena::store(const char* text) {
+  size_t length = strlen(text) + 1;
+  if (length > getFree()) {
+    return nullptr;
+  }
+
+  char* copy = buffer + used;
+  memcpy(copy, text, length);
+  used += length;
+  return copy;
+}
+
+void StringArena::release(const char* text) {
+  if (text != nullptr && owns(text)) {
+    garbage += strlen(text) + 1;
+  }
+}
+
+void StringArena::compact(const char** strings, size_t count) {
+  // Visit live strings in address order so every move is towards the front
+  std::vector<size_t> order;
+  order.reserve(count);
+  for (size_t i = 0; i < count; i++) {
+    if (strings[i] != nullptr && owns(strings[i])) {
+      order.push_back(i);
+    }
+  }
+  std::sort(order.begin(), order.end(),
+            [strings](size_t a, size_t b) { return strings[a] < strings[b]; });
+
+  size_t end = 0;
+  for (size_t i : order) {
+    size_t length = strlen(strings[i]) + 1;
+    memmove(buffer + end, strings[i], length);
+    strings[i] = buffer + end;
+    end += length;
+  }
+
+  used = end;
+  garbage = 0;
+}
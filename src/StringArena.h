@@ -0,0 +1,49 @@
+#ifndef STRING_ARENA_H
+#define STRING_ARENA_H
+
+#include <Arduino.h>
+
+/**
+ * Fixed-size pool for station names and messages.
+ *
+ * Strings are appended NUL-terminated into one buffer allocated up front, so
+ * the catalogue never fragments the heap and its footprint is known at
+ * start-up however many stations are added. Releasing a string only counts
+ * its bytes as garbage; compact() slides the live strings down to reclaim
+ * them and tells the owner where each one moved.
+ *
+ * Pointers the arena does not own (e.g. the PROGMEM defaults) can be passed
+ * to release() and compact() and are left alone.
+ */
+class StringArena {
+ public:
+  explicit StringArena(size_t capacity);
+  ~StringArena();
+
+  // Copies text into the pool; nullptr when it does not fit, after which the owner may compact()
+  const char* store(const char* text);
+  void release(const char* text);
+  void clear() { used = garbage = 0; }
+
+  // Rewrites each owned pointer in strings to its new address once the garbage is squeezed out
+  void compact(const char** strings, size_t count);
+
+  bool owns(const char* text) const {
+    return text >= buffer && text < buffer + capacity;
+  }
+  size_t getCapacity() const { return capacity; }
+  size_t getUsed() const { return used; }
+  size_t getGarbage() const { return garbage; }
+  size_t getFree() const { return capacity - used; }
+
+ private:
+  StringArena(const StringArena&) = delete;
+  StringArena& operator=(const StringArena&) = delete;
+
+  char* buffer;
+  size_t capacity;
+  size_t used = 0;     // Bytes appended since the last compaction
+  size_t garbage = 0;  // Bytes of released strings still inside `used`
+};
+
+#endif
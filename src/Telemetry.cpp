@@ -0,0 +1,96 @@
+#include "Telemetry.h"
+
+#include <cstdarg>
+#include <cstdio>
+#include <cstring>
+
+namespace {
+class JsonWriter {
+ public:
+  JsonWriter(char* buffer, size_t size) : buffer(buffer), size(size) { append("{"); }
+
+  void field(const char* name, const char* format, ...) __attribute__((format(printf, 3, 4))) {
+    append(fields++ > 0 ? ",\"%s\":" : "\"%s\":", name);
+    va_list args;
+    va_start(args, format);
+    appendV(format, args);
+    va_end(args);
+  }
+
+  // Station names are user input, so quotes and backslashes are escaped
+  void stringField(const char* name, const char* value) {
+    append(fields++ > 0 ? ",\"%s\":\"" : "\"%s\":\"", name);
+    for (const char* c = value; *c != '\0'; c++) {
+      if (*c == '"' || *c == '\\') {
+        append("\\%c", *c);
+      } else if (static_cast<unsigned char>(*c) >= 0x20) {
+        append("%c", *c);
+      }
+    }
+    append("\"");
+  }
+
+  size_t finish() {
+    append("}");
+    return overflow ? 0 : used;
+  }
+
+  size_t count() const { return fields; }
+
+ private:
+  void append(const char* format, ...) __attribute__((format(printf, 2, 3))) {
+    va_list args;
+    va_start(args, format);
+    appendV(format, args);
+    va_end(args);
+  }
+
+  void appendV(const char* format, va_list args) {
+    if (overflow) return;
+    int written = vsnprintf(buffer + used, size - used, format, args);
+    if (written < 0 || static_cast<size_t>(written) >= size - used) {
+      overflow = true;
+      return;
+    }
+    used += written;
+  }
+
+  char* buffer;
+  size_t size;
+  size_t used = 0;
+  size_t fields = 0;
+  bool overflow = false;
+};
+}  // namespace
+
+size_t Telemetry::writeDelta(const Telemetry* previous, const Telemetry& current, char* buffer,
+                             size_t size) {
+  if (size == 0) return 0;
+  JsonWriter json(buffer, size);
+  const Telemetry* p = previous;
+
+  if (!p || p->tuning != current.tuning) json.field("tuning", "%d", current.tuning);
+  if (!p || p->signalStrength != current.signalStrength) {
+    json.field("signal", "%d", current.signalStrength);
+  }
+  if (!p || p->stationFrequency != current.stationFrequency ||
+      strcmp(p->stationName, current.stationName) != 0) {
+    json.field("frequency", "%d", current.stationFrequency);
+    json.stringField("station", current.stationName);
+  }
+  if (!p || p->band != current.band) json.stringField("band", toString(current.band));
+  if (!p || p->speed != current.speed) json.stringField("speed", toString(current.speed));
+  if (!p || p->batteryCentivolts != current.batteryCentivolts) {
+    json.field("voltage", "%d.%02d", current.batteryCentivolts / 100,
+               current.batteryCentivolts % 100);
+  }
+  if (!p || p->batteryPercent != current.batteryPercent) {
+    json.field("percentage", "%d", current.batteryPercent);
+  }
+  if (!p || p->charging != current.charging) {
+    json.field("isCharging", "%s", current.charging ? "true" : "false");
+  }
+
+  if (json.count() == 0) return 0;
+  return json.finish();
+}
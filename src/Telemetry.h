@@ -0,0 +1,35 @@
+#ifndef TELEMETRY_H
+#define TELEMETRY_H
+
+#include <Arduino.h>
+#include "Config.h"
+
+/**
+ * Live radio state for the web UI, pushed as Server-Sent Events on /events.
+ *
+ * The network task samples one of these per stream interval and sends each
+ * client only the fields that changed since its last event, so a dial at
+ * rest costs nothing on the link. The battery is kept in centivolts and
+ * whole percent, the precision the page shows, so ADC noise below that is
+ * not a change.
+ */
+struct Telemetry {
+  int tuning = 0;              // Smoothed dial reading, as /tuning reports it
+  int signalStrength = 0;      // 0 when no station is in range
+  int stationFrequency = -1;   // Dial position of the station in range, -1 if none
+  char stationName[Radio::MAX_NAME_LENGTH + 1] = {};
+  WaveBand band = WaveBand::MEDIUM_WAVE;
+  MorseSpeed speed = MorseSpeed::MEDIUM;
+  int batteryCentivolts = 0;
+  int batteryPercent = 0;
+  bool charging = false;
+
+  static constexpr size_t JSON_CAPACITY = 256;
+
+  // JSON object of the fields that differ from previous, or of every field without one.
+  // Returns the length; 0 when nothing changed or the buffer is too small.
+  static size_t writeDelta(const Telemetry* previous, const Telemetry& current, char* buffer,
+                           size_t size);
+};
+
+#endif
@@ -1,4 +1,5 @@
 #include "WaveBandManager.h"
+#include "InputScanner.h"
 
 // Define the LED mapping
 const WaveBandManager::BandLED WaveBandManager::BAND_LEDS[] = {
@@ -8,6 +9,7 @@ const WaveBandManager::BandLED WaveBandManager::BAND_LEDS[] = {
 
 void WaveBandManager::begin() {
   initializePins();
+  switchesRead = false;
   update();  // Initial update
 }
 
@@ -25,13 +27,23 @@ void WaveBandManager::initializePins() {
 
 void WaveBandManager::update() {
   auto& config = ConfigManager::getInstance();
+  auto& inputs = InputScanner::getInstance();
+
+  // React only when a band switch has moved since the last update
+  uint64_t switches = inputs.getLevels() & SWITCH_MASK;
+  if (switchesRead && switches == lastSwitches) {
+    return;
+  }
+  lastSwitches = switches;
+  switchesRead = true;
+
   WaveBand newBand;
 
-  // Read switch states
-  if (digitalRead(Pins::LW_BAND_SWITCH) == LOW) {
+  // Read switch states from this pass's input snapshot
+  if (inputs.isLow(Pins::LW_BAND_SWITCH)) {
     // LONG_WAVE switch works as expected
     newBand = WaveBand::LONG_WAVE;
-  } else if (digitalRead(Pins::MW_BAND_SWITCH) == LOW) {
+  } else if (inputs.isLow(Pins::MW_BAND_SWITCH)) {
     // Swapped: MW switch now selects SHORT_WAVE
     // This is because the hardware was changed from rotary to toggle switches
     newBand = WaveBand::SHORT_WAVE;
@@ -35,6 +35,11 @@ class WaveBandManager {
 
   // Internal state
   uint8_t ledBrightness = LEDConfig::MAX_BRIGHTNESS;
+  uint64_t lastSwitches = 0;  // Band switch levels the current band was chosen from
+  bool switchesRead = false;
+
+  static constexpr uint64_t SWITCH_MASK =
+      (1ULL << Pins::LW_BAND_SWITCH) | (1ULL << Pins::MW_BAND_SWITCH);
 
   // LED to Band mapping
   struct BandLED {
@@ -1,8 +1,120 @@
 #include "WiFiManager.h"
 #include <ArduinoJson.h>
 #include <ElegantOTA.h>
+#include "LoopWaker.h"
+#include "PerfMonitor.h"
+#include "PersistenceService.h"
+#include "RadioState.h"
 #include "Version.h"  // Include the auto-generated version header
-#include "WaveBandManager.h"
+#include "WebAssets.h"  // Generated from web/ by scripts/web_assets.py
+
+namespace {
+// Network and UI work shares core 0 with the WiFi stack, away from the real-time task
+constexpr uint32_t NETWORK_TASK_STACK = 8192;
+constexpr UBaseType_t NETWORK_TASK_PRIORITY = 1;
+constexpr BaseType_t NETWORK_TASK_CORE = 0;
+constexpr unsigned long NETWORK_POLL_INTERVAL = 10;  // Web server poll while WiFi is on (ms)
+
+// Stylesheet and script live under the firmware version, so a browser can keep them until an update
+const char ASSET_PATH[] = "/assets/" FIRMWARE_VERSION "/";
+
+// Per-station markup, formatted into a stack buffer sized for the longest name and message
+const char STATION_ROW[] PROGMEM =
+    "<div class='station'><div class='station-header'><div class='station-name'>%s</div>"
+    "<div class='toggle'><input type='checkbox' id='enable_%u' name='enable_%u' %s>"
+    "<label for='enable_%u'>Enabled</label></div></div>"
+    "<div class='station-body'><div class='form-group'><label>Message</label>"
+    "<input type='text' name='msg_%u' value='%s' placeholder='Enter your morse code message'>"
+    "</div><!-- Hidden frequency input to maintain save functionality -->"
+    "<input type='hidden' name='freq_%u' value='%d'></div></div>";
+
+const char TUNING_ROW[] PROGMEM =
+    "<div class='station tuning-station'><div class='station-header'><div class='station-name'>%s"
+    "</div><div class='tuning-controls'><span class='frequency-display' id='freq_%u'>%d</span>"
+    "<button type='button' class='btn-set' onclick='setFrequency(%u)'>Set</button></div></div>"
+    "</div>";
+
+constexpr size_t ROW_NUMBERS = 48;  // Room for the index and frequency fields
+constexpr size_t ROW_BUFFER_SIZE =
+    sizeof(STATION_ROW) + Radio::MAX_NAME_LENGTH + Radio::MAX_MESSAGE_LENGTH + ROW_NUMBERS;
+
+struct BandSection {
+  WaveBand band;
+  const char* heading;
+};
+
+const BandSection BAND_SECTIONS[] = {
+    {WaveBand::LONG_WAVE, "<div class='wave-band long-wave'><h2>Long Wave</h2>"},
+    {WaveBand::MEDIUM_WAVE, "<div class='wave-band medium-wave'><h2>Medium Wave</h2>"},
+    {WaveBand::SHORT_WAVE, "<div class='wave-band short-wave'><h2>Short Wave</h2>"},
+};
+
+void writeStationRow(HtmlStream& html, size_t index, const Station& station) {
+  char row[ROW_BUFFER_SIZE];
+  unsigned id = static_cast<unsigned>(index);
+  snprintf_P(row, sizeof(row), STATION_ROW, station.getName(), id, id,
+             station.isEnabled() ? "checked" : "", id, id, station.getMessage(), id,
+             station.getFrequency());
+  html += row;
+}
+
+void writeTuningRow(HtmlStream& html, size_t index, const Station& station) {
+  char row[ROW_BUFFER_SIZE];
+  unsigned id = static_cast<unsigned>(index);
+  snprintf_P(row, sizeof(row), TUNING_ROW, station.getName(), id, station.getFrequency(), id);
+  html += row;
+}
+
+// One /api/messages station, serialized into a buffer the import side can read back whole
+bool writeStationRecord(HtmlStream& json, size_t index, const Station& station, bool first) {
+  JsonDocument doc;
+  doc["index"] = index;
+  doc["name"] = station.getName();
+  doc["message"] = station.getMessage();
+  doc["enabled"] = station.isEnabled();
+  doc["tone"] = station.getToneFrequency();
+
+  // Wave band as a string for readability
+  switch (station.getBand()) {
+    case WaveBand::LONG_WAVE:
+      doc["band"] = "LONG_WAVE";
+      break;
+    case WaveBand::MEDIUM_WAVE:
+      doc["band"] = "MEDIUM_WAVE";
+      break;
+    case WaveBand::SHORT_WAVE:
+      doc["band"] = "SHORT_WAVE";
+      break;
+  }
+
+  char record[JsonRecordReader::CAPACITY + 1];
+  if (measureJson(doc) > JsonRecordReader::CAPACITY) return false;
+  serializeJson(doc, record, sizeof(record));
+  if (!first) json += ",";
+  json += record;
+  return true;
+}
+
+// One section per band in band order, each station in catalogue order; empty bands are left out
+void writeBandSections(HtmlStream& html, bool enabledOnly,
+                       void (*writeRow)(HtmlStream&, size_t, const Station&)) {
+  auto& stationManager = StationManager::getInstance();
+  for (const auto& section : BAND_SECTIONS) {
+    bool opened = false;
+    for (size_t i = 0; i < stationManager.getStationCount(); i++) {
+      const Station* station = stationManager.getStation(i);
+      if (!station || station->getBand() != section.band) continue;
+      if (enabledOnly && !station->isEnabled()) continue;
+      if (!opened) {
+        html += section.heading;
+        opened = true;
+      }
+      writeRow(html, i, *station);
+    }
+    if (opened) html += "</div>";
+  }
+}
+}  // namespace
 
 // Define static members - stored in PROGMEM to save RAM
 const char WiFiManager::HTML_HEADER[] PROGMEM = R"(
@@ -12,970 +124,12 @@ const char WiFiManager::HTML_HEADER[] PROGMEM = R"(
     <title>Radio Configuration</title>
     <meta charset="UTF-8">
     <meta name="viewport" content="width=device-width, initial-scale=1">
-    <meta name="theme-color" content="#2196F3">
-    <style>)";
-
-const char WiFiManager::CSS_STYLES[] PROGMEM = R"(
-    :root {
-        --primary-color: #2196F3;
-        --secondary-color: #757575;
-        --success-color: #4CAF50;
-        --error-color: #f44336;
-        --warning-color: #ff9800;
-        --background-color: #f8f9fa;
-        --card-background: #ffffff;
-        --text-color: #212529;
-        --text-muted: #6c757d;
-        --border-color: #dee2e6;
-        --primary-hover: #1976d2;
-        --secondary-hover: #616161;
-        --success-hover: #388e3c;
-        --spacing: 1rem;
-        --border-radius: 0.5rem;
-        --shadow: 0 2px 4px rgba(0,0,0,0.1);
-        --focus-shadow: 0 0 0 3px rgba(33, 150, 243, 0.1);
-        --floating-shadow: 0 4px 12px rgba(0,0,0,0.15);
-        --button-shadow: 0 2px 8px rgba(0,0,0,0.1);
-        
-        /* Wave band colors - matching LED colors */
-        --long-wave-color: #dc3545;
-        --medium-wave-color: #ffc107;
-        --short-wave-color: #0d6efd;
-        
-        /* Header and help section backgrounds */
-        --header-background: rgba(0,0,0,0.02);
-        --help-background: #f8f9fa;
-        --help-border: #e9ecef;
-    }
-
-    @media (prefers-color-scheme: dark) {
-        :root {
-            --background-color: #121212;
-            --card-background: #1e1e1e;
-            --text-color: #ffffff;
-            --text-muted: #adb5bd;
-            --border-color: #495057;
-            --header-background: rgba(255,255,255,0.05);
-            --help-background: #2d2d2d;
-            --help-border: #404040;
-            --primary-hover: #1565c0;
-            --secondary-hover: #757575;
-            --success-hover: #2e7d32;
-            --shadow: 0 2px 4px rgba(255,255,255,0.05);
-            --focus-shadow: 0 0 0 3px rgba(33, 150, 243, 0.2);
-            --floating-shadow: 0 4px 12px rgba(0,0,0,0.3);
-            --button-shadow: 0 2px 8px rgba(0,0,0,0.2);
-        }
-    }
-
-    * {
-        box-sizing: border-box;
-        margin: 0;
-        padding: 0;
-    }
-
-    body { 
-        font-family: -apple-system, BlinkMacSystemFont, "Segoe UI", Roboto, sans-serif;
-        line-height: 1.6;
-        background-color: var(--background-color);
-        color: var(--text-color);
-        min-height: 100vh;
-    }
-
-    .container {
-        max-width: 600px;
-        margin: 0 auto;
-        padding: var(--spacing);
-        padding-bottom: calc(var(--spacing) * 6);
-        min-height: 100vh;
-        display: flex;
-        flex-direction: column;
-    }
-
-    .header {
-        text-align: center;
-        padding: calc(var(--spacing) * 2) 0;
-        border-bottom: 1px solid var(--border-color);
-        margin-bottom: var(--spacing);
-    }
-
-    .status-bar {
-        background: var(--card-background);
-        padding: calc(var(--spacing) * 0.75);
-        border-radius: var(--border-radius);
-        box-shadow: var(--shadow);
-        margin-bottom: var(--spacing);
-        text-align: center;
-        font-size: 0.9em;
-        color: var(--text-muted);
-    }
-
-    .nav {
-        display: flex;
-        gap: calc(var(--spacing) * 0.5);
-        margin-bottom: calc(var(--spacing) * 1.5);
-    }
-
-    .nav a {
-        flex: 1;
-        padding: calc(var(--spacing) * 0.75);
-        text-decoration: none;
-        color: var(--text-color);
-        background: var(--card-background);
-        border-radius: var(--border-radius);
-        text-align: center;
-        font-weight: 500;
-        border: 1px solid var(--border-color);
-        transition: all 0.2s ease;
-    }
-
-    .nav a.active {
-        background: var(--primary-color);
-        color: white;
-        border-color: var(--primary-color);
-    }
-
-    .nav a:hover:not(.active) {
-        background: var(--border-color);
-    }
-
-    .card {
-        background: var(--card-background);
-        border: 1px solid var(--border-color);
-        border-radius: var(--border-radius);
-        box-shadow: var(--shadow);
-        margin-bottom: var(--spacing);
-        overflow: hidden;
-    }
-
-    .card-header {
-        padding: var(--spacing);
-        border-bottom: 1px solid var(--border-color);
-        background: var(--header-background);
-    }
-
-    .card-body {
-        padding: var(--spacing);
-    }
-
-    .station {
-        border: 1px solid var(--border-color);
-        border-radius: var(--border-radius);
-        margin-bottom: calc(var(--spacing) * 0.75);
-        overflow: hidden;
-    }
-
-    .station-header {
-        display: flex;
-        justify-content: space-between;
-        align-items: center;
-        padding: calc(var(--spacing) * 0.75);
-        background: var(--header-background);
-        border-bottom: 1px solid var(--border-color);
-    }
-
-    .station-name {
-        font-weight: 600;
-        color: var(--text-color);
-    }
-
-    .station-body {
-        padding: var(--spacing);
-    }
-
-    .form-group {
-        margin-bottom: var(--spacing);
-    }
-
-    .form-row {
-        display: flex;
-        gap: calc(var(--spacing) * 0.5);
-        align-items: center;
-    }
-
-    label {
-        display: block;
-        margin-bottom: calc(var(--spacing) * 0.25);
-        font-weight: 500;
-        color: var(--text-color);
-        font-size: 0.9em;
-    }
-
-    input, button {
-        font-size: 16px;
-        border-radius: var(--border-radius);
-        padding: calc(var(--spacing) * 0.75);
-        border: 1px solid var(--border-color);
-        background: var(--card-background);
-        color: var(--text-color);
-        transition: border-color 0.2s ease, box-shadow 0.2s ease;
-    }
-
-    input:focus {
-        outline: none;
-        border-color: var(--primary-color);
-        box-shadow: var(--focus-shadow);
-    }
-
-    input[type="text"], input[type="number"] {
-        width: 100%;
-    }
-
-    input[type="number"] {
-        -moz-appearance: textfield;
-    }
-
-    input[type="number"]::-webkit-outer-spin-button,
-    input[type="number"]::-webkit-inner-spin-button {
-        -webkit-appearance: none;
-    }
-
-    input[type="checkbox"] {
-        width: 20px;
-        height: 20px;
-        margin: 0;
-        accent-color: var(--primary-color);
-    }
-
-    .toggle {
-        display: flex;
-        align-items: center;
-        gap: calc(var(--spacing) * 0.5);
-    }
-
-    button {
-        background: var(--primary-color);
-        color: white;
-        border: none;
-        font-weight: 500;
-        cursor: pointer;
-        transition: all 0.2s ease;
-        min-height: 44px;
-        display: inline-flex;
-        align-items: center;
-        justify-content: center;
-    }
-
-    button:hover {
-        background: var(--primary-hover);
-        transform: translateY(-1px);
-    }
-
-    button:active {
-        transform: translateY(0);
-    }
-
-    .btn-secondary {
-        background: var(--secondary-color);
-    }
-
-    .btn-secondary:hover {
-        background: var(--secondary-hover);
-    }
-
-    .btn-success {
-        background: var(--success-color);
-    }
-
-    .btn-success:hover {
-        background: var(--success-hover);
-    }
-
-    .wave-band {
-        margin-bottom: calc(var(--spacing) * 1.5);
-    }
-
-    .wave-band h2 {
-        font-size: 1.1em;
-        font-weight: 600;
-        margin-bottom: var(--spacing);
-        padding: calc(var(--spacing) * 0.5);
-        border-left: 4px solid;
-        background: var(--header-background);
-    }
-
-    .wave-band.long-wave h2 {
-        border-left-color: var(--long-wave-color);
-        color: var(--long-wave-color);
-    }
-
-    .wave-band.medium-wave h2 {
-        border-left-color: var(--medium-wave-color);
-        color: var(--medium-wave-color);
-    }
-
-    .wave-band.short-wave h2 {
-        border-left-color: var(--short-wave-color);
-        color: var(--short-wave-color);
-    }
-
-    .save-area {
-        margin-top: auto;
-        padding-top: calc(var(--spacing) * 2);
-        border-top: 1px solid var(--border-color);
-    }
-
-    .save-button {
-        width: 100%;
-        padding: calc(var(--spacing) * 1);
-        font-size: 1.1em;
-        font-weight: 600;
-    }
-
-    .save-button:disabled {
-        opacity: 0.5;
-        cursor: not-allowed;
-    }
-
-    .save-button.saving {
-        position: relative;
-        color: transparent;
-    }
-
-    .save-button.saving::after {
-        content: 'Saving...';
-        position: absolute;
-        left: 50%;
-        top: 50%;
-        transform: translate(-50%, -50%);
-        color: white;
-    }
-
-    .calibration-display {
-        text-align: center;
-        padding: calc(var(--spacing) * 2);
-        background: var(--card-background);
-        border: 1px solid var(--border-color);
-        border-radius: var(--border-radius);
-        margin-bottom: calc(var(--spacing) * 1.5);
-    }
-
-    .tuning-value {
-        font-size: 2em;
-        font-weight: 700;
-        color: var(--primary-color);
-        margin-bottom: calc(var(--spacing) * 0.5);
-    }
-
-    .calibration-help {
-        background: var(--help-background);
-        border: 1px solid var(--help-border);
-        border-radius: var(--border-radius);
-        padding: var(--spacing);
-        margin-bottom: calc(var(--spacing) * 1.5);
-        font-size: 0.9em;
-        line-height: 1.5;
-        color: var(--text-color);
-    }
-
-    .frequency-display {
-        font-weight: 600;
-        color: var(--primary-color);
-        font-size: 1.1em;
-        padding: calc(var(--spacing) * 0.5) calc(var(--spacing) * 0.75);
-        border-radius: var(--border-radius);
-        transition: background-color 0.3s ease, color 0.3s ease;
-        min-width: 60px;
-        text-align: center;
-    }
-
-    .tuning-station .station-header {
-        flex-wrap: nowrap;
-        gap: calc(var(--spacing) * 0.75);
-    }
-
-    .tuning-controls {
-        display: flex;
-        align-items: center;
-        gap: calc(var(--spacing) * 0.5);
-    }
-
-    .btn-set {
-        background: var(--primary-color);
-        color: white;
-        border: none;
-        padding: calc(var(--spacing) * 0.5) calc(var(--spacing) * 1);
-        border-radius: var(--border-radius);
-        font-weight: 500;
-        cursor: pointer;
-        min-height: 36px;
-        font-size: 0.9em;
-        white-space: nowrap;
-    }
-
-    .btn-set:hover {
-        background: var(--primary-hover);
-    }
-
-    .floating-save {
-        position: fixed;
-        bottom: calc(var(--spacing) * 2);
-        left: 50%;
-        transform: translateX(-50%);
-        z-index: 1000;
-        box-shadow: var(--floating-shadow);
-        border-radius: var(--border-radius);
-        backdrop-filter: blur(8px);
-    }
-
-    .floating-save .save-button {
-        padding: calc(var(--spacing) * 1);
-        font-size: 1.1em;
-        font-weight: 600;
-        min-width: 200px;
-        border-radius: var(--border-radius);
-        box-shadow: var(--button-shadow);
-    }
-
-    .import-export-section {
-        margin-top: calc(var(--spacing) * 2);
-        padding: var(--spacing);
-        padding-bottom: calc(var(--spacing) * 5);
-        border-top: 1px solid var(--border-color);
-        margin-bottom: calc(var(--spacing) * 2);
-    }
-
-    .import-export-buttons {
-        display: flex;
-        gap: calc(var(--spacing) * 0.75);
-        margin-top: calc(var(--spacing) * 0.75);
-    }
-
-    .import-export-buttons button {
-        flex: 1;
-        font-size: 0.95em;
-    }
-
-    .btn-export {
-        background: var(--secondary-color);
-    }
-
-    .btn-export:hover {
-        background: var(--secondary-hover);
-    }
-
-    .btn-import {
-        background: var(--primary-color);
-    }
-
-    .btn-import:hover {
-        background: var(--primary-hover);
-    }
-
-    #importFile {
-        display: none;
-    }
-
-    .toast {
-        position: fixed;
-        top: calc(var(--spacing) * 2);
-        left: 50%;
-        transform: translateX(-50%);
-        background: var(--success-color);
-        color: white;
-        padding: calc(var(--spacing) * 0.75) var(--spacing);
-        border-radius: var(--border-radius);
-        box-shadow: var(--shadow);
-        z-index: 1000;
-        font-weight: 500;
-        opacity: 0;
-        transition: opacity 0.3s ease;
-        pointer-events: none;
-    }
-
-    .toast.error {
-        background: var(--error-color);
-    }
-
-    .toast.show {
-        opacity: 1;
-    }
-
-    h1 {
-        font-size: 1.5em;
-        font-weight: 700;
-        margin: 0;
-        color: var(--text-color);
-    }
-
-    h2 {
-        font-size: 1.2em;
-        font-weight: 600;
-        margin: 0 0 var(--spacing) 0;
-        color: var(--text-color);
-    }
-
-    .text-muted {
-        color: var(--text-muted);
-        font-size: 0.9em;
-    }
-
-    /* Mobile-first responsive design */
-    @media (max-width: 480px) {
-        .container {
-            padding: calc(var(--spacing) * 0.75);
-        }
-        
-        .form-row {
-            flex-direction: column;
-            align-items: stretch;
-        }
-        
-        .nav {
-            flex-direction: column;
-        }
-        
-        .nav a {
-            padding: calc(var(--spacing) * 1);
-        }
-    }
-
-    @media (hover: none) {
-        button:hover {
-            transform: none;
-        }
-    }
-
-    /* Focus styles for accessibility */
-    :focus-visible {
-        outline: 2px solid var(--primary-color);
-        outline-offset: 2px;
-    }
-
-    /* Loading animation */
-    @keyframes pulse {
-        0%, 100% { opacity: 1; }
-        50% { opacity: 0.5; }
-    }
-
-    .saving {
-        animation: pulse 1.5s infinite;
-    }
-
-    /* Battery indicator styles */
-    .battery-card .card-body {
-        padding: calc(var(--spacing) * 1.25);
-    }
-
-    .battery-indicator {
-        display: grid;
-        grid-template-columns: 1fr;
-        gap: calc(var(--spacing) * 0.9);
-        padding: calc(var(--spacing) * 1.25);
-        background: linear-gradient(155deg, var(--header-background), transparent 65%);
-        border: 1px solid var(--border-color);
-        border-radius: var(--border-radius);
-    }
-
-    .battery-topline {
-        display: flex;
-        justify-content: space-between;
-        align-items: baseline;
-        gap: calc(var(--spacing) * 0.75);
-    }
-
-    .battery-label {
-        font-size: 0.85em;
-        color: var(--text-muted);
-        text-transform: uppercase;
-        letter-spacing: 0.04em;
-        font-weight: 600;
-    }
-
-    .battery-percentage {
-        font-size: clamp(2.4rem, 9vw, 3.5rem);
-        line-height: 1;
-        font-weight: 750;
-        color: var(--text-color);
-    }
-
-    .battery-meter {
-        position: relative;
-        width: 100%;
-        height: 34px;
-        border: 2px solid var(--text-color);
-        border-radius: 8px;
-        padding: 3px;
-        background: var(--card-background);
-        overflow: hidden;
-    }
-
-    .battery-meter::after {
-        content: '';
-        position: absolute;
-        right: 0;
-        top: 50%;
-        transform: translate(100%, -50%);
-        width: 6px;
-        height: 16px;
-        border-radius: 0 3px 3px 0;
-        background: var(--text-color);
-    }
-
-    .battery-fill {
-        height: 100%;
-        background: var(--success-color);
-        border-radius: 4px;
-        transition: width 0.5s ease, background-color 0.3s ease;
-    }
-
-    .battery-fill.low {
-        background: var(--warning-color);
-    }
-
-    .battery-fill.critical {
-        background: var(--error-color);
-    }
-
-    .battery-info {
-        display: flex;
-        flex-direction: column;
-        gap: calc(var(--spacing) * 0.45);
-    }
-
-    .battery-voltage {
-        font-size: 1.05em;
-        font-weight: 600;
-        color: var(--text-muted);
-    }
-
-    .battery-status {
-        display: inline-flex;
-        align-items: center;
-        gap: calc(var(--spacing) * 0.35);
-        width: fit-content;
-        font-size: 0.85em;
-        font-weight: 600;
-        padding: calc(var(--spacing) * 0.25) calc(var(--spacing) * 0.6);
-        border-radius: 999px;
-        border: 1px solid var(--border-color);
-        color: var(--text-muted);
-        background: var(--card-background);
-    }
-
-    .battery-status.charging {
-        color: var(--primary-color);
-        border-color: rgba(33, 150, 243, 0.35);
-        background: rgba(33, 150, 243, 0.08);
-    }
-
-    .battery-status.low {
-        color: #8a4f00;
-        border-color: rgba(255, 152, 0, 0.35);
-        background: rgba(255, 152, 0, 0.12);
-    }
-
-    .battery-status.critical {
-        color: #8f130c;
-        border-color: rgba(244, 67, 54, 0.35);
-        background: rgba(244, 67, 54, 0.12);
-    }
-
-    .charging-icon {
-        display: inline-block;
-        animation: pulse 2s infinite;
-    }
-
-    @keyframes charging-pulse {
-        0%, 100% { opacity: 1; }
-        50% { opacity: 0.6; }
-    }
-
-    .battery-fill.charging {
-        background: var(--primary-color);
-        animation: charging-pulse 2s infinite;
-    }
-
-    @media (max-width: 480px) {
-        .battery-card .card-body {
-            padding: calc(var(--spacing) * 0.85);
-        }
-
-        .battery-indicator {
-            min-height: 40vh;
-            align-content: center;
-            gap: calc(var(--spacing) * 1.1);
-            padding: calc(var(--spacing) * 1.1);
-        }
-
-        .battery-topline {
-            flex-direction: column;
-            align-items: flex-start;
-            gap: calc(var(--spacing) * 0.4);
-        }
-
-        .battery-percentage {
-            font-size: clamp(3.2rem, 18vw, 5.2rem);
-        }
-
-        .battery-meter {
-            height: 42px;
-        }
-
-        .battery-voltage {
-            font-size: 1.2em;
-        }
-
-        .battery-status {
-            font-size: 0.95em;
-            padding: calc(var(--spacing) * 0.3) calc(var(--spacing) * 0.75);
-        }
-    }
-)";
+    <meta name="theme-color" content="#2196F3">)";
 
 const char WiFiManager::HTML_FOOTER[] PROGMEM = R"(
     </body>
 </html>)";
 
-const char WiFiManager::JAVASCRIPT_CODE[] PROGMEM = R"(
-    function updateTuningValue() {
-        const element = document.getElementById('currentTuning');
-        if (!element) return;
-        
-        fetch('/tuning')
-            .then(response => response.json())
-            .then(data => {
-                element.textContent = data.value;
-            })
-            .catch(error => console.error('Error fetching tuning value:', error));
-    }
-
-    function setFrequency(stationIndex) {
-        fetch('/tuning')
-            .then(response => response.json())
-            .then(data => {
-                const display = document.getElementById('freq_' + stationIndex);
-                if (display) {
-                    display.textContent = data.value;
-                    display.style.backgroundColor = 'var(--success-color)';
-                    display.style.color = 'white';
-                    setTimeout(() => {
-                        display.style.backgroundColor = '';
-                        display.style.color = '';
-                    }, 500);
-                    
-                    // Save the frequency immediately
-                    saveFrequency(stationIndex, data.value);
-                }
-            })
-            .catch(error => console.error('Error setting frequency:', error));
-    }
-
-    function saveFrequency(stationIndex, frequency) {
-        const data = {
-            station: parseInt(stationIndex),
-            frequency: parseInt(frequency)
-        };
-
-        fetch('/save-frequency', {
-            method: 'POST',
-            headers: {
-                'Content-Type': 'application/json',
-            },
-            body: JSON.stringify(data)
-        })
-        .then(response => response.json())
-        .then(data => {
-            if (data.success) {
-                showToast('Frequency saved: ' + frequency);
-            } else {
-                showToast('Failed to save frequency', true);
-            }
-        })
-        .catch(error => {
-            console.error('Error:', error);
-            showToast('Error saving frequency', true);
-        });
-    }
-
-    function showToast(message, isError = false) {
-        const toast = document.createElement('div');
-        toast.className = 'toast' + (isError ? ' error' : '');
-        toast.textContent = message;
-        document.body.appendChild(toast);
-        
-        // Trigger reflow to ensure animation works
-        toast.offsetHeight;
-        toast.classList.add('show');
-        
-        setTimeout(() => {
-            toast.classList.remove('show');
-            setTimeout(() => toast.remove(), 300);
-        }, 3000);
-    }
-
-    function handleFormSubmit(event) {
-        event.preventDefault();
-        const form = event.target;
-        // Look for submit button inside form first, then outside (for floating button)
-        let submitButton = form.querySelector('button[type="submit"]');
-        if (!submitButton) {
-            submitButton = document.querySelector('button[form="' + form.id + '"]');
-        }
-        
-        // Disable button and show saving state
-        if (submitButton) {
-            submitButton.disabled = true;
-            submitButton.classList.add('saving');
-        }
-        
-        // Collect form data into a structured object
-        const stations = [];
-        const stationData = {};
-        
-        // First pass: collect all inputs
-        form.querySelectorAll('input').forEach(input => {
-            const match = input.name.match(/(freq|msg|enable)_(\d+)/);
-            if (match) {
-                const [, type, index] = match;
-                if (!stationData[index]) {
-                    stationData[index] = { index: parseInt(index) };
-                }
-                
-                if (type === 'freq') {
-                    stationData[index].frequency = parseInt(input.value);
-                } else if (type === 'msg') {
-                    stationData[index].message = input.value;
-                } else if (type === 'enable') {
-                    stationData[index].enabled = input.checked;
-                }
-            }
-        });
-        
-        // Convert to array and ensure enabled is set
-        for (const index in stationData) {
-            const station = stationData[index];
-            if (!('enabled' in station)) {
-                station.enabled = false;
-            }
-            stations.push(station);
-        }
-
-        // Send as JSON
-        fetch('/save', {
-            method: 'POST',
-            headers: {
-                'Content-Type': 'application/json',
-            },
-            body: JSON.stringify({ stations })
-        })
-        .then(response => response.json())
-        .then(data => {
-            showToast(data.message, !data.success);
-        })
-        .catch(error => {
-            console.error('Error:', error);
-            showToast('Error saving configuration', true);
-        })
-        .finally(() => {
-            // Re-enable button and remove saving state
-            if (submitButton) {
-                submitButton.disabled = false;
-                submitButton.classList.remove('saving');
-            }
-        });
-    }
-
-    function exportMessages() {
-        fetch('/api/messages')
-            .then(response => response.json())
-            .then(data => {
-                // Create a blob from the JSON data
-                const blob = new Blob([JSON.stringify(data, null, 2)], { type: 'application/json' });
-                const url = URL.createObjectURL(blob);
-                
-                // Create a temporary link and trigger download
-                const a = document.createElement('a');
-                a.href = url;
-                a.download = 'radio-messages-' + new Date().toISOString().split('T')[0] + '.json';
-                document.body.appendChild(a);
-                a.click();
-                
-                // Clean up
-                document.body.removeChild(a);
-                URL.revokeObjectURL(url);
-                
-                showToast('Messages exported successfully');
-            })
-            .catch(error => {
-                console.error('Error exporting messages:', error);
-                showToast('Error exporting messages', true);
-            });
-    }
-
-    function importMessages() {
-        const input = document.getElementById('importFile');
-        if (!input || !input.files || input.files.length === 0) {
-            showToast('Please select a file to import', true);
-            return;
-        }
-
-        const file = input.files[0];
-        const reader = new FileReader();
-
-        reader.onload = function(e) {
-            try {
-                const jsonData = JSON.parse(e.target.result);
-                
-                fetch('/api/messages', {
-                    method: 'POST',
-                    headers: {
-                        'Content-Type': 'application/json',
-                    },
-                    body: JSON.stringify(jsonData)
-                })
-                .then(response => response.json())
-                .then(data => {
-                    if (data.success) {
-                        showToast(data.message);
-                        // Reload the page to show updated messages
-                        setTimeout(() => window.location.reload(), 1500);
-                    } else {
-                        showToast(data.message, true);
-                    }
-                })
-                .catch(error => {
-                    console.error('Error importing messages:', error);
-                    showToast('Error importing messages', true);
-                });
-            } catch (error) {
-                console.error('Error parsing JSON:', error);
-                showToast('Invalid JSON file', true);
-            }
-        };
-
-        reader.onerror = function() {
-            showToast('Error reading file', true);
-        };
-
-        reader.readAsText(file);
-    }
-
-    function triggerFileInput() {
-        const input = document.getElementById('importFile');
-        if (input) {
-            input.click();
-        }
-    }
-
-    // Update tuning value every 500ms
-    setInterval(updateTuningValue, 500);
-
-    // Add form submit handler
-    document.addEventListener('DOMContentLoaded', () => {
-        const form = document.querySelector('form');
-        if (form) {
-            form.addEventListener('submit', handleFormSubmit);
-        }
-        
-        // Add import file input change handler
-        const importInput = document.getElementById('importFile');
-        if (importInput) {
-            importInput.addEventListener('change', importMessages);
-        }
-    });
-)";
-
 void WiFiManager::begin() {
   pinMode(Pins::WIFI_BUTTON, INPUT_PULLUP);
   pinMode(Pins::SW_LED, OUTPUT);
@@ -990,6 +144,51 @@ void WiFiManager::begin() {
   esp_timer_create(&timer_config, &timer);
 }
 
+bool WiFiManager::startTask() {
+  if (task != nullptr) return true;
+
+  BaseType_t taskResult = xTaskCreatePinnedToCore(WiFiManager::taskEntry, "network_ui",
+                                                   NETWORK_TASK_STACK, this, NETWORK_TASK_PRIORITY,
+                                                   &task, NETWORK_TASK_CORE);
+  if (taskResult != pdPASS) {
+    task = nullptr;
+    return false;
+  }
+  return true;
+}
+
+void WiFiManager::taskEntry(void* parameter) { static_cast<WiFiManager*>(parameter)->runTask(); }
+
+void WiFiManager::runTask() {
+  auto& persistence = PersistenceService::getInstance();
+  for (;;) {
+    service();
+
+    // Poll the web server while WiFi is on; otherwise sleep until a toggle or a settings write
+    unsigned long wait = wifiEnabled.load() ? NETWORK_POLL_INTERVAL
+                                            : persistence.msUntilFlush(millis());
+    ulTaskNotifyTake(pdTRUE, pdMS_TO_TICKS(max(wait, 1UL)));
+  }
+}
+
+void WiFiManager::service() {
+  // Cleared only once the toggle is done, so the radio stays paused throughout
+  if (toggleRequested.load()) {
+    toggle();
+    toggleRequested.store(false);
+  }
+
+  PersistenceService::getInstance().update();
+  handle();
+}
+
+void WiFiManager::requestToggle() {
+  toggleRequested.store(true);
+  if (task != nullptr) {
+    xTaskNotifyGive(task);
+  }
+}
+
 void WiFiManager::toggle() {
   PowerManager::getInstance().resetActivityTimer(wifiEnabled ? "WiFi Disabled" : "WiFi Enabled");
   if (wifiEnabled) {
@@ -1001,15 +200,18 @@ void WiFiManager::toggle() {
 
 void WiFiManager::stop() {
   if (wifiEnabled) {
+    for (auto& events : eventClients) {
+      events.client.stop();
+    }
     server.stop();
     WiFi.softAPdisconnect(true);
     WiFi.mode(WIFI_OFF);
-    wifiEnabled = false;
     digitalWrite(Pins::SW_LED, LOW);
-    
-    // Restore the wave band LED state
-    WaveBandManager::getInstance().updateLEDs();
-    
+
+    // The real-time task restores the wave band LEDs once it sees WiFi is off
+    wifiEnabled = false;
+    LoopWaker::getInstance().setAwake(LoopWaker::Holder::WIFI, false);
+
 #ifdef DEBUG_SERIAL_OUTPUT
     Serial.println(F("WiFi stopped"));
 #endif
@@ -1017,13 +219,8 @@ void WiFiManager::stop() {
 }
 
 void WiFiManager::startAP() {
-  // Stop morse radio functionality when WiFi starts
-  AudioManager::getInstance().stop();
-  MorseCode::getInstance().stop();
-  
-  // Turn off all wave band LEDs (we'll repurpose SW_LED for WiFi status)
-  WaveBandManager::getInstance().turnOffAllBandLEDs();
-  
+  // The real-time task has already silenced the radio and turned off the wave band
+  // LEDs (SW_LED is repurposed for WiFi status) before requesting the toggle
   WiFi.mode(WIFI_AP);
 
   const char* ssid = "MorseRadio";
@@ -1033,6 +230,7 @@ void WiFiManager::startAP() {
     setupMDNS();
 
     wifiEnabled = true;
+    LoopWaker::getInstance().setAwake(LoopWaker::Holder::WIFI, true);
     startTime = millis();
     lastLedFlash = millis();
 
@@ -1059,9 +257,11 @@ void WiFiManager::startAP() {
 
 void WiFiManager::handle() {
   if (!wifiEnabled) return;
+  PERF_SCOPE(Perf::Probe::WIFI_HANDLE);
 
   server.handleClient();
   ElegantOTA.loop();
+  pushTelemetry();
 
   // WiFi does not auto-timeout - user must manually toggle it off
   // (The device itself has a separate inactivity timeout for deep sleep)
@@ -1079,19 +279,38 @@ void WiFiManager::handle() {
 }
 
 void WiFiManager::setupServer() {
-  server.on("/", HTTP_GET, [this]() { handleRoot(); });
-  server.on("/stations", HTTP_GET, [this]() { handleStationConfig(); });
-  server.on("/calibration", HTTP_GET, [this]() { handleCalibration(); });
-  server.on("/settings", HTTP_GET, [this]() { handleSettings(); });
-  server.on("/save", HTTP_POST, [this]() { handleSaveConfig(); });
-  server.on("/save-frequency", HTTP_POST, [this]() { handleSaveFrequency(); });
-  server.on("/save-settings", HTTP_POST, [this]() { handleSaveSettings(); });
-  server.on("/tuning", HTTP_GET, [this]() { handleGetTuningValue(); });
-  server.on("/api/status", HTTP_GET, [this]() { handleAPI(); });
-  server.on("/api/battery", HTTP_GET, [this]() { handleBatteryStatus(); });
-  server.on("/api/messages", HTTP_GET, [this]() { handleExportMessages(); });
-  server.on("/api/messages", HTTP_POST, [this]() { handleImportMessages(); });
-  server.onNotFound([this]() { handleNotFound(); });
+  on("/", HTTP_GET, &WiFiManager::handleRoot);
+  on("/stations", HTTP_GET, &WiFiManager::handleStationConfig);
+  on("/calibration", HTTP_GET, &WiFiManager::handleCalibration);
+  on("/settings", HTTP_GET, &WiFiManager::handleSettings);
+  onStations("/save", &WiFiManager::handleSaveConfig, StationImport::Mode::CONFIG);
+  onBody("/save-frequency", &WiFiManager::handleSaveFrequency);
+  onBody("/save-settings", &WiFiManager::handleSaveSettings);
+  on("/tuning", HTTP_GET, &WiFiManager::handleGetTuningValue);
+  on("/api/status", HTTP_GET, &WiFiManager::handleAPI);
+  on("/api/battery", HTTP_GET, &WiFiManager::handleBatteryStatus);
+  on("/events", HTTP_GET, &WiFiManager::handleEvents);
+#ifdef PERF_PROBES
+  on("/api/perf", HTTP_GET, &WiFiManager::handlePerf);
+#endif
+  on("/api/messages", HTTP_GET, &WiFiManager::handleExportMessages);
+  onStations("/api/messages", &WiFiManager::handleImportMessages, StationImport::Mode::MESSAGES);
+  onBody("/api/stations/add", &WiFiManager::handleAddStation);
+  onBody("/api/stations/remove", &WiFiManager::handleRemoveStation);
+  for (const auto& asset : WebAssets::ASSETS) {
+    server.on(String(ASSET_PATH) + asset.name, HTTP_GET, [this, &asset]() {
+      PERF_SCOPE(Perf::Probe::WEB_REQUEST);
+      handleAsset(asset);
+    });
+  }
+  server.onNotFound([this]() {
+    PERF_SCOPE(Perf::Probe::WEB_REQUEST);
+    handleNotFound();
+  });
+
+  // Only the revalidation header is needed from requests
+  static const char* collectedHeaders[] = {"If-None-Match"};
+  server.collectHeaders(collectedHeaders, 1);
 
   // Add OTA event handlers
   ElegantOTA.onStart([this]() {
@@ -1100,7 +319,7 @@ void WiFiManager::setupServer() {
 #endif
     // Stop all tasks that might interfere with the update
     PowerManager::getInstance().stopLEDTask();
-    StationManager::getInstance().saveToPreferences();  // Save current state
+    PersistenceService::getInstance().flush();  // Write queued edits before the reboot
 
     // Stop audio and other tasks
     AudioManager::getInstance().stop();
@@ -1122,6 +341,56 @@ void WiFiManager::setupServer() {
   server.begin();
 }
 
+void WiFiManager::on(const char* uri, HTTPMethod method, Handler handler) {
+  server.on(uri, method, [this, handler]() {
+    PERF_SCOPE(Perf::Probe::WEB_REQUEST);
+    (this->*handler)();
+  });
+}
+
+void WiFiManager::onBody(const char* uri, Handler handler) {
+  server.on(
+      uri, HTTP_POST,
+      [this, handler]() {
+        PERF_SCOPE(Perf::Probe::WEB_REQUEST);
+        if (requestBody.isTooLarge()) {
+          server.send(413, "application/json",
+                      "{\"success\":false,\"message\":\"Request too large\"}");
+        } else {
+          (this->*handler)();
+        }
+        requestBody.begin();  // A form-encoded request next must not see this body
+      },
+      [this]() { receiveBody(); });
+}
+
+void WiFiManager::onStations(const char* uri, Handler handler, StationImport::Mode mode) {
+  server.on(
+      uri, HTTP_POST,
+      [this, handler]() {
+        PERF_SCOPE(Perf::Probe::WEB_REQUEST);
+        (this->*handler)();
+      },
+      [this, mode]() { receiveStations(mode); });
+}
+
+// The server calls this for each piece of a non-form body as it reads it, in
+// place of collecting the whole body as the "plain" argument
+void WiFiManager::receiveBody() {
+  HTTPRaw& raw = server.raw();
+  switch (raw.status) {
+    case RAW_START:
+    case RAW_ABORTED:
+      requestBody.begin();
+      break;
+    case RAW_WRITE:
+      requestBody.append(raw.buf, raw.currentSize);
+      break;
+    default:
+      break;
+  }
+}
+
 void WiFiManager::setupMDNS() {
   if (MDNS.begin(hostname.c_str())) {
     MDNS.addService("http", "tcp", 80);
@@ -1133,26 +402,38 @@ void WiFiManager::setupMDNS() {
 
 void WiFiManager::handleRoot() { 
   PowerManager::getInstance().resetActivityTimer("Web Interface - Home Page Viewed");
-  server.send(200, "text/html", generateHTML(generateHomePage())); 
+  sendPage(&WiFiManager::writeHomePage);
 }
 
 void WiFiManager::handleStationConfig() {
   PowerManager::getInstance().resetActivityTimer("Web Interface - Station Config Viewed");
-  server.send(200, "text/html", generateHTML(generateStationPage()));
+  sendPage(&WiFiManager::writeStationPage);
 }
 
 void WiFiManager::handleCalibration() {
   PowerManager::getInstance().resetActivityTimer("Web Interface - Calibration Viewed");
-  server.send(200, "text/html", generateHTML(generateCalibrationPage()));
+  sendPage(&WiFiManager::writeCalibrationPage);
 }
 
 void WiFiManager::handleSettings() {
   PowerManager::getInstance().resetActivityTimer("Web Interface - Settings Viewed");
-  server.send(200, "text/html", generateHTML(generateSettingsPage()));
+  sendPage(&WiFiManager::writeSettingsPage);
+}
+
+void WiFiManager::handleAsset(const WebAssets::Asset& asset) {
+  server.sendHeader(F("Cache-Control"), F("public, max-age=31536000, immutable"));
+  server.sendHeader(F("ETag"), asset.etag);
+  if (server.header(F("If-None-Match")) == asset.etag) {
+    server.send(304);
+    return;
+  }
+  server.sendHeader(F("Content-Encoding"), F("gzip"));
+  server.send_P(200, asset.contentType, reinterpret_cast<PGM_P>(asset.gzipped), asset.size);
 }
 
 void WiFiManager::handleGetTuningValue() {
-  int tuningValue = PowerManager::getInstance().readADCRaw(Pins::TUNING_POT);
+  // Published by the real-time task, which owns the pot readers
+  int tuningValue = RadioState::getInstance().getTuning().displayValue;
   String response = "{\"value\":" + String(tuningValue) + "}";
   server.send(200, "application/json", response);
   startTime = millis();  // Reset the timeout counter
@@ -1160,14 +441,13 @@ void WiFiManager::handleGetTuningValue() {
 }
 
 void WiFiManager::handleSaveFrequency() {
-  String jsonData = server.arg("plain");
-
 #ifdef DEBUG_SERIAL_OUTPUT
-  Serial.println("Received frequency data: " + jsonData);
+  Serial.print("Received frequency data: ");
+  Serial.println(requestBody.c_str());
 #endif
 
   JsonDocument doc;
-  DeserializationError error = deserializeJson(doc, jsonData);
+  DeserializationError error = deserializeJson(doc, requestBody.c_str(), requestBody.size());
 
   if (error) {
 #ifdef DEBUG_SERIAL_OUTPUT
@@ -1199,14 +479,13 @@ void WiFiManager::handleSaveFrequency() {
 }
 
 void WiFiManager::handleSaveSettings() {
-  String jsonData = server.arg("plain");
-
 #ifdef DEBUG_SERIAL_OUTPUT
-  Serial.println("Received settings data: " + jsonData);
+  Serial.print("Received settings data: ");
+  Serial.println(requestBody.c_str());
 #endif
 
   JsonDocument doc;
-  DeserializationError error = deserializeJson(doc, jsonData);
+  DeserializationError error = deserializeJson(doc, requestBody.c_str(), requestBody.size());
 
   if (error) {
 #ifdef DEBUG_SERIAL_OUTPUT
@@ -1220,7 +499,7 @@ void WiFiManager::handleSaveSettings() {
   
   auto& configManager = ConfigManager::getInstance();
   configManager.setInactivityTimeout(timeout);
-  configManager.save();
+  PersistenceService::getInstance().markDirty(PersistenceService::Store::CONFIG);
 
 #ifdef DEBUG_SERIAL_OUTPUT
   Serial.printf("Updated device inactivity timeout to %d minutes\n", timeout);
@@ -1231,85 +510,25 @@ void WiFiManager::handleSaveSettings() {
 }
 
 void WiFiManager::handleSaveConfig() {
-  bool success = true;
-  String message = "Configuration saved successfully";
-
-  // Get the raw POST data
-  String jsonData = server.arg("plain");
-
-#ifdef DEBUG_SERIAL_OUTPUT
-  Serial.println("Received JSON data: " + jsonData);
-#endif
-
-  // Parse JSON using ArduinoJson
-  JsonDocument doc;  // No capacity needed in v7
-  DeserializationError error = deserializeJson(doc, jsonData);
+  StationImport::Result result = stationImport.apply();
 
-  if (error) {
+  if (!result.complete || !result.foundArray ||
+      (result.failure != nullptr && result.failedIndex < 0)) {
 #ifdef DEBUG_SERIAL_OUTPUT
-    Serial.println("Failed to parse JSON: ");
-    Serial.println(error.c_str());
+    Serial.println("Failed to parse JSON");
 #endif
     server.send(400, "application/json", "{\"success\":false,\"message\":\"Invalid JSON format\"}");
     return;
   }
-
-  // Get the stations array
-  JsonArray stations = doc["stations"];
-  if (stations.isNull()) {
-#ifdef DEBUG_SERIAL_OUTPUT
-    Serial.println("No stations array in JSON");
-#endif
-    server.send(400, "application/json", "{\"success\":false,\"message\":\"Invalid JSON format\"}");
+  if (result.skipped > 0) {
+    server.send(413, "application/json", "{\"success\":false,\"message\":\"Request too large\"}");
     return;
   }
 
-  auto& stationManager = StationManager::getInstance();
-
-  // Process each station
-  for (JsonObject station : stations) {
-    int index = station["index"].as<int>();
-    int frequency = station["frequency"].as<int>();
-    const char* stationMessage = station["message"].as<const char*>();
-    bool enabled = station["enabled"].as<bool>();
-
-#ifdef DEBUG_SERIAL_OUTPUT
-    Serial.printf("Processing station - Index: %d, Frequency: %d, Message: %s, Enabled: %s\n",
-                  index, frequency, stationMessage, enabled ? "true" : "false");
-#endif
-
-    if (frequency > 0) {
-      Station* stationToUpdate = stationManager.getStation(index);
-      if (stationToUpdate == nullptr || stationMessage == nullptr) {
-        success = false;
-        message = "Invalid station data for station " + String(index);
-        break;
-      }
-
-      stationToUpdate->setFrequency(frequency);
-      stationToUpdate->setMessage(stationMessage);
-      stationToUpdate->setEnabled(enabled);
-#ifdef DEBUG_SERIAL_OUTPUT
-      Serial.printf("Updated station %d\n", index);
-#endif
-    } else {
-#ifdef DEBUG_SERIAL_OUTPUT
-      Serial.printf("Invalid frequency value for station %d: %d\n", index, frequency);
-#endif
-      success = false;
-      message = "Invalid frequency value for station " + String(index);
-      break;
-    }
-  }
-
+  bool success = result.failure == nullptr;
+  String message = success ? String("Configuration saved successfully")
+                           : String(result.failure) + String(result.failedIndex);
   if (success) {
-#ifdef DEBUG_SERIAL_OUTPUT
-    Serial.println("Saving to preferences...");
-#endif
-    stationManager.saveToPreferences();
-#ifdef DEBUG_SERIAL_OUTPUT
-    Serial.println("Successfully saved to preferences");
-#endif
     PowerManager::getInstance().resetActivityTimer("Web Interface - Config Saved");
   }
 
@@ -1328,10 +547,7 @@ void WiFiManager::handleSaveConfig() {
   server.send(200, "application/json", responseStr);
 }
 
-String WiFiManager::generateHomePage() const {
-  String html;
-  html.reserve(1024);
-
+void WiFiManager::writeHomePage(HtmlStream& html) const {
   html += F("<div class='container'>");
   html += F("<div class='header'>");
   html += F("<h1>Radio Configuration</h1>");
@@ -1363,13 +579,9 @@ String WiFiManager::generateHomePage() const {
   html += F("</div>");
 
   html += F("</div>");
-  return html;
 }
 
-String WiFiManager::generateStationPage() const {
-  String html;
-  html.reserve(4096);
-
+void WiFiManager::writeStationPage(HtmlStream& html) const {
   html += F("<div class='container'>");
   html += F("<div class='header'>");
   html += F("<h1>Station Configuration</h1>");
@@ -1383,7 +595,7 @@ String WiFiManager::generateStationPage() const {
   html += F("</div>");
 
   html += F("<form method='POST' action='/save' id='stationForm'>");
-  html += generateStationList();
+  writeStationList(html);
   
   html += F("<div class='import-export-section'>");
   html += F("<h2>Import / Export</h2>");
@@ -1404,100 +616,13 @@ String WiFiManager::generateStationPage() const {
         "Messages</button>");
   html += F("</div>");
   html += F("</div>");
-
-  return html;
 }
 
-String WiFiManager::generateStationList() const {
-  String html;
-  auto& stationManager = StationManager::getInstance();
-
-  // Initialize sections for each wave band
-  String longWaveHtml = F("<div class='wave-band long-wave'><h2>Long Wave</h2>");
-  String mediumWaveHtml = F("<div class='wave-band medium-wave'><h2>Medium Wave</h2>");
-  String shortWaveHtml = F("<div class='wave-band short-wave'><h2>Short Wave</h2>");
-
-  // Track if each band has stations
-  bool hasLongWave = false;
-  bool hasMediumWave = false;
-  bool hasShortWave = false;
-
-  // Generate stations for each band
-  for (size_t i = 0; i < stationManager.getStationCount(); i++) {
-    const Station* station = stationManager.getStation(i);
-    if (!station) continue;
-
-    String stationHtml = F("<div class='station'>");
-    stationHtml += F("<div class='station-header'>");
-    stationHtml += F("<div class='station-name'>");
-    stationHtml += String(station->getName());
-    stationHtml += F("</div>");
-    stationHtml += F("<div class='toggle'>");
-    stationHtml += F("<input type='checkbox' id='enable_");
-    stationHtml += String(i);
-    stationHtml += F("' name='enable_");
-    stationHtml += String(i);
-    stationHtml += F("' ");
-    stationHtml += station->isEnabled() ? F("checked") : F("");
-    stationHtml += F(">");
-    stationHtml += F("<label for='enable_");
-    stationHtml += String(i);
-    stationHtml += F("'>Enabled</label>");
-    stationHtml += F("</div>");
-    stationHtml += F("</div>");
-
-    stationHtml += F("<div class='station-body'>");
-    stationHtml += F("<div class='form-group'>");
-    stationHtml += F("<label>Message</label>");
-    stationHtml += F("<input type='text' name='msg_");
-    stationHtml += String(i);
-    stationHtml += F("' value='");
-    stationHtml += String(station->getMessage());
-    stationHtml += F("' placeholder='Enter your morse code message'>");
-    stationHtml += F("</div>");
-    stationHtml += F("<!-- Hidden frequency input to maintain save functionality -->");
-    stationHtml += F("<input type='hidden' name='freq_");
-    stationHtml += String(i);
-    stationHtml += F("' value='");
-    stationHtml += String(station->getFrequency());
-    stationHtml += F("'>");
-    stationHtml += F("</div>");
-    stationHtml += F("</div>");
-
-    // Add to the appropriate band
-    switch (station->getBand()) {
-      case WaveBand::LONG_WAVE:
-        longWaveHtml += stationHtml;
-        hasLongWave = true;
-        break;
-      case WaveBand::MEDIUM_WAVE:
-        mediumWaveHtml += stationHtml;
-        hasMediumWave = true;
-        break;
-      case WaveBand::SHORT_WAVE:
-        shortWaveHtml += stationHtml;
-        hasShortWave = true;
-        break;
-    }
-  }
-
-  // Close wave band divs
-  longWaveHtml += F("</div>");
-  mediumWaveHtml += F("</div>");
-  shortWaveHtml += F("</div>");
-
-  // Add each section to the final HTML if it has stations
-  if (hasLongWave) html += longWaveHtml;
-  if (hasMediumWave) html += mediumWaveHtml;
-  if (hasShortWave) html += shortWaveHtml;
-
-  return html;
+void WiFiManager::writeStationList(HtmlStream& html) const {
+  writeBandSections(html, false, &writeStationRow);
 }
 
-String WiFiManager::generateCalibrationPage() const {
-  String html;
-  html.reserve(4096);
-
+void WiFiManager::writeCalibrationPage(HtmlStream& html) const {
   html += F("<div class='container'>");
   html += F("<div class='header'>");
   html += F("<h1>Station Tuning</h1>");
@@ -1519,75 +644,13 @@ String WiFiManager::generateCalibrationPage() const {
   html += F("<div class='text-muted'>Current Potentiometer Reading</div>");
   html += F("</div>");
 
-  // Generate station list for calibration
-  auto& stationManager = StationManager::getInstance();
-
-  // Initialize sections for each wave band
-  String longWaveHtml = F("<div class='wave-band long-wave'><h2>Long Wave</h2>");
-  String mediumWaveHtml = F("<div class='wave-band medium-wave'><h2>Medium Wave</h2>");
-  String shortWaveHtml = F("<div class='wave-band short-wave'><h2>Short Wave</h2>");
-
-  bool hasLongWave = false;
-  bool hasMediumWave = false;
-  bool hasShortWave = false;
-
-  for (size_t i = 0; i < stationManager.getStationCount(); i++) {
-    const Station* station = stationManager.getStation(i);
-    if (!station || !station->isEnabled()) continue;
-
-    String stationHtml = F("<div class='station tuning-station'>");
-    stationHtml += F("<div class='station-header'>");
-    stationHtml += F("<div class='station-name'>");
-    stationHtml += String(station->getName());
-    stationHtml += F("</div>");
-    stationHtml += F("<div class='tuning-controls'>");
-    stationHtml += F("<span class='frequency-display' id='freq_");
-    stationHtml += String(i);
-    stationHtml += F("'>");
-    stationHtml += String(station->getFrequency());
-    stationHtml += F("</span>");
-    stationHtml += F("<button type='button' class='btn-set' onclick='setFrequency(");
-    stationHtml += String(i);
-    stationHtml += F(")'>Set</button>");
-    stationHtml += F("</div>");
-    stationHtml += F("</div>");
-    stationHtml += F("</div>");
-
-    // Add to the appropriate band
-    switch (station->getBand()) {
-      case WaveBand::LONG_WAVE:
-        longWaveHtml += stationHtml;
-        hasLongWave = true;
-        break;
-      case WaveBand::MEDIUM_WAVE:
-        mediumWaveHtml += stationHtml;
-        hasMediumWave = true;
-        break;
-      case WaveBand::SHORT_WAVE:
-        shortWaveHtml += stationHtml;
-        hasShortWave = true;
-        break;
-    }
-  }
-
-  // Close wave band divs
-  longWaveHtml += F("</div>");
-  mediumWaveHtml += F("</div>");
-  shortWaveHtml += F("</div>");
-
-  // Add each section to the final HTML if it has stations
-  if (hasLongWave) html += longWaveHtml;
-  if (hasMediumWave) html += mediumWaveHtml;
-  if (hasShortWave) html += shortWaveHtml;
+  // Only enabled stations can be tuned
+  writeBandSections(html, true, &writeTuningRow);
 
   html += F("</div>");
-  return html;
 }
 
-String WiFiManager::generateSettingsPage() const {
-  String html;
-  html.reserve(2048);
-
+void WiFiManager::writeSettingsPage(HtmlStream& html) const {
   html += F("<div class='container'>");
   html += F("<div class='header'>");
   html += F("<h1>Settings</h1>");
@@ -1645,10 +708,7 @@ String WiFiManager::generateSettingsPage() const {
   html += F("</div>");
 
   html += F("<script>");
-  html += F("function updateBatteryStatus() {");
-  html += F("  fetch('/api/battery')");
-  html += F("    .then(response => response.json())");
-  html += F("    .then(data => {");
+  html += F("function showBatteryStatus(data) {");
   html += F("      const fillElement = document.getElementById('batteryFill');");
   html += F("      const percentageElement = document.getElementById('batteryPercentage');");
   html += F("      const voltageElement = document.getElementById('batteryVoltage');");
@@ -1684,8 +744,6 @@ String WiFiManager::generateSettingsPage() const {
   html += F("          }");
   html += F("        }");
   html += F("      }");
-  html += F("    })");
-  html += F("    .catch(error => console.error('Error fetching battery status:', error));");
   html += F("}");
   html += F("");
   html += F("function saveSettings(event) {");
@@ -1720,19 +778,59 @@ String WiFiManager::generateSettingsPage() const {
   html += F("  });");
   html += F("}");
   html += F("");
-  html += F("updateBatteryStatus();");
-  html += F("setInterval(updateBatteryStatus, 5000);");
+  html += F("onTelemetry(state => { if (state.voltage !== undefined) showBatteryStatus(state); });");
   html += F("</script>");
 
   html += F("</div>");
-  return html;
 }
 
 String WiFiManager::generateStatusJson() const {
   String json = "{";
   json += "\"wifiEnabled\":" + String(wifiEnabled ? "true" : "false") + ",";
-  json += "\"uptime\":" + String((millis() - startTime) / 1000);
-  json += "}";
+  json += "\"uptime\":" + String((millis() - startTime) / 1000) + ",";
+#ifdef ADC_CONTINUOUS_SAMPLER
+  // Opt-in builds only: false when the pots fell back to analogRead
+  json += "\"potSampler\":" +
+          String(PowerManager::getInstance().arePotsSampled() ? "true" : "false") + ",";
+#endif
+
+  // Write-behind counters: requests against flushes shows how much coalescing saved
+  const auto& persist = PersistenceService::getInstance().getStats();
+  json += "\"persistence\":{";
+  json += "\"requests\":" + String(persist.requests) + ",";
+  json += "\"flushes\":" + String(persist.flushes) + ",";
+  json += "\"failures\":" + String(persist.failures) + ",";
+  json += "\"bytesWritten\":" + String(persist.bytesWritten) + ",";
+  json += "\"lastFlushUs\":" + String(persist.lastFlushMicros) + ",";
+  json += "\"maxFlushUs\":" + String(persist.maxFlushMicros) + ",";
+  json += "\"pending\":" + String(PersistenceService::getInstance().hasPending() ? "true" : "false");
+  json += "},";
+
+  // Main loop idling: blocked time against uptime is the share the CPU could sleep
+  auto& waker = LoopWaker::getInstance();
+  const auto& idle = waker.getStats();
+  json += "\"idle\":{";
+  json += "\"sleeps\":" + String(idle.sleeps) + ",";
+  json += "\"earlyWakes\":" + String(idle.earlyWakes) + ",";
+  json += "\"idleMs\":" + String(static_cast<unsigned long>(idle.idleMillis)) + ",";
+  json += "\"longestSleepMs\":" + String(idle.longestSleep) + ",";
+  // Enabled is the build and esp_pm; the time only counts waits no driver lock kept awake
+  json += "\"lightSleep\":" + String(waker.isLightSleepEnabled() ? "true" : "false") + ",";
+  json += "\"lightSleepMs\":" + String(static_cast<unsigned long>(idle.lightSleepMillis));
+  json += "},";
+
+  // Last state published by the real-time task
+  auto& radio = RadioState::getInstance();
+  RadioState::Tuning tuning = radio.getTuning();
+  json += "\"radio\":{";
+  json += "\"morsePlaying\":" + String(radio.isMorsePlaying() ? "true" : "false") + ",";
+  json += "\"toneOn\":" + String(radio.isMorseToneOn() ? "true" : "false") + ",";
+  json += "\"tuning\":" + String(tuning.tuningValue) + ",";
+  json += "\"signal\":" + String(tuning.signalStrength) + ",";
+  json += "\"station\":" + String(tuning.stationFrequency) + ",";
+  json += "\"band\":\"" + String(toString(tuning.band)) + "\",";
+  json += "\"ageMs\":" + String(millis() - tuning.updatedAt);
+  json += "}}";
   return json;
 }
 
@@ -1761,55 +859,191 @@ void WiFiManager::handleBatteryStatus() {
   server.send(200, "application/json", json);
 }
 
+void WiFiManager::handleEvents() {
+  EventClient* slot = nullptr;
+  for (auto& events : eventClients) {
+    if (!events.client.connected()) {
+      slot = &events;
+      break;
+    }
+  }
+  if (slot == nullptr) {
+    server.send(503, "text/plain", "Too many event streams");
+    return;
+  }
+
+  // ?interval=<ms> sets this stream's rate
+  unsigned long interval = TELEMETRY_INTERVAL;
+  if (server.hasArg("interval")) {
+    interval = constrain(server.arg("interval").toInt(), static_cast<long>(TELEMETRY_MIN_INTERVAL),
+                         static_cast<long>(TELEMETRY_MAX_INTERVAL));
+  }
+
+  // The stream outlives this request: keep the socket and answer on it directly
+  slot->client = server.client();
+  slot->interval = interval;
+  slot->hasSent = false;
+  static const char headers[] PROGMEM =
+      "HTTP/1.1 200 OK\r\n"
+      "Content-Type: text/event-stream\r\n"
+      "Cache-Control: no-cache\r\n"
+      "Connection: keep-alive\r\n\r\n"
+      "retry: 2000\n\n";
+  if (!sendEvent(*slot, headers, strlen_P(headers))) return;
+  slot->lastEvent = millis() - interval;  // First event on the next pass
+
+  PowerManager::getInstance().resetActivityTimer("Web Interface - Live Updates Opened");
+}
+
+void WiFiManager::pushTelemetry() {
+  unsigned long now = millis();
+  bool sampled = false;
+  char event[Telemetry::JSON_CAPACITY + 8];
+
+  for (auto& events : eventClients) {
+    if (!events.client.connected()) continue;
+    if (now - events.lastEvent < events.interval) continue;
+
+    if (!sampled) {
+      sampleTelemetry(now);
+      sampled = true;
+    }
+
+    size_t length = Telemetry::writeDelta(events.hasSent ? &events.sent : nullptr, telemetry,
+                                          event + 6, sizeof(event) - 8);
+    if (length > 0) {
+      memcpy(event, "data: ", 6);
+      memcpy(event + 6 + length, "\n\n", 2);
+      if (!sendEvent(events, event, length + 8)) continue;
+      events.sent = telemetry;
+      events.hasSent = true;
+    } else if (now - events.lastEvent >= TELEMETRY_KEEPALIVE) {
+      // A comment line finds dead sockets and keeps the radio awake while the page is open
+      if (!sendEvent(events, ":\n\n", 3)) continue;
+      PowerManager::getInstance().resetActivityTimer("Web Interface - Live Updates");
+    } else {
+      continue;
+    }
+    startTime = now;
+  }
+}
+
+void WiFiManager::sampleTelemetry(unsigned long now) {
+  RadioState::Tuning tuning = RadioState::getInstance().getTuning();
+
+  // The name follows the station in range; only looked up when that changes
+  if (tuning.stationFrequency != telemetry.stationFrequency || tuning.band != telemetry.band) {
+    telemetry.stationName[0] = '\0';
+    for (const auto& station : StationManager::getInstance().getAllStations()) {
+      if (station.getBand() == tuning.band && station.getFrequency() == tuning.stationFrequency) {
+        strlcpy(telemetry.stationName, station.getName(), sizeof(telemetry.stationName));
+        break;
+      }
+    }
+  }
+
+  telemetry.tuning = tuning.displayValue;
+  telemetry.signalStrength = tuning.signalStrength;
+  telemetry.stationFrequency = tuning.stationFrequency;
+  telemetry.band = tuning.band;
+  telemetry.speed = ConfigManager::getInstance().getMorseSpeed();
+
+  if (!batterySampled || now - lastBatterySample >= BATTERY_SAMPLE_INTERVAL) {
+    auto& power = PowerManager::getInstance();
+    telemetry.batteryCentivolts = static_cast<int>(lroundf(power.getBatteryVoltage() * 100.0f));
+    telemetry.batteryPercent = static_cast<int>(power.getBatteryPercent());
+    telemetry.charging = power.isUSBPowered();
+    lastBatterySample = now;
+    batterySampled = true;
+  }
+}
+
+bool WiFiManager::sendEvent(EventClient& events, const char* text, size_t length) {
+  // A phone that stopped reading drops its stream rather than stalling the network task
+  if (events.client.write(reinterpret_cast<const uint8_t*>(text), length) != length) {
+    events.client.stop();
+    return false;
+  }
+  events.lastEvent = millis();
+  return true;
+}
+
+#ifdef PERF_PROBES
+void WiFiManager::handlePerf() {
+  // Histograms of the loop probes; ?reset=1 starts a fresh measurement window
+  auto& perf = PerfMonitor::getInstance();
+  char json[PerfMonitor::JSON_CAPACITY];
+  if (perf.writeJson(json, sizeof(json)) == 0) {
+    server.send(500, "application/json", "{\"error\":\"perf report too large\"}");
+    return;
+  }
+  server.send(200, "application/json", json);
+  if (server.arg("reset") == "1") {
+    perf.reset();
+  }
+}
+#endif
+
 void WiFiManager::handleExportMessages() {
   auto& stationManager = StationManager::getInstance();
-  JsonDocument doc;
-  JsonArray stations = doc["stations"].to<JsonArray>();
+  HtmlStream json(server, "application/json");
+  json += F("{\"stations\":[");
 
+  bool first = true;
   for (size_t i = 0; i < stationManager.getStationCount(); i++) {
     const Station* station = stationManager.getStation(i);
     if (!station) continue;
-
-    JsonObject stationObj = stations.add<JsonObject>();
-    stationObj["index"] = i;
-    stationObj["name"] = station->getName();
-    stationObj["message"] = station->getMessage();
-    stationObj["enabled"] = station->isEnabled();
-
-    // Add wave band as string for readability
-    switch (station->getBand()) {
-      case WaveBand::LONG_WAVE:
-        stationObj["band"] = "LONG_WAVE";
-        break;
-      case WaveBand::MEDIUM_WAVE:
-        stationObj["band"] = "MEDIUM_WAVE";
-        break;
-      case WaveBand::SHORT_WAVE:
-        stationObj["band"] = "SHORT_WAVE";
-        break;
+    if (!writeStationRecord(json, i, *station, first)) {
+#ifdef DEBUG_SERIAL_OUTPUT
+      Serial.printf("Station %u too long to export\n", static_cast<unsigned>(i));
+#endif
+      continue;
     }
+    first = false;
   }
 
-  String response;
-  serializeJson(doc, response);
-  server.send(200, "application/json", response);
+  json += F("]}");
+  json.end();
 
 #ifdef DEBUG_SERIAL_OUTPUT
-  Serial.println("Exported messages: " + response);
+  Serial.printf("Exported messages: %u bytes\n", static_cast<unsigned>(json.getBytesSent()));
 #endif
 }
 
-void WiFiManager::handleImportMessages() {
-  String jsonData = server.arg("plain");
+// Called by the server for each piece of a {"stations":[...]} body as it is read. Stations
+// are parsed as their object closes but only staged; the route's handler applies them
+// once the body has ended whole.
+void WiFiManager::receiveStations(StationImport::Mode mode) {
+  HTTPRaw& raw = server.raw();
+  switch (raw.status) {
+    case RAW_START:
+      stationImport.begin(mode);
+      break;
+    case RAW_WRITE:
+      stationImport.feed(reinterpret_cast<const char*>(raw.buf), raw.currentSize);
+      break;
+    case RAW_ABORTED:
+      // The route's handler never runs for a body that broke off, so answer here
+      stationImport.begin(mode);
+      server.send(400, "application/json",
+                  "{\"success\":false,\"message\":\"Request body incomplete, nothing changed\"}");
+      break;
+    default:
+      break;
+  }
+}
 
+void WiFiManager::handleImportMessages() {
+  // Nothing is applied unless the body closed properly
+  StationImport::Result result = stationImport.apply();
+  int imported = static_cast<int>(result.applied);
 #ifdef DEBUG_SERIAL_OUTPUT
-  Serial.println("Received import data: " + jsonData);
+  if (result.skipped > 0) {
+    Serial.printf("Skipped %u invalid or oversized stations\n", static_cast<unsigned>(result.skipped));
+  }
 #endif
 
-  JsonDocument doc;
-  DeserializationError error = deserializeJson(doc, jsonData);
-
-  if (error) {
+  if (!result.complete) {
 #ifdef DEBUG_SERIAL_OUTPUT
     Serial.println("Failed to parse import JSON");
 #endif
@@ -1817,61 +1051,104 @@ void WiFiManager::handleImportMessages() {
     return;
   }
 
-  auto& stationManager = StationManager::getInstance();
-  JsonArray stations = doc["stations"];
-  
-  if (!stations) {
+  if (!result.foundArray) {
     server.send(400, "application/json", "{\"success\":false,\"message\":\"No stations array found\"}");
     return;
   }
 
   bool success = true;
-  String message = "Messages imported successfully";
-  int importedCount = 0;
+  String message;
+  if (imported > 0) {
+    message = String(imported) + " messages imported successfully";
+  } else {
+    success = false;
+    message = "No valid messages found to import";
+  }
 
-  for (JsonObject stationObj : stations) {
-    if (!stationObj["index"].is<int>() || !stationObj["message"].is<const char*>()) {
-      continue;
-    }
+  JsonDocument response;
+  response["success"] = success;
+  response["message"] = message;
+
+  String responseStr;
+  serializeJson(response, responseStr);
+  server.send(200, "application/json", responseStr);
+}
 
-    int index = stationObj["index"];
-    Station* station = stationManager.getStation(index);
+void WiFiManager::handleAddStation() {
+  JsonDocument doc;
+  DeserializationError error = deserializeJson(doc, requestBody.c_str(), requestBody.size());
 
-    if (station) {
-      const char* newMessage = stationObj["message"].as<const char*>();
-      if (newMessage == nullptr) {
-        continue;
-      }
-      station->setMessage(newMessage);
-      
-      if (stationObj["enabled"].is<bool>()) {
-        station->setEnabled(stationObj["enabled"]);
-      }
-      
-      importedCount++;
+  if (error) {
+    server.send(400, "application/json", "{\"success\":false,\"message\":\"Invalid JSON\"}");
+    return;
+  }
+
+  const char* name = doc["name"].as<const char*>();
+  const char* stationMessage = doc["message"].as<const char*>();
+  // Band as exported by /api/messages ("LONG_WAVE"...) or as its number
+  int band = doc["band"] | -1;
+  const char* bandName = doc["band"].as<const char*>();
+  if (bandName != nullptr) {
+    if (strcmp(bandName, "LONG_WAVE") == 0) band = static_cast<int>(WaveBand::LONG_WAVE);
+    if (strcmp(bandName, "MEDIUM_WAVE") == 0) band = static_cast<int>(WaveBand::MEDIUM_WAVE);
+    if (strcmp(bandName, "SHORT_WAVE") == 0) band = static_cast<int>(WaveBand::SHORT_WAVE);
+  }
+  int frequency = doc["frequency"] | -1;
+  int tone = doc["tone"] | 0;
+
+  auto& stationManager = StationManager::getInstance();
+  bool added = band >= static_cast<int>(WaveBand::LONG_WAVE) &&
+               band <= static_cast<int>(WaveBand::SHORT_WAVE) && tone >= 0 &&
+               tone <= Radio::MAX_TONE_FREQUENCY &&
+               stationManager.addStation(name, static_cast<WaveBand>(band), frequency,
+                                         stationMessage, static_cast<uint16_t>(tone));
+
+  if (!added) {
 #ifdef DEBUG_SERIAL_OUTPUT
-      Serial.printf("Imported message for station %d: %s\n", index, newMessage);
+    Serial.println("Rejected new station");
 #endif
-    }
+    server.send(400, "application/json",
+                "{\"success\":false,\"message\":\"Invalid station or storage full\"}");
+    return;
   }
 
-  if (importedCount > 0) {
-    stationManager.saveToPreferences();
-    message = String(importedCount) + " messages imported successfully";
-  } else {
-    success = false;
-    message = "No valid messages found to import";
-  }
+#ifdef DEBUG_SERIAL_OUTPUT
+  Serial.printf("Added station %s at %d\n", name, frequency);
+#endif
 
   JsonDocument response;
-  response["success"] = success;
-  response["message"] = message;
+  response["success"] = true;
+  response["index"] = stationManager.getStationCount() - 1;
 
   String responseStr;
   serializeJson(response, responseStr);
+  PowerManager::getInstance().resetActivityTimer("Web Interface - Station Added");
   server.send(200, "application/json", responseStr);
 }
 
+void WiFiManager::handleRemoveStation() {
+  JsonDocument doc;
+  DeserializationError error = deserializeJson(doc, requestBody.c_str(), requestBody.size());
+
+  if (error || !doc["index"].is<int>()) {
+    server.send(400, "application/json", "{\"success\":false,\"message\":\"Invalid JSON\"}");
+    return;
+  }
+
+  int index = doc["index"];
+  if (index < 0 || !StationManager::getInstance().removeStation(index)) {
+    server.send(400, "application/json", "{\"success\":false,\"message\":\"Invalid station\"}");
+    return;
+  }
+
+#ifdef DEBUG_SERIAL_OUTPUT
+  Serial.printf("Removed station %d\n", index);
+#endif
+
+  PowerManager::getInstance().resetActivityTimer("Web Interface - Station Removed");
+  server.send(200, "application/json", "{\"success\":true,\"message\":\"Station removed\"}");
+}
+
 void WiFiManager::updateStatusLED() {
   if (wifiEnabled) {
     // Check if any clients are connected
@@ -1895,19 +1172,23 @@ void WiFiManager::flashLED() {
   digitalWrite(Pins::SW_LED, ledState);
 }
 
-String WiFiManager::generateHTML(const String& content) const {
-  String html;
-  html.reserve(8192);  // Reserve space to prevent fragmentation
-
-  // Read from PROGMEM
-  html += FPSTR(HTML_HEADER);
-  html += FPSTR(CSS_STYLES);
-  html += F("</style>");
-  html += F("<script>");
-  html += FPSTR(JAVASCRIPT_CODE);
-  html += F("</script>");
+void WiFiManager::sendPage(void (WiFiManager::*writeBody)(HtmlStream&) const) {
+  // The stylesheet and script are separate cached requests, so a page is only its own markup
+  HtmlStream html(server, "text/html");
+  html.sendFlash(HTML_HEADER);
+  html += F("<link rel='stylesheet' href='");
+  html += ASSET_PATH;
+  html += F("style.css'>");
+  html += F("<script src='");
+  html += ASSET_PATH;
+  html += F("app.js'></script>");
   html += F("</head><body>");
-  html += content;
-  html += FPSTR(HTML_FOOTER);
-  return html;
+  (this->*writeBody)(html);
+  html.sendFlash(HTML_FOOTER);
+  html.end();
+
+#ifdef DEBUG_SERIAL_OUTPUT
+  Serial.printf("Page sent: %u bytes, min free heap %u\n", static_cast<unsigned>(html.getBytesSent()),
+                static_cast<unsigned>(ESP.getMinFreeHeap()));
+#endif
 }
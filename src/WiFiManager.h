@@ -5,14 +5,24 @@
 #include <ESPmDNS.h>
 #include <WebServer.h>
 #include <WiFi.h>
+#include <atomic>
 #include "AudioManager.h"
 #include "Config.h"
+#include "HtmlStream.h"
+#include "JsonRecordReader.h"
+#include "StationImport.h"
 #include "MorseCode.h"
 #include "PowerManager.h"
+#include "RequestBody.h"
 #include "StationManager.h"
+#include "Telemetry.h"
 #include "Version.h"  // Include version information
 #include "esp_timer.h"
 
+namespace WebAssets {
+struct Asset;
+}
+
 class WiFiManager {
  public:
   static WiFiManager& getInstance() {
@@ -21,14 +31,24 @@ class WiFiManager {
   }
 
   void begin();
+  bool startTask();  // Runs service() on its own task on core 0
+  bool isTaskRunning() const { return task != nullptr; }
+  void service();    // One pass of the network/UI work: toggles, settings writes, web server
   void handle();
   void toggle();
   void stop();
-  bool isEnabled() const { return wifiEnabled; }
+  bool isEnabled() const { return wifiEnabled.load(); }
+
+  // Called from the real-time task once the radio is quiet; the network task does the toggle
+  void requestToggle();
+  // The radio stays off from the moment a toggle is requested until WiFi is off again
+  bool isRadioPaused() const { return wifiEnabled.load() || toggleRequested.load(); }
   void updateStatusLED();
   bool hasConnectedClients() const { return WiFi.softAPgetStationNum() > 0; }
 
  private:
+  friend class BenchCases;
+
   WiFiManager()
       : server(80),
         wifiEnabled(false),
@@ -40,7 +60,20 @@ class WiFiManager {
   WiFiManager(const WiFiManager&) = delete;
   WiFiManager& operator=(const WiFiManager&) = delete;
 
+  static void taskEntry(void* parameter);
+  void runTask();
+
   void setupServer();
+
+  // Routes go through these so each handler's latency lands in Perf::Probe::WEB_REQUEST
+  using Handler = void (WiFiManager::*)();
+  void on(const char* uri, HTTPMethod method, Handler handler);
+  // A POST route whose JSON body is read into requestBody as it arrives
+  void onBody(const char* uri, Handler handler);
+  void receiveBody();
+  // A POST route whose {"stations":[...]} body is staged in stationImport as it arrives
+  void onStations(const char* uri, Handler handler, StationImport::Mode mode);
+  void receiveStations(StationImport::Mode mode);
   void startAP();
   void setupMDNS();
   void flashLED();
@@ -56,22 +89,43 @@ class WiFiManager {
   void handleGetTuningValue();
   void handleAPI();
   void handleBatteryStatus();
+  void handleEvents();
+#ifdef PERF_PROBES
+  void handlePerf();
+#endif
   void handleNotFound();
+  void handleAsset(const WebAssets::Asset& asset);
   void handleExportMessages();
   void handleImportMessages();
+  void handleAddStation();
+  void handleRemoveStation();
 
-  // HTML generation
-  String generateHTML(const String& content) const;
-  String generateHomePage() const;
-  String generateStationPage() const;
-  String generateStationList() const;
-  String generateCalibrationPage() const;
-  String generateSettingsPage() const;
+  // HTML pages, streamed to the client as they are written
+  void sendPage(void (WiFiManager::*writeBody)(HtmlStream&) const);
+  void writeHomePage(HtmlStream& html) const;
+  void writeStationPage(HtmlStream& html) const;
+  void writeStationList(HtmlStream& html) const;
+  void writeCalibrationPage(HtmlStream& html) const;
+  void writeSettingsPage(HtmlStream& html) const;
   String generateStatusJson() const;
 
+  // Live telemetry (Server-Sent Events), pushed from handle()
+  struct EventClient {
+    WiFiClient client;
+    Telemetry sent;           // What the client has been told
+    bool hasSent = false;     // False until the first, complete event
+    unsigned long interval = 0;
+    unsigned long lastEvent = 0;
+  };
+  void pushTelemetry();
+  void sampleTelemetry(unsigned long now);
+  bool sendEvent(EventClient& events, const char* text, size_t length);
+
   // Server instance
   WebServer server;
-  bool wifiEnabled;
+  std::atomic<bool> wifiEnabled;
+  std::atomic<bool> toggleRequested{false};
+  TaskHandle_t task = nullptr;
   unsigned long startTime;
   unsigned long lastLedFlash;
   String hostname;
@@ -81,12 +135,22 @@ class WiFiManager {
   static constexpr unsigned long LED_FLASH_INTERVAL = 500;
   static constexpr uint8_t AP_CHANNEL = 1;
   static constexpr uint8_t MAX_CONNECTIONS = 4;
+  static constexpr unsigned long TELEMETRY_INTERVAL = 250;        // Default event rate (ms)
+  static constexpr unsigned long TELEMETRY_MIN_INTERVAL = 50;     // Fastest ?interval= accepted
+  static constexpr unsigned long TELEMETRY_MAX_INTERVAL = 10000;  // Slowest ?interval= accepted
+  static constexpr unsigned long TELEMETRY_KEEPALIVE = 15000;     // Comment on a quiet stream
+  static constexpr unsigned long BATTERY_SAMPLE_INTERVAL = 5000;  // Battery read interval (ms)
+
+  EventClient eventClients[MAX_CONNECTIONS];
+  RequestBody requestBody;  // Body of the POST being handled, for onBody() routes
+  StationImport stationImport;  // /save and /api/messages bodies, applied once whole
+  Telemetry telemetry;  // Latest sample, shared by every stream
+  unsigned long lastBatterySample = 0;
+  bool batterySampled = false;
 
-  // HTML templates stored in PROGMEM
+  // HTML templates stored in PROGMEM; the stylesheet and script are in WebAssets.h
   static const char HTML_HEADER[];
   static const char HTML_FOOTER[];
-  static const char CSS_STYLES[];
-  static const char JAVASCRIPT_CODE[];
 };
 
 #endif
@@ -4,11 +4,17 @@
 #include <esp_sleep.h>
 
 #include "AudioManager.h"
+#include "BenchRunner.h"
 #include "ButtonDebouncer.h"
 #include "Config.h"
+#include "InputScanner.h"
+#include "LoopWaker.h"
 #include "MorseCode.h"
 #include "MetricsManager.h"
+#include "PerfMonitor.h"
+#include "PersistenceService.h"
 #include "PowerManager.h"
+#include "RadioState.h"
 #include "SignalManager.h"
 #include "SpeedManager.h"
 #include "StationManager.h"
@@ -16,7 +22,13 @@
 #include "WaveBandManager.h"
 #include "WiFiManager.h"
 
-// Task Scheduler
+namespace {
+// The Arduino loop task is already pinned to core 1; it becomes the real-time task by
+// outranking everything else there except the audio render and pot sampler tasks
+constexpr UBaseType_t REAL_TIME_TASK_PRIORITY = 3;
+}  // namespace
+
+// Task Scheduler (real-time task only)
 Scheduler ts;
 
 // WiFi button debouncer (50ms debounce, active low)
@@ -27,12 +39,24 @@ void batteryCheckCallback();
 void systemUpdateCallback();
 void handleWiFiButton();
 void updateTuningAndStation();
+void publishTuning(int tuningValue, int displayValue, const StationCandidate* closest);
+unsigned long systemUpdateBudget();
 
 // Tasks
 Task tBatteryCheck(60000, TASK_FOREVER, &batteryCheckCallback);  // Check battery every minute
-Task tSystemUpdate(10, TASK_FOREVER, &systemUpdateCallback);     // System update every 10ms
-
-// Main system manager class
+Task tSystemUpdate(Timing::SYSTEM_UPDATE_INTERVAL, TASK_FOREVER,
+                   &systemUpdateCallback);  // Rescheduled for its next deadline after every run
+
+/**
+ * Main system manager.
+ *
+ * Work is split across the two cores. The real-time task (this loop, on core
+ * 1) owns keying, audio, tuning and the switches, and publishes what it is
+ * doing through RadioState. The network/UI task (WiFiManager, on core 0) runs
+ * the web server, OTA and settings writes and only reads that state. Stations
+ * and settings are only edited while WiFi is on, and the radio is paused for
+ * exactly that time, so the two tasks never touch the catalogue at once.
+ */
 class RadioSystem {
  public:
   void begin() {
@@ -62,32 +86,50 @@ class RadioSystem {
     }
 #endif
     initializeTasks();
+    LoopWaker::getInstance().begin();
+
+    vTaskPrioritySet(nullptr, REAL_TIME_TASK_PRIORITY);
+    if (!WiFiManager::getInstance().startTask()) {
+#ifdef DEBUG_SERIAL_OUTPUT
+      Serial.println(F("Network task unavailable, serving WiFi from the main loop"));
+#endif
+    }
   }
 
   void loop() {
+    // One read of the input register serves every switch check in this pass
+    auto& inputs = InputScanner::getInstance();
+    inputs.scan();
+
     // Check power switch state
     PowerManager::getInstance().checkPowerSwitch();
 
     // If power switch is off, don't process anything else
-    if (digitalRead(Pins::POWER_SWITCH) == LOW) {
+    if (inputs.isLow(Pins::POWER_SWITCH)) {
       delay(10);  // Debounce delay
       return;
     }
 
-    static unsigned long lastActivityCheck = 0;
-    unsigned long now = millis();
-    if (now - lastActivityCheck >= 50) {
-      PowerManager::getInstance().checkActivity();
-      lastActivityCheck = now;
-    }
+    PowerManager::getInstance().checkActivity();
+
+#if defined(PERF_PROBES) && defined(DEBUG_SERIAL_OUTPUT)
+    // 'b' on the serial console runs the hot-path microbenchmarks
+    BenchRunner::poll();
+#endif
 
     ts.execute();
-    // Use yield() instead of delay(1) for better responsiveness and lower latency
-    yield();
+
+    // Block until the next deadline; input edges, pot moves and the keyer end the wait early
+    if (LoopWaker::getInstance().sleepFor(msUntilNextDeadline())) {
+      tSystemUpdate.forceNextIteration();
+    }
   }
 
-  static void handleStationTuning(Station* station, int signalStrength) {
-    auto& config = ConfigManager::getInstance();
+  static void handleStationTuning(const StationCandidate* candidates, size_t candidateCount,
+                                  int tuningValue) {
+    Station* station = candidateCount > 0 ? candidates[0].station : nullptr;
+    int signalStrength = candidateCount > 0 ? candidates[0].signalStrength : 0;
+
     auto& audio = AudioManager::getInstance();
     auto& morse = MorseCode::getInstance();
     auto& power = PowerManager::getInstance();
@@ -102,17 +144,22 @@ class RadioSystem {
     }
 
     if (stationLocked) {
-      if (!config.isMorsePlaying() || station != lastStation) {
-        if (station != lastStation) {
-          // Reset idle timer when user switches to a different station
-          power.resetActivityTimer("Station Changed");
-          audio.stop();
-        }
+      bool restart = !morse.isPlaying() || station != lastStation;
+      if (station != lastStation) {
+        // Reset idle timer when user switches to a different station
+        power.resetActivityTimer("Station Changed");
+        audio.stop();
+      }
+      // Partially tuned stations sit under static in proportion to signal strength,
+      // alongside any neighbours close enough to bleed in. Mixed before the message
+      // starts so its first element already sounds at the station's pitch and level.
+      audio.mixStations(candidates, candidateCount, tuningValue);
+      if (restart) {
         morse.startMessage(station->getMessage());
         lastStation = station;
       }
     } else {
-      if (config.isMorsePlaying()) {
+      if (morse.isPlaying()) {
         morse.stop();
         lastStation = nullptr;
       }
@@ -122,8 +169,31 @@ class RadioSystem {
     morse.update();
   }
 
+  // Silences the radio before the network task brings WiFi up
+  static void pauseRadio() {
+    AudioManager::getInstance().stop();
+    MorseCode::getInstance().stop();
+
+    // SW_LED is repurposed for WiFi status
+    WaveBandManager::getInstance().turnOffAllBandLEDs();
+  }
+
  private:
+  // Earliest of the scheduled tasks and the inactivity timeout
+  static unsigned long msUntilNextDeadline() {
+    unsigned long idle = PowerManager::getInstance().msUntilInactivityTimeout();
+    Task* tasks[] = {&tSystemUpdate, &tBatteryCheck};
+    for (Task* task : tasks) {
+      long untilNext = ts.timeUntilNextIteration(*task);
+      if (untilNext >= 0 && static_cast<unsigned long>(untilNext) < idle) {
+        idle = untilNext;
+      }
+    }
+    return idle;
+  }
+
   void initializeSubsystems() {
+    PersistenceService::getInstance().begin();
     PowerManager::getInstance().begin();
     MetricsManager::getInstance().begin();
     if (MetricsManager::getInstance().handleSleepWakeTelemetry()) {
@@ -174,6 +244,9 @@ void batteryCheckCallback() {
 }
 
 void systemUpdateCallback() {
+  PERF_TICK_START(Perf::Probe::TICK_LATENESS);
+  PERF_SCOPE(Perf::Probe::SYSTEM_UPDATE);
+
   // Update WiFi button debouncer state
   wifiButton.update();
 
@@ -183,16 +256,25 @@ void systemUpdateCallback() {
   // Check WiFi toggle button with debounce
   handleWiFiButton();
 
-  // Handle WiFi operations
-  WiFiManager::getInstance().handle();
+  auto& wifi = WiFiManager::getInstance();
+  if (!wifi.isTaskRunning()) {
+    wifi.service();  // Fallback when the network task could not be created
+  }
 
-  // Skip morse radio functionality when WiFi is enabled
-  if (!WiFiManager::getInstance().isEnabled()) {
+  // Skip morse radio functionality while WiFi is on (or being toggled)
+  if (wifi.isRadioPaused()) {
+    // The calibration page still follows the tuning pot
+    auto& power = PowerManager::getInstance();
+    publishTuning(power.readADC(Pins::TUNING_POT), power.readADCRaw(Pins::TUNING_POT), nullptr);
+  } else {
     // Update tuning and find the closest station
     updateTuningAndStation();
 
     // Handle audio playback
-    AudioManager::getInstance().handlePlayback();
+    {
+      PERF_SCOPE(Perf::Probe::PLAYBACK);
+      AudioManager::getInstance().handlePlayback();
+    }
 
     // Update wave band LEDs
     WaveBandManager::getInstance().updateLEDs();
@@ -200,6 +282,33 @@ void systemUpdateCallback() {
     // Update morse speed
     SpeedManager::getInstance().update();
   }
+
+  // Nothing runs again until something is actually due
+  unsigned long budget = systemUpdateBudget();
+  tSystemUpdate.delay(budget);
+  PERF_TICK_DUE(Perf::Probe::TICK_LATENESS, budget);
+}
+
+// How long the system update can wait before anything it drives needs it again
+unsigned long systemUpdateBudget() {
+  auto& power = PowerManager::getInstance();
+
+  // The calibration view, the inline web server fallback and polled switches still need
+  // the tick
+  auto& wifi = WiFiManager::getInstance();
+  if (wifi.isRadioPaused() || !wifi.isTaskRunning() ||
+      !InputScanner::getInstance().isInterruptDriven()) {
+    return Timing::SYSTEM_UPDATE_INTERVAL;
+  }
+
+  unsigned long now = millis();
+  unsigned long budget = power.msUntilPotPoll(now);
+  budget = min(budget, wifiButton.msUntilSettled());
+  budget = min(budget, MorseCode::getInstance().msUntilNextUpdate(now));
+  budget = min(budget, AudioManager::getInstance().msUntilNextUpdate(now));
+
+  // Task::delay(0) would mean "one interval", so a deadline that is due now waits 1 ms
+  return max(budget, 1UL);
 }
 
 // Helper functions to break down the systemUpdateCallback
@@ -209,13 +318,19 @@ void handleWiFiButton() {
     return;
   }
 
-  // Toggle WiFi on debounced button press (edge detection)
+  // Toggle WiFi on debounced button press (edge detection); the network task does the rest
   if (wifiButton.wasPressed()) {
-    WiFiManager::getInstance().toggle();
+    auto& wifi = WiFiManager::getInstance();
+    if (!wifi.isRadioPaused()) {
+      RadioSystem::pauseRadio();
+    }
+    wifi.requestToggle();
   }
 }
 
 void updateTuningAndStation() {
+  PERF_SCOPE(Perf::Probe::TUNING);
+
   // Update wave band selection
   WaveBandManager::getInstance().update();
 
@@ -228,9 +343,14 @@ void updateTuningAndStation() {
   auto& stations = StationManager::getInstance();
   auto& signalMgr = SignalManager::getInstance();
 
-  // Find the closest station based on tuning value and current wave band
-  Station* closestStation =
-      stations.findClosestStation(tuningValue, config.getWaveBand(), signalStrength);
+  // Find the closest stations based on tuning value and current wave band
+  StationCandidate candidates[AudioManager::MAX_STATIONS];
+  size_t candidateCount = stations.findStationCandidates(tuningValue, config.getWaveBand(),
+                                                         candidates, AudioManager::MAX_STATIONS);
+  Station* closestStation = candidateCount > 0 ? candidates[0].station : nullptr;
+  if (closestStation != nullptr) {
+    signalStrength = candidates[0].signalStrength;
+  }
 
   // Update signal indicators
   bool stationLocked = (signalStrength > 0);
@@ -243,8 +363,22 @@ void updateTuningAndStation() {
                        signalStrength);
 #endif
 
+  publishTuning(tuningValue, tuningValue, candidateCount > 0 ? &candidates[0] : nullptr);
+
   // Handle station tuning and audio playback
-  RadioSystem::handleStationTuning(closestStation, signalStrength);
+  RadioSystem::handleStationTuning(candidates, candidateCount, tuningValue);
+}
+
+// Shares the latest tuning with the network task (status JSON, calibration view)
+void publishTuning(int tuningValue, int displayValue, const StationCandidate* closest) {
+  RadioState::Tuning tuning;
+  tuning.tuningValue = tuningValue;
+  tuning.displayValue = displayValue;
+  tuning.signalStrength = closest != nullptr ? closest->signalStrength : 0;
+  tuning.stationFrequency = closest != nullptr ? closest->station->getFrequency() : -1;
+  tuning.band = ConfigManager::getInstance().getWaveBand();
+  tuning.updatedAt = millis();
+  RadioState::getInstance().publishTuning(tuning);
 }
 
 // Global system instance
@@ -1,10 +1,17 @@
 #ifndef ARDUINO_H
 #define ARDUINO_H
 
+#include <math.h>
 #include <stdint.h>
 #include <stddef.h>
+#include <string.h>
+#include <algorithm>
 #include <string>
 
+// Arduino-ESP32 exposes the std versions
+using std::max;
+using std::min;
+
 typedef bool boolean;
 typedef uint8_t byte;
 
@@ -47,15 +54,80 @@ class String {
 #define OUTPUT 1
 #define INPUT_PULLUP 2
 #define PROGMEM
+#define IRAM_ATTR
+#define CHANGE 3
+#define digitalPinToInterrupt(pin) (pin)
 #define F(x) x
+#define PGM_P const char*
+class __FlashStringHelper;  // F() is a plain string on the host
+#define RTC_DATA_ATTR
+#ifndef PI
+#define PI 3.1415926535897932384626433832795
+#endif
+// Arduino-ESP32 pulls in FreeRTOS; critical sections lock nothing on the host, but their
+// depth is kept so the emulator can flag calls that must not be made inside one
+typedef int portMUX_TYPE;
+#define portMUX_INITIALIZER_UNLOCKED 0
+inline int& portCriticalNesting() {
+  static int depth = 0;
+  return depth;
+}
+#define portENTER_CRITICAL(mux) ((void)(mux), ++portCriticalNesting())
+#define portEXIT_CRITICAL(mux) ((void)(mux), --portCriticalNesting())
+
+// Task notifications for the one emulated task (the Arduino loop); a blocking take
+// advances the emulated clock until it is notified or times out
+typedef void* TaskHandle_t;
+typedef int BaseType_t;
+typedef uint32_t TickType_t;
+#define pdTRUE 1
+#define pdFALSE 0
+#define pdMS_TO_TICKS(ms) (static_cast<TickType_t>(ms))
+#define portYIELD_FROM_ISR(woken) ((void)(woken))
+TaskHandle_t xTaskGetCurrentTaskHandle();
+uint32_t ulTaskNotifyTake(BaseType_t clearOnExit, TickType_t ticksToWait);
+void xTaskNotifyGive(TaskHandle_t task);
+void vTaskNotifyGiveFromISR(TaskHandle_t task, BaseType_t* higherPriorityTaskWoken);
+
+// Only the loop task runs on the host, so creating another task fails and callers take
+// their single-task fallback
+typedef unsigned int UBaseType_t;
+typedef void (*TaskFunction_t)(void*);
+#define pdPASS 1
+#define pdFAIL 0
+BaseType_t xTaskCreate(TaskFunction_t code, const char* name, uint32_t stackDepth, void* parameter,
+                       UBaseType_t priority, TaskHandle_t* createdTask);
+BaseType_t xTaskCreatePinnedToCore(TaskFunction_t code, const char* name, uint32_t stackDepth,
+                                   void* parameter, UBaseType_t priority,
+                                   TaskHandle_t* createdTask, BaseType_t core);
+void vTaskDelete(TaskHandle_t task);
+void vTaskPrioritySet(TaskHandle_t task, UBaseType_t priority);
+TickType_t xTaskGetTickCount();
+void vTaskDelayUntil(TickType_t* previousWakeTime, TickType_t increment);
+
 #define pgm_read_ptr(addr) (*(addr))
+#define pgm_read_byte(addr) (*(addr))
+#define strlen_P(str) strlen(str)
+#define memcpy_P(dest, src, n) memcpy((dest), (src), (n))
 
 unsigned long millis();
+unsigned long micros();
+uint32_t getCpuFrequencyMhz();
+bool setCpuFrequencyMhz(uint32_t mhz);
+bool btStop();
 void delay(unsigned long ms);
+void yield();
 int digitalRead(int pin);
 void digitalWrite(int pin, int value);
 void pinMode(int pin, int mode);
 int analogRead(int pin);
+typedef enum { ADC_0db, ADC_2_5db, ADC_6db, ADC_11db } adc_attenuation_t;
+void analogReadResolution(uint8_t bits);
+void adcAttachPin(uint8_t pin);
+void analogSetPinAttenuation(uint8_t pin, adc_attenuation_t attenuation);
+// Handlers fire synchronously when the emulator changes an input pin's level
+void attachInterruptArg(uint8_t pin, void (*handler)(void*), void* arg, int mode);
+void detachInterrupt(uint8_t pin);
 int random(int min, int max);
 long random(long max);
 
@@ -78,6 +78,19 @@ void AudioManager::stopMorseTone() {
   g_events.push_back({false, millis()});
 }
 
+void AudioManager::prepareMorseTone() {
+  isPlayingMorse = false;
+  ledcAttachPin(Pins::SPEAKER, Audio::SPEAKER_CHANNEL);
+  ledcWriteTone(Audio::SPEAKER_CHANNEL, MORSE_FREQUENCY);
+  ledcWrite(Audio::SPEAKER_CHANNEL, 0);
+}
+
+void AudioManager::gateMorseTone(bool on) {
+  isPlayingMorse = on;
+  ledcWrite(Audio::SPEAKER_CHANNEL, on ? currentVolume : 0);
+  g_events.push_back({on, millis()});
+}
+
 void AudioManager::updateStaticPattern() {
   ledcWriteTone(Audio::SPEAKER_CHANNEL, MORSE_FREQUENCY / 2);
   ledcWrite(Audio::SPEAKER_CHANNEL, calculateStaticVolume());
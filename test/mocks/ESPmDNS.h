@@ -0,0 +1,6 @@
+#ifndef ESPMDNS_H
+#define ESPMDNS_H
+
+// Host stand-in so the network manager headers compile; nothing here is used on the host
+
+#endif
@@ -0,0 +1,6 @@
+#ifndef HTTPCLIENT_H
+#define HTTPCLIENT_H
+
+// Host stand-in so the network manager headers compile; nothing here is used on the host
+
+#endif
@@ -1,6 +1,12 @@
 #include "HardwareEmulator.h"
 
+#include <algorithm>
+
 #include "Arduino.h"
+#include "esp_cpu.h"
+#include "esp_sleep.h"
+#include "esp_timer.h"
+#include "soc/gpio_reg.h"
 
 HardwareEmulator& HardwareEmulator::getInstance() {
   static HardwareEmulator instance;
@@ -13,13 +19,56 @@ void HardwareEmulator::reset() {
   digitalWriteCounts.fill(0);
   adcValues.fill(0);
   ledcStates.fill({});
-  currentMillis = 0;
+  interrupts.fill({});
+  pinListener = nullptr;
+  pinListenerArg = nullptr;
+  for (auto* timer : timers) {
+    timer->armed = false;
+  }
+  currentMicros = 0;
+  spentCycles = 0;
   randomState = 0x12345678u;
+  gpioRegisterReads = 0;
+  loopNotifications = 0;
+  criticalSectionCalls = 0;
+  batteryVoltage = 4.0f;
+  usbPowered = false;
+  wakePin = -1;
+  wakeTimerUs = 0;
+}
+
+uint32_t HardwareEmulator::takeLoopNotifications(uint32_t timeoutMs) {
+  for (uint32_t waited = 0; loopNotifications == 0 && waited < timeoutMs; waited++) {
+    advanceMillis(1);
+  }
+  uint32_t taken = loopNotifications;
+  loopNotifications = 0;
+  return taken;
 }
 
 void HardwareEmulator::setPinState(int pin, int value) {
   if (pin >= 0 && pin < static_cast<int>(MAX_PINS)) {
+    bool changed = pinStates[pin] != value;
     pinStates[pin] = value;
+    if (changed && pinListener != nullptr) {
+      pinListener(pin, value, pinListenerArg);
+    }
+    if (changed && interrupts[pin].handler != nullptr) {
+      interrupts[pin].handler(interrupts[pin].arg);
+    }
+  }
+}
+
+void HardwareEmulator::attachInterrupt(int pin, void (*handler)(void*), void* arg) {
+  if (pin >= 0 && pin < static_cast<int>(MAX_PINS)) {
+    interrupts[pin].handler = handler;
+    interrupts[pin].arg = arg;
+  }
+}
+
+void HardwareEmulator::detachInterrupt(int pin) {
+  if (pin >= 0 && pin < static_cast<int>(MAX_PINS)) {
+    interrupts[pin] = Interrupt();
   }
 }
 
@@ -42,6 +91,18 @@ int HardwareEmulator::getPinState(int pin) const {
   return HIGH;
 }
 
+uint32_t HardwareEmulator::readGpioInputs(int bank) const {
+  gpioRegisterReads++;
+  uint32_t levels = 0;
+  for (size_t bit = 0; bit < 32; bit++) {
+    size_t pin = bank * 32 + bit;
+    if (pin < MAX_PINS && pinStates[pin] != LOW) {
+      levels |= 1u << bit;
+    }
+  }
+  return levels;
+}
+
 int HardwareEmulator::getPinMode(int pin) const {
   if (pin >= 0 && pin < static_cast<int>(MAX_PINS)) {
     return pinModes[pin];
@@ -69,9 +130,45 @@ int HardwareEmulator::getADCValue(int pin) const {
   return 0;
 }
 
-void HardwareEmulator::advanceMillis(unsigned long ms) { currentMillis += ms; }
+void HardwareEmulator::advanceMillis(unsigned long ms) {
+  const uint64_t target = currentMicros + static_cast<uint64_t>(ms) * 1000ULL;
 
-unsigned long HardwareEmulator::getMillis() const { return currentMillis; }
+  while (true) {
+    esp_timer* due = nullptr;
+    for (auto* timer : timers) {
+      if (timer->armed && timer->deadlineUs <= target &&
+          (due == nullptr || timer->deadlineUs < due->deadlineUs)) {
+        due = timer;
+      }
+    }
+    if (due == nullptr) break;
+
+    currentMicros = std::max(currentMicros, due->deadlineUs);
+    due->armed = false;
+    due->callback(due->arg);
+  }
+
+  currentMicros = target;
+}
+
+unsigned long HardwareEmulator::getMillis() const {
+  return static_cast<unsigned long>(currentMicros / 1000ULL);
+}
+
+uint64_t HardwareEmulator::getMicros() const { return currentMicros; }
+
+void HardwareEmulator::enterDeepSleep() {
+  DeepSleep sleep = {getMillis(), wakePin, wakeTimerUs};
+  wakePin = -1;
+  wakeTimerUs = 0;
+  throw sleep;
+}
+
+void HardwareEmulator::registerTimer(esp_timer* timer) { timers.push_back(timer); }
+
+void HardwareEmulator::unregisterTimer(esp_timer* timer) {
+  timers.erase(std::remove(timers.begin(), timers.end(), timer), timers.end());
+}
 
 void HardwareEmulator::setLedc(int channel, uint32_t freq, uint8_t resolution) {
   if (channel >= 0 && channel < static_cast<int>(MAX_CHANNELS)) {
@@ -161,12 +258,31 @@ long HardwareEmulator::nextRandom(long maxValueExclusive) {
 
 unsigned long millis() { return HardwareEmulator::getInstance().getMillis(); }
 
+unsigned long micros() {
+  return static_cast<unsigned long>(HardwareEmulator::getInstance().getMicros());
+}
+
+uint32_t getCpuFrequencyMhz() { return HardwareEmulator::CPU_MHZ; }
+
+uint32_t esp_cpu_get_cycle_count() { return HardwareEmulator::getInstance().getCycleCount(); }
+
+bool setCpuFrequencyMhz(uint32_t mhz) { return mhz == HardwareEmulator::CPU_MHZ; }
+
+bool btStop() { return true; }
+
 void delay(unsigned long ms) { HardwareEmulator::getInstance().advanceMillis(ms); }
 
+void yield() {}
+
 int digitalRead(int pin) { return HardwareEmulator::getInstance().getPinState(pin); }
 
+uint32_t REG_READ(uint32_t address) {
+  return HardwareEmulator::getInstance().readGpioInputs(address == GPIO_IN1_REG ? 1 : 0);
+}
+
 void digitalWrite(int pin, int value) {
   auto& hw = HardwareEmulator::getInstance();
+  hw.checkNotInCriticalSection();
   hw.setPinState(pin, value);
   hw.incrementDigitalWriteCount(pin);
 }
@@ -177,6 +293,92 @@ void pinMode(int pin, int mode) {
 
 int analogRead(int pin) { return HardwareEmulator::getInstance().getADCValue(pin); }
 
+void analogReadResolution(uint8_t bits) { (void)bits; }
+
+void adcAttachPin(uint8_t pin) { (void)pin; }
+
+void analogSetPinAttenuation(uint8_t pin, adc_attenuation_t attenuation) {
+  (void)pin;
+  (void)attenuation;
+}
+
+void attachInterruptArg(uint8_t pin, void (*handler)(void*), void* arg, int mode) {
+  (void)mode;
+  HardwareEmulator::getInstance().attachInterrupt(pin, handler, arg);
+}
+
+void detachInterrupt(uint8_t pin) { HardwareEmulator::getInstance().detachInterrupt(pin); }
+
+TaskHandle_t xTaskGetCurrentTaskHandle() { return &HardwareEmulator::getInstance(); }
+
+uint32_t ulTaskNotifyTake(BaseType_t clearOnExit, TickType_t ticksToWait) {
+  (void)clearOnExit;
+  return HardwareEmulator::getInstance().takeLoopNotifications(ticksToWait);
+}
+
+void xTaskNotifyGive(TaskHandle_t task) {
+  (void)task;
+  HardwareEmulator::getInstance().checkNotInCriticalSection();
+  HardwareEmulator::getInstance().notifyLoopTask();
+}
+
+void vTaskNotifyGiveFromISR(TaskHandle_t task, BaseType_t* higherPriorityTaskWoken) {
+  (void)task;
+  HardwareEmulator::getInstance().notifyLoopTask();
+  if (higherPriorityTaskWoken != nullptr) *higherPriorityTaskWoken = pdFALSE;
+}
+
+BaseType_t xTaskCreate(TaskFunction_t code, const char* name, uint32_t stackDepth, void* parameter,
+                       UBaseType_t priority, TaskHandle_t* createdTask) {
+  return xTaskCreatePinnedToCore(code, name, stackDepth, parameter, priority, createdTask, 0);
+}
+
+BaseType_t xTaskCreatePinnedToCore(TaskFunction_t code, const char* name, uint32_t stackDepth,
+                                   void* parameter, UBaseType_t priority,
+                                   TaskHandle_t* createdTask, BaseType_t core) {
+  (void)code;
+  (void)name;
+  (void)stackDepth;
+  (void)parameter;
+  (void)priority;
+  (void)core;
+  if (createdTask != nullptr) *createdTask = nullptr;
+  return pdFAIL;
+}
+
+void vTaskDelete(TaskHandle_t task) { (void)task; }
+
+void vTaskPrioritySet(TaskHandle_t task, UBaseType_t priority) {
+  (void)task;
+  (void)priority;
+}
+
+TickType_t xTaskGetTickCount() {
+  return static_cast<TickType_t>(HardwareEmulator::getInstance().getMillis());
+}
+
+void vTaskDelayUntil(TickType_t* previousWakeTime, TickType_t increment) {
+  TickType_t wakeTime = *previousWakeTime + increment;
+  TickType_t now = xTaskGetTickCount();
+  if (static_cast<int32_t>(wakeTime - now) > 0) delay(wakeTime - now);
+  *previousWakeTime = wakeTime;
+}
+
+esp_err_t esp_sleep_enable_ext0_wakeup(gpio_num_t gpio_num, int level) {
+  (void)level;
+  HardwareEmulator::getInstance().enableWakePin(gpio_num);
+  return ESP_OK;
+}
+
+esp_err_t esp_sleep_enable_timer_wakeup(uint64_t time_in_us) {
+  HardwareEmulator::getInstance().enableWakeTimer(time_in_us);
+  return ESP_OK;
+}
+
+esp_sleep_wakeup_cause_t esp_sleep_get_wakeup_cause() { return ESP_SLEEP_WAKEUP_UNDEFINED; }
+
+void esp_deep_sleep_start() { HardwareEmulator::getInstance().enterDeepSleep(); }
+
 int random(int min, int max) { return HardwareEmulator::getInstance().nextRandom(min, max); }
 
 long random(long max) { return HardwareEmulator::getInstance().nextRandom(max); }
@@ -192,11 +394,54 @@ void ledcAttachPin(int pin, uint8_t channel) {
 void ledcDetachPin(int pin) { HardwareEmulator::getInstance().detachLedcPin(pin); }
 
 void ledcWrite(uint8_t channel, uint32_t duty) {
+  HardwareEmulator::getInstance().checkNotInCriticalSection();
   HardwareEmulator::getInstance().writeLedcDuty(channel, duty);
 }
 
 void ledcWriteTone(uint8_t channel, uint32_t freq) {
+  HardwareEmulator::getInstance().checkNotInCriticalSection();
   HardwareEmulator::getInstance().writeLedcTone(channel, freq);
 }
 
+esp_err_t esp_timer_create(const esp_timer_create_args_t* args, esp_timer_handle_t* out_handle) {
+  if (args == nullptr || out_handle == nullptr) {
+    return ESP_FAIL;
+  }
+  esp_timer* timer = new esp_timer{args->callback, args->arg, 0, false};
+  HardwareEmulator::getInstance().registerTimer(timer);
+  *out_handle = timer;
+  return ESP_OK;
+}
+
+esp_err_t esp_timer_start_once(esp_timer_handle_t timer, uint64_t timeout_us) {
+  HardwareEmulator::getInstance().checkNotInCriticalSection();
+  if (timer == nullptr || timer->callback == nullptr || timer->armed) {
+    return ESP_FAIL;
+  }
+  timer->deadlineUs = HardwareEmulator::getInstance().getMicros() + timeout_us;
+  timer->armed = true;
+  return ESP_OK;
+}
+
+esp_err_t esp_timer_stop(esp_timer_handle_t timer) {
+  if (timer == nullptr || !timer->armed) {
+    return ESP_FAIL;
+  }
+  timer->armed = false;
+  return ESP_OK;
+}
+
+esp_err_t esp_timer_delete(esp_timer_handle_t timer) {
+  if (timer == nullptr) {
+    return ESP_FAIL;
+  }
+  HardwareEmulator::getInstance().unregisterTimer(timer);
+  delete timer;
+  return ESP_OK;
+}
+
+int64_t esp_timer_get_time() {
+  return static_cast<int64_t>(HardwareEmulator::getInstance().getMicros());
+}
+
 int ledcRead(uint8_t channel) { return static_cast<int>(HardwareEmulator::getInstance().getLedcDuty(channel)); }
@@ -3,6 +3,11 @@
 
 #include <array>
 #include <cstdint>
+#include <vector>
+
+#include "Arduino.h"
+
+struct esp_timer;
 
 class HardwareEmulator {
  public:
@@ -16,12 +21,64 @@ class HardwareEmulator {
   int getPinState(int pin) const;
   int getPinMode(int pin) const;
   int getDigitalWriteCount(int pin) const;
+  uint32_t readGpioInputs(int bank) const;  // Pin levels packed like GPIO_IN_REG/GPIO_IN1_REG
+  uint32_t getGpioRegisterReads() const { return gpioRegisterReads; }
+
+  // GPIO, LEDC, task notification and esp_timer calls made inside a critical section, which
+  // ESP-IDF forbids (they take their own locks or may yield)
+  void checkNotInCriticalSection() {
+    if (portCriticalNesting() > 0) criticalSectionCalls++;
+  }
+  uint32_t getCriticalSectionCalls() const { return criticalSectionCalls; }
+
+  // Notifications to the loop task; a blocking take runs the clock forward 1 ms at a time
+  void notifyLoopTask() { loopNotifications++; }
+  uint32_t takeLoopNotifications(uint32_t timeoutMs);
+
+  // Called from setPinState() whenever a pin changes level, inputs and outputs alike
+  typedef void (*PinListener)(int pin, int value, void* arg);
+  void setPinListener(PinListener listener, void* arg) {
+    pinListener = listener;
+    pinListenerArg = arg;
+  }
+
+  // Pin-change interrupts, fired from setPinState() when the level changes
+  void attachInterrupt(int pin, void (*handler)(void*), void* arg);
+  void detachInterrupt(int pin);
 
   void setADCValue(int pin, int value);
   int getADCValue(int pin) const;
 
+  // Advancing the clock fires any armed esp_timer at its exact deadline
   void advanceMillis(unsigned long ms);
   unsigned long getMillis() const;
+  uint64_t getMicros() const;
+
+  // Cycle counter for the perf probes: runs with the clock, and tests can spend cycles on top
+  static constexpr uint32_t CPU_MHZ = 240;
+  void spendCycles(uint32_t cycles) { spentCycles += cycles; }
+  uint32_t getCycleCount() const {
+    return static_cast<uint32_t>(currentMicros * CPU_MHZ + spentCycles);
+  }
+
+  // Board power, read through the UMS3 stand-in
+  void setBatteryVoltage(float volts) { batteryVoltage = volts; }
+  float getBatteryVoltage() const { return batteryVoltage; }
+  void setUsbPowered(bool powered) { usbPowered = powered; }
+  bool isUsbPowered() const { return usbPowered; }
+
+  // Thrown by esp_deep_sleep_start(): nothing after it runs, as on the chip
+  struct DeepSleep {
+    unsigned long atMillis;
+    int wakePin;           // ext0 wake pin, -1 if none
+    uint64_t wakeTimerUs;  // Timer wake, 0 if none
+  };
+  void enableWakePin(int pin) { wakePin = pin; }
+  void enableWakeTimer(uint64_t us) { wakeTimerUs = us; }
+  [[noreturn]] void enterDeepSleep();
+
+  void registerTimer(esp_timer* timer);
+  void unregisterTimer(esp_timer* timer);
 
   void setLedc(int channel, uint32_t freq, uint8_t resolution);
   void attachLedcPin(int pin, uint8_t channel);
@@ -59,8 +116,26 @@ class HardwareEmulator {
   std::array<int, MAX_PINS> adcValues{};
   std::array<LedcState, MAX_CHANNELS> ledcStates{};
 
-  unsigned long currentMillis = 0;
+  struct Interrupt {
+    void (*handler)(void*) = nullptr;
+    void* arg = nullptr;
+  };
+  std::array<Interrupt, MAX_PINS> interrupts{};
+
+  std::vector<esp_timer*> timers;
+  PinListener pinListener = nullptr;
+  void* pinListenerArg = nullptr;
+
+  uint64_t currentMicros = 0;
+  uint64_t spentCycles = 0;
   uint32_t randomState = 0x12345678u;
+  mutable uint32_t gpioRegisterReads = 0;
+  uint32_t loopNotifications = 0;
+  uint32_t criticalSectionCalls = 0;
+  float batteryVoltage = 4.0f;
+  bool usbPowered = false;
+  int wakePin = -1;
+  uint64_t wakeTimerUs = 0;
 };
 
 #endif
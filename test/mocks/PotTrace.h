@@ -0,0 +1,90 @@
+#ifndef POT_TRACE_H
+#define POT_TRACE_H
+
+#include <cstdlib>
+#include <vector>
+
+#include "HardwareEmulator.h"
+
+/**
+ * ADC traces for the potentiometer step-response harness.
+ *
+ * The traces are shaped like captures from the tuning pot: a quick
+ * turn between two stations, a full-range sweep, and a dial resting with ADC
+ * noise. The noise comes from the emulator's seeded generator, so every run
+ * replays the same samples.
+ * playTrace() feeds a trace through HardwareEmulator::setADCValue at the
+ * main loop rate and records what the reader returned.
+ */
+namespace PotTrace {
+
+constexpr unsigned long LOOP_INTERVAL_MS = 10;  // tSystemUpdate period
+constexpr int NOISE_COUNTS = 6;                  // Peak ADC noise at rest, in counts
+
+inline int noise() {
+  return HardwareEmulator::getInstance().nextRandom(-NOISE_COUNTS, NOISE_COUNTS + 1);
+}
+
+// Rest at `from`, turn to `to` in one loop interval, then rest at `to`
+inline std::vector<int> step(int from, int to, size_t before, size_t after) {
+  std::vector<int> trace;
+  for (size_t i = 0; i < before; i++) trace.push_back(from + noise());
+  for (size_t i = 0; i < after; i++) trace.push_back(to + noise());
+  return trace;
+}
+
+// Constant-speed turn from `from` to `to` over `samples` loop intervals, then rest
+inline std::vector<int> sweep(int from, int to, size_t samples, size_t after) {
+  std::vector<int> trace;
+  for (size_t i = 0; i < samples; i++) {
+    trace.push_back(from + static_cast<int>((to - from) * static_cast<long>(i) / long(samples)) +
+                    noise());
+  }
+  for (size_t i = 0; i < after; i++) trace.push_back(to + noise());
+  return trace;
+}
+
+template <typename Reader>
+std::vector<int> playTrace(Reader& reader, int pin, const std::vector<int>& trace) {
+  auto& hw = HardwareEmulator::getInstance();
+  std::vector<int> output;
+  output.reserve(trace.size());
+  for (int sample : trace) {
+    hw.advanceMillis(LOOP_INTERVAL_MS);
+    hw.setADCValue(pin, sample);
+    output.push_back(reader.read());
+  }
+  return output;
+}
+
+// Samples after `from` until the output stays within `tolerance` of `target` for good
+inline size_t settlingSamples(const std::vector<int>& output, size_t from, int target,
+                              int tolerance) {
+  size_t settled = output.size();
+  for (size_t i = output.size(); i > from; i--) {
+    if (abs(output[i - 1] - target) > tolerance) break;
+    settled = i - 1;
+  }
+  return settled - from;
+}
+
+// How often the output moved between `from` and `to`, i.e. visible jitter
+inline size_t outputChanges(const std::vector<int>& output, size_t from, size_t to) {
+  size_t changes = 0;
+  for (size_t i = from + 1; i < to && i < output.size(); i++) {
+    changes += output[i] != output[i - 1];
+  }
+  return changes;
+}
+
+// Mean distance between output and trace while the dial is moving
+inline double meanLag(const std::vector<int>& output, const std::vector<int>& trace, size_t from,
+                      size_t to) {
+  double total = 0;
+  for (size_t i = from; i < to; i++) total += abs(output[i] - trace[i]);
+  return total / double(to - from);
+}
+
+}  // namespace PotTrace
+
+#endif
@@ -1,8 +1,10 @@
 #ifndef PREFERENCES_H
 #define PREFERENCES_H
 
+#include <cstring>
 #include <map>
 #include <string>
+#include <vector>
 
 #include "Arduino.h"
 
@@ -23,36 +25,87 @@ class Preferences {
     eraseByPrefix(ucharStore(), prefix);
     eraseByPrefix(boolStore(), prefix);
     eraseByPrefix(stringStore(), prefix);
+    eraseByPrefix(bytesStore(), prefix);
     return true;
   }
 
+  bool remove(const char* key) {
+    if (isReadOnly) return false;
+    std::string full = fullKey(key);
+    return (intStore().erase(full) + uintStore().erase(full) + ucharStore().erase(full) +
+            boolStore().erase(full) + stringStore().erase(full) + bytesStore().erase(full)) > 0;
+  }
+
+  bool isKey(const char* key) const {
+    std::string full = fullKey(key);
+    return intStore().count(full) || uintStore().count(full) || ucharStore().count(full) ||
+           boolStore().count(full) || stringStore().count(full) || bytesStore().count(full);
+  }
+
+  size_t putBytes(const char* key, const void* value, size_t length) {
+    if (isReadOnly || failWrites()) return 0;
+    const uint8_t* bytes = static_cast<const uint8_t*>(value);
+    bytesStore()[fullKey(key)].assign(bytes, bytes + length);
+    writeCount()++;
+    return length;
+  }
+
+  size_t getBytesLength(const char* key) const {
+    auto it = bytesStore().find(fullKey(key));
+    return (it == bytesStore().end()) ? 0 : it->second.size();
+  }
+
+  size_t getBytes(const char* key, void* buffer, size_t maxLength) const {
+    auto it = bytesStore().find(fullKey(key));
+    if (it == bytesStore().end() || it->second.size() > maxLength) return 0;
+    memcpy(buffer, it->second.data(), it->second.size());
+    return it->second.size();
+  }
+
+  // Makes writes fail as they do on a full NVS partition
+  static bool& failWrites() {
+    static bool fail = false;
+    return fail;
+  }
+
+  // Number of put calls across all namespaces, for tests that count flash writes
+  static size_t& writeCount() {
+    static size_t count = 0;
+    return count;
+  }
+
   size_t putInt(const char* key, int value) {
-    if (isReadOnly) return 0;
+    if (isReadOnly || failWrites()) return 0;
     intStore()[fullKey(key)] = value;
+    writeCount()++;
     return sizeof(int);
   }
 
   size_t putUInt(const char* key, unsigned int value) {
-    if (isReadOnly) return 0;
+    if (isReadOnly || failWrites()) return 0;
     uintStore()[fullKey(key)] = value;
+    writeCount()++;
     return sizeof(unsigned int);
   }
 
   size_t putUChar(const char* key, unsigned char value) {
-    if (isReadOnly) return 0;
+    if (isReadOnly || failWrites()) return 0;
     ucharStore()[fullKey(key)] = value;
+    writeCount()++;
     return sizeof(unsigned char);
   }
 
   size_t putBool(const char* key, bool value) {
-    if (isReadOnly) return 0;
+    if (isReadOnly || failWrites()) return 0;
     boolStore()[fullKey(key)] = value;
+    writeCount()++;
     return sizeof(bool);
   }
 
   size_t putString(const char* key, const String& value) {
-    if (isReadOnly) return 0;
+    if (isReadOnly || failWrites()) return 0;
     stringStore()[fullKey(key)] = value;
+    writeCount()++;
     return value.length();
   }
 
@@ -122,6 +175,11 @@ class Preferences {
     return store;
   }
 
+  static std::map<std::string, std::vector<uint8_t>>& bytesStore() {
+    static std::map<std::string, std::vector<uint8_t>> store;
+    return store;
+  }
+
   std::string currentNamespace;
   bool isReadOnly = false;
 };
@@ -0,0 +1,24 @@
+#ifndef UMS3_H
+#define UMS3_H
+
+#include <stdint.h>
+
+#include "HardwareEmulator.h"
+
+// Host stand-in for the FeatherS3 helper: battery and USB come from HardwareEmulator
+
+class UMS3 {
+ public:
+  void begin() {}
+  void setLDO2Power(bool on) { (void)on; }
+  bool getVbusPresent() { return HardwareEmulator::getInstance().isUsbPowered(); }
+  float getBatteryVoltage() { return HardwareEmulator::getInstance().getBatteryVoltage(); }
+  void setPixelBrightness(uint8_t brightness) { (void)brightness; }
+  void setPixelColor(uint8_t r, uint8_t g, uint8_t b) {
+    (void)r;
+    (void)g;
+    (void)b;
+  }
+};
+
+#endif
@@ -0,0 +1,6 @@
+#ifndef UPDATE_H
+#define UPDATE_H
+
+// Host stand-in so the network manager headers compile; nothing here is used on the host
+
+#endif
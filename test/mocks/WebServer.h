@@ -0,0 +1,13 @@
+#ifndef WEBSERVER_H
+#define WEBSERVER_H
+
+// Host stand-in so WiFiManager.h compiles; nothing serves requests on the host
+
+enum HTTPMethod { HTTP_GET, HTTP_POST };
+
+class WebServer {
+ public:
+  explicit WebServer(int port) { (void)port; }
+};
+
+#endif
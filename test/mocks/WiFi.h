@@ -0,0 +1,24 @@
+#ifndef WIFI_H
+#define WIFI_H
+
+#include <cstddef>
+#include <cstdint>
+
+// Host stand-in for the WiFi interface: the radio only asks whether anyone is connected
+
+// Never connected; held by the web server's event streams
+class WiFiClient {
+ public:
+  bool connected() { return false; }
+  size_t write(const uint8_t*, size_t) { return 0; }
+  void stop() {}
+};
+
+class WiFiClass {
+ public:
+  int softAPgetStationNum() { return 0; }
+};
+
+extern WiFiClass WiFi;
+
+#endif
@@ -0,0 +1,8 @@
+#ifndef DRIVER_GPIO_H
+#define DRIVER_GPIO_H
+
+// Host stand-in for the ESP-IDF GPIO number type
+
+typedef int gpio_num_t;
+
+#endif
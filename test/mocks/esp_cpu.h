@@ -0,0 +1,10 @@
+#ifndef ESP_CPU_H
+#define ESP_CPU_H
+
+#include <stdint.h>
+
+// Host stand-in for the CPU cycle counter: the emulated clock at the emulated CPU
+// frequency, plus whatever cycles a test has spent with HardwareEmulator::spendCycles()
+uint32_t esp_cpu_get_cycle_count();
+
+#endif
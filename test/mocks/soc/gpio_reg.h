@@ -0,0 +1,10 @@
+#ifndef SOC_GPIO_REG_H
+#define SOC_GPIO_REG_H
+
+#include "soc/soc.h"
+
+// Host stand-in for the ESP32-S3 GPIO input registers, backed by HardwareEmulator's pin states
+#define GPIO_IN_REG 0x6000403Cu   // Levels of GPIO0-31
+#define GPIO_IN1_REG 0x60004040u  // Levels of GPIO32-48
+
+#endif
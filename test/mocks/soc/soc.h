@@ -0,0 +1,9 @@
+#ifndef SOC_SOC_H
+#define SOC_SOC_H
+
+#include <stdint.h>
+
+// Host stand-in for the register access macro; only the GPIO input registers are emulated
+uint32_t REG_READ(uint32_t address);
+
+#endif
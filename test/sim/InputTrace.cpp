@@ -0,0 +1,121 @@
+#include "InputTrace.h"
+
+#include <algorithm>
+#include <cstdio>
+#include <cstring>
+#include <string>
+
+#include "../../src/Config.h"
+
+namespace {
+struct NamedPin {
+  const char* name;
+  int pin;
+};
+
+const NamedPin POTS[] = {{"tuning", Pins::TUNING_POT}, {"volume", Pins::VOLUME_POT}};
+
+const NamedPin SWITCHES[] = {{"power", Pins::POWER_SWITCH}, {"lw", Pins::LW_BAND_SWITCH},
+                             {"mw", Pins::MW_BAND_SWITCH},  {"slow", Pins::SLOW_DECODE},
+                             {"medium", Pins::MED_DECODE},  {"wifi", Pins::WIFI_BUTTON}};
+
+template <size_t N>
+int lookup(const NamedPin (&table)[N], const char* name) {
+  for (const auto& entry : table) {
+    if (strcmp(entry.name, name) == 0) return entry.pin;
+  }
+  return -1;
+}
+}  // namespace
+
+InputTrace& InputTrace::pot(unsigned long atMs, int pin, int value) {
+  add({atMs, Event::Kind::ADC, pin, value});
+  return *this;
+}
+
+InputTrace& InputTrace::sweep(unsigned long atMs, int pin, int from, int to,
+                              unsigned long durationMs) {
+  const unsigned long step = Timing::SYSTEM_UPDATE_INTERVAL;
+  for (unsigned long t = 0; t < durationMs; t += step) {
+    long value = from + static_cast<long>(to - from) * static_cast<long>(t) /
+                            static_cast<long>(durationMs);
+    pot(atMs + t, pin, static_cast<int>(value));
+  }
+  return pot(atMs + durationMs, pin, to);
+}
+
+InputTrace& InputTrace::setSwitch(unsigned long atMs, int pin, bool closed) {
+  add({atMs, Event::Kind::PIN, pin, closed ? LOW : HIGH});
+  return *this;
+}
+
+InputTrace& InputTrace::press(unsigned long atMs, int pin, unsigned long holdMs) {
+  setSwitch(atMs, pin, true);
+  return setSwitch(atMs + holdMs, pin, false);
+}
+
+void InputTrace::add(const Event& event) {
+  // Insert after everything at the same time so scripts apply in the order written
+  auto later = std::upper_bound(
+      events.begin(), events.end(), event,
+      [](const Event& a, const Event& b) { return a.atMs < b.atMs; });
+  events.insert(later, event);
+}
+
+bool InputTrace::parse(const char* text) {
+  size_t lineNumber = 0;
+  const char* line = text;
+  while (line != nullptr && *line != '\0') {
+    lineNumber++;
+    const char* end = strchr(line, '\n');
+    std::string current = end != nullptr ? std::string(line, end) : std::string(line);
+    line = end != nullptr ? end + 1 : nullptr;
+
+    size_t comment = current.find('#');
+    if (comment != std::string::npos) current.erase(comment);
+    if (current.find_first_not_of(" \t\r") == std::string::npos) continue;
+
+    if (!parseLine(current.c_str())) {
+      errorLine = lineNumber;
+      return false;
+    }
+  }
+  errorLine = 0;
+  return true;
+}
+
+bool InputTrace::parseLine(const char* line) {
+  unsigned long atMs = 0;
+  char action[16] = {};
+  char name[16] = {};
+  char arg[16] = {};
+  long a = 0;
+  long b = 0;
+  long c = 0;
+
+  if (sscanf(line, "%lu %15s %15s", &atMs, action, name) != 3) return false;
+
+  if (strcmp(action, "pot") == 0) {
+    int pin = lookup(POTS, name);
+    if (pin < 0 || sscanf(line, "%*s %*s %*s %ld", &a) != 1) return false;
+    pot(atMs, pin, static_cast<int>(a));
+  } else if (strcmp(action, "sweep") == 0) {
+    int pin = lookup(POTS, name);
+    if (pin < 0 || sscanf(line, "%*s %*s %*s %ld %ld %ld", &a, &b, &c) != 3 || c <= 0) {
+      return false;
+    }
+    sweep(atMs, pin, static_cast<int>(a), static_cast<int>(b), static_cast<unsigned long>(c));
+  } else if (strcmp(action, "switch") == 0) {
+    int pin = lookup(SWITCHES, name);
+    if (pin < 0 || sscanf(line, "%*s %*s %*s %15s", arg) != 1) return false;
+    if (strcmp(arg, "on") != 0 && strcmp(arg, "off") != 0) return false;
+    setSwitch(atMs, pin, strcmp(arg, "on") == 0);
+  } else if (strcmp(action, "press") == 0) {
+    int pin = lookup(SWITCHES, name);
+    if (pin < 0 || sscanf(line, "%*s %*s %*s %ld", &a) != 1 || a <= 0) return false;
+    press(atMs, pin, static_cast<unsigned long>(a));
+  } else {
+    return false;
+  }
+  return true;
+}
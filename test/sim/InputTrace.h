@@ -0,0 +1,53 @@
+#ifndef INPUT_TRACE_H
+#define INPUT_TRACE_H
+
+#include <cstddef>
+#include <vector>
+
+/**
+ * Scripted input for the simulator: pot moves and switch flips at device times.
+ *
+ * A trace is built in code or parsed from text, one event per line:
+ *
+ *   <ms> pot <tuning|volume> <value>
+ *   <ms> sweep <tuning|volume> <from> <to> <durationMs>
+ *   <ms> switch <power|lw|mw|slow|medium|wifi> <on|off>
+ *   <ms> press <power|lw|mw|slow|medium|wifi> <holdMs>
+ *
+ * Blank lines and anything after '#' are ignored. "on" closes the switch,
+ * which pulls its pin low. A sweep becomes one pot step per system update
+ * tick, the fastest the radio polls a pot.
+ */
+class InputTrace {
+ public:
+  struct Event {
+    enum class Kind { ADC, PIN };
+
+    unsigned long atMs;
+    Kind kind;
+    int pin;
+    int value;
+  };
+
+  InputTrace& pot(unsigned long atMs, int pin, int value);
+  InputTrace& sweep(unsigned long atMs, int pin, int from, int to, unsigned long durationMs);
+  InputTrace& setSwitch(unsigned long atMs, int pin, bool closed);
+  InputTrace& press(unsigned long atMs, int pin, unsigned long holdMs);
+
+  // Appends the events in text; returns false and stops at the first malformed line
+  bool parse(const char* text);
+  size_t getErrorLine() const { return errorLine; }
+
+  // In time order; events at the same time keep the order they were added in
+  const std::vector<Event>& getEvents() const { return events; }
+  unsigned long getEndMs() const { return events.empty() ? 0 : events.back().atMs; }
+
+ private:
+  void add(const Event& event);
+  bool parseLine(const char* line);
+
+  std::vector<Event> events;
+  size_t errorLine = 0;
+};
+
+#endif
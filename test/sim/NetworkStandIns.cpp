@@ -0,0 +1,142 @@
+// Host stand-ins for the network managers the radio calls into. The access point,
+// web server, metrics upload and OTA all need the ESP32 WiFi stack, so here WiFi
+// is a flag the radio can see, uploads never connect and OTA finds no network.
+// The network task is an esp_timer that runs service() when the task would wake,
+// so the loop budgets its idle time as it does on the board.
+
+#include "../../src/MetricsManager.h"
+#include "../../src/OTAManager.h"
+#include "../../src/PersistenceService.h"
+#include "../../src/PowerManager.h"
+#include "../../src/WiFiManager.h"
+
+#include "NetworkStandIns.h"
+
+WiFiClass WiFi;
+
+namespace {
+int recordedSleepReason = -1;
+
+constexpr unsigned long NETWORK_POLL_INTERVAL = 10;  // As WiFiManager.cpp
+esp_timer_handle_t networkTimer = nullptr;
+
+void wakeNetworkTask(unsigned long ms) {
+  esp_timer_stop(networkTimer);
+  esp_timer_start_once(networkTimer, static_cast<uint64_t>(max(ms, 1UL)) * 1000ULL);
+}
+
+// One pass of WiFiManager::runTask()
+void onNetworkTimer(void* arg) {
+  auto* wifi = static_cast<WiFiManager*>(arg);
+  wifi->service();
+  wakeNetworkTask(wifi->isEnabled() ? NETWORK_POLL_INTERVAL
+                                    : PersistenceService::getInstance().msUntilFlush(millis()));
+}
+}  // namespace
+
+int NetworkStandIns::takeSleepReason() {
+  int reason = recordedSleepReason;
+  recordedSleepReason = -1;
+  return reason;
+}
+
+void WiFiManager::begin() {
+  pinMode(Pins::WIFI_BUTTON, INPUT_PULLUP);
+  pinMode(Pins::SW_LED, OUTPUT);
+  digitalWrite(Pins::SW_LED, LOW);
+  wifiEnabled = false;
+  toggleRequested = false;
+}
+
+// Called again on every boot, after the emulator has disarmed the timer
+bool WiFiManager::startTask() {
+  if (networkTimer == nullptr) {
+    esp_timer_create_args_t timerConfig = {.callback = &onNetworkTimer,
+                                           .arg = this,
+                                           .dispatch_method = ESP_TIMER_TASK,
+                                           .name = "sim_network",
+                                           .skip_unhandled_events = true};
+    esp_timer_create(&timerConfig, &networkTimer);
+  }
+  task = xTaskGetCurrentTaskHandle();  // Any non-null handle: the loop sees a network task
+  wakeNetworkTask(1);
+  return true;
+}
+
+void WiFiManager::service() {
+  if (toggleRequested.load()) {
+    toggle();
+    toggleRequested.store(false);
+  }
+
+  PersistenceService::getInstance().update();
+  handle();
+}
+
+void WiFiManager::requestToggle() {
+  toggleRequested.store(true);
+  wakeNetworkTask(1);
+}
+
+void WiFiManager::toggle() {
+  PowerManager::getInstance().resetActivityTimer(wifiEnabled ? "WiFi Disabled" : "WiFi Enabled");
+  if (wifiEnabled) {
+    stop();
+  } else {
+    startAP();
+  }
+}
+
+void WiFiManager::startAP() {
+  startTime = millis();
+  wifiEnabled = true;
+}
+
+void WiFiManager::stop() {
+  if (wifiEnabled) {
+    digitalWrite(Pins::SW_LED, LOW);
+    wifiEnabled = false;
+  }
+}
+
+void WiFiManager::handle() {
+  if (!wifiEnabled) return;
+  updateStatusLED();
+}
+
+void WiFiManager::updateStatusLED() {
+  if (wifiEnabled && millis() - lastLedFlash >= LED_FLASH_INTERVAL) {
+    flashLED();
+    lastLedFlash = millis();
+  }
+}
+
+void WiFiManager::flashLED() { digitalWrite(Pins::SW_LED, !digitalRead(Pins::SW_LED)); }
+
+void MetricsManager::begin() { bootMillis = millis(); }
+
+void MetricsManager::recordSleepEntry(uint8_t sleepReason, bool usbPowered,
+                                      float batteryPercent) {
+  lastSleepReason = sleepReason;
+  lastSleepUsbPowered = usbPowered;
+  lastSleepBatteryPercent = batteryPercent;
+  recordedSleepReason = sleepReason;
+}
+
+bool MetricsManager::handleSleepWakeTelemetry() { return false; }
+
+bool MetricsManager::postMetricsBeforeOTAVersionCheck() { return false; }
+
+bool MetricsManager::maybePostPluggedInTelemetry() { return false; }
+
+OTAManager::UpdateResult OTAManager::checkAndUpdate() { return UpdateResult::WIFI_FAILED; }
+
+void OTAManager::addWiFiCredentials(const char* ssid, const char* password) {
+  if (credentialCount < MAX_WIFI_CREDENTIALS) {
+    wifiCredentials[credentialCount].ssid = ssid;
+    wifiCredentials[credentialCount].password = password;
+    credentialCount++;
+  }
+}
+
+void OTAManager::clearWiFiCredentials() { credentialCount = 0; }
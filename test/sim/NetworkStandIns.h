@@ -0,0 +1,11 @@
+#ifndef NETWORK_STAND_INS_H
+#define NETWORK_STAND_INS_H
+
+#include <cstdint>
+
+namespace NetworkStandIns {
+// Reason the MetricsManager stand-in last recorded on the way to sleep, or -1; clears it
+int takeSleepReason();
+}  // namespace NetworkStandIns
+
+#endif
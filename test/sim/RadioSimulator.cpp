@@ -0,0 +1,127 @@
+#include "RadioSimulator.h"
+
+#include <chrono>
+#include <cstdio>
+
+#include "../../src/InputScanner.h"
+#include "../../src/LoopWaker.h"
+#include "NetworkStandIns.h"
+
+// The Arduino entry points in main.cpp
+void setup();
+void loop();
+
+namespace {
+double secondsSince(std::chrono::steady_clock::time_point start) {
+  return std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+}
+}  // namespace
+
+RadioSimulator::RadioSimulator() {
+  esp_timer_create_args_t timerConfig = {.callback = &RadioSimulator::onTraceTimer,
+                                         .arg = this,
+                                         .dispatch_method = ESP_TIMER_TASK,
+                                         .name = "sim_trace",
+                                         .skip_unhandled_events = false};
+  esp_timer_create(&timerConfig, &traceTimer);
+}
+
+RadioSimulator::~RadioSimulator() {
+  esp_timer_stop(traceTimer);
+  esp_timer_delete(traceTimer);
+}
+
+void RadioSimulator::boot(const InputTrace& script) {
+  auto& hw = HardwareEmulator::getInstance();
+
+  // Singletons outlive a boot on the host; release what a run that did not sleep left attached
+  InputScanner::getInstance().end();
+  hw.reset();
+  hw.setPinListener(&RadioSimulator::onPinChange, this);
+
+  trace = script;
+  nextEvent = 0;
+  pins.fill(PinLog());
+  loopPasses = 0;
+  wallSeconds = 0;
+  asleep = false;
+  sleepReason = -1;
+  NetworkStandIns::takeSleepReason();  // Drop one left by an earlier run
+  idleAtBoot = LoopWaker::getInstance().getStats().idleMillis;
+
+  // Inputs set at time zero are how the board sits at power on
+  playDueEvents();
+
+  auto start = std::chrono::steady_clock::now();
+  try {
+    setup();
+  } catch (const HardwareEmulator::DeepSleep& entered) {
+    sleep = entered;
+    sleepReason = NetworkStandIns::takeSleepReason();
+    asleep = true;
+  }
+  wallSeconds += secondsSince(start);
+}
+
+bool RadioSimulator::runUntil(unsigned long ms) {
+  auto start = std::chrono::steady_clock::now();
+  try {
+    while (!asleep && millis() < ms) {
+      loop();
+      loopPasses++;
+    }
+  } catch (const HardwareEmulator::DeepSleep& entered) {
+    sleep = entered;
+    sleepReason = NetworkStandIns::takeSleepReason();
+    asleep = true;
+  }
+  wallSeconds += secondsSince(start);
+  return !asleep;
+}
+
+bool RadioSimulator::runFor(unsigned long ms) { return runUntil(millis() + ms); }
+
+void RadioSimulator::report(const char* name) const {
+  double deviceSeconds = millis() / 1000.0;
+  double idle = LoopWaker::getInstance().getStats().idleMillis - idleAtBoot;
+  printf("SIM %-20s %9.1f s device in %6.3f s wall (%8.0fx)  %8lu loops  %6.2f us/loop  "
+         "%5.1f%% idle%s\n",
+         name, deviceSeconds, wallSeconds, wallSeconds > 0 ? deviceSeconds / wallSeconds : 0.0,
+         static_cast<unsigned long>(loopPasses),
+         loopPasses > 0 ? wallSeconds * 1e6 / loopPasses : 0.0,
+         millis() > 0 ? idle * 100.0 / millis() : 0.0, asleep ? "  asleep" : "");
+}
+
+void RadioSimulator::onPinChange(int pin, int value, void* arg) {
+  auto* sim = static_cast<RadioSimulator*>(arg);
+  if (pin < 0 || pin >= static_cast<int>(MAX_PINS)) return;
+  PinLog& log = sim->pins[pin];
+  if (value != LOW) {
+    log.rising++;
+  } else {
+    log.falling++;
+  }
+  log.lastChange = millis();
+}
+
+void RadioSimulator::onTraceTimer(void* arg) { static_cast<RadioSimulator*>(arg)->playDueEvents(); }
+
+void RadioSimulator::playDueEvents() {
+  auto& hw = HardwareEmulator::getInstance();
+  const auto& events = trace.getEvents();
+  unsigned long now = millis();
+
+  for (; nextEvent < events.size() && events[nextEvent].atMs <= now; nextEvent++) {
+    const InputTrace::Event& event = events[nextEvent];
+    if (event.kind == InputTrace::Event::Kind::ADC) {
+      hw.setADCValue(event.pin, event.value);
+    } else {
+      hw.setPinState(event.pin, event.value);
+    }
+  }
+
+  if (nextEvent < events.size()) {
+    uint64_t dueUs = static_cast<uint64_t>(events[nextEvent].atMs) * 1000ULL;
+    esp_timer_start_once(traceTimer, dueUs - hw.getMicros());
+  }
+}
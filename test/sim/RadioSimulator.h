@@ -0,0 +1,81 @@
+#ifndef RADIO_SIMULATOR_H
+#define RADIO_SIMULATOR_H
+
+#include <array>
+#include <cstdint>
+
+#include "../mocks/HardwareEmulator.h"
+#include "../mocks/esp_timer.h"
+#include "InputTrace.h"
+
+/**
+ * Runs the whole firmware on the host: setup() and loop() from main.cpp,
+ * TaskScheduler and every radio manager, against HardwareEmulator.
+ *
+ * Time is virtual. When the loop blocks until its next deadline the emulated
+ * clock runs forward instead of waiting, so hours of device time take seconds.
+ * The input trace plays from an esp_timer at its exact times, so a switch
+ * flip fires the same edge interrupt and wakes the loop as on the board.
+ *
+ * Only the loop task exists on the host. The LED task and the I2S engine
+ * fail to start and the firmware takes its single-task fallbacks. WiFi,
+ * metrics and OTA are stand-ins (NetworkStandIns.cpp), with the network
+ * task played by an esp_timer. Deep sleep ends the run.
+ */
+class RadioSimulator {
+ public:
+  RadioSimulator();
+  ~RadioSimulator();
+
+  // Power-on reset of the board, then setup(); the trace starts at device time zero
+  void boot(const InputTrace& trace);
+
+  // Runs loop() until the clock reaches ms; returns false once the firmware is asleep
+  bool runUntil(unsigned long ms);
+  bool runFor(unsigned long ms);
+
+  bool isAsleep() const { return asleep; }
+  const HardwareEmulator::DeepSleep& getSleep() const { return sleep; }
+  int getSleepReason() const { return asleep ? sleepReason : -1; }  // PowerManager::SleepReason
+
+  // Every level change on every pin since boot, outputs and inputs alike
+  uint32_t getRisingEdges(int pin) const { return pins[pin].rising; }
+  uint32_t getFallingEdges(int pin) const { return pins[pin].falling; }
+  unsigned long getLastChange(int pin) const { return pins[pin].lastChange; }
+
+  uint32_t getLoopPasses() const { return loopPasses; }
+
+  // One line of device time, wall time and loop cost, for comparing runs
+  void report(const char* name) const;
+
+ private:
+  RadioSimulator(const RadioSimulator&) = delete;
+  RadioSimulator& operator=(const RadioSimulator&) = delete;
+
+  struct PinLog {
+    uint32_t rising = 0;
+    uint32_t falling = 0;
+    unsigned long lastChange = 0;
+  };
+
+  static void onPinChange(int pin, int value, void* arg);
+  static void onTraceTimer(void* arg);
+  void playDueEvents();
+
+  static constexpr size_t MAX_PINS = 64;
+
+  esp_timer_handle_t traceTimer = nullptr;
+  InputTrace trace;
+  size_t nextEvent = 0;
+
+  std::array<PinLog, MAX_PINS> pins{};
+  uint32_t loopPasses = 0;
+  uint64_t idleAtBoot = 0;
+  double wallSeconds = 0;
+
+  bool asleep = false;
+  HardwareEmulator::DeepSleep sleep = {0, -1, 0};
+  int sleepReason = -1;
+};
+
+#endif
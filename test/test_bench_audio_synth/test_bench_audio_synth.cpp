@@ -0,0 +1,104 @@
+#include <unity.h>
+
+#include <chrono>
+#include <cstdio>
+#include <vector>
+
+#include "../../src/AudioSynth.h"
+#include "../../src/StaticNoise.h"
+
+#include "../mocks/HardwareEmulator.h"
+#include "../mocks/HardwareEmulator.cpp"
+
+namespace {
+constexpr size_t BLOCK_SAMPLES = 64;
+constexpr size_t BENCH_SECONDS = 60;  // Of audio, rendered as fast as the host allows
+constexpr double REALTIME_NS_PER_SAMPLE = 1e9 / AudioSynth::SAMPLE_RATE;
+
+volatile int32_t g_sink;
+
+template <typename Body>
+double nanosPerSample(Body body) {
+  const size_t blocks = BENCH_SECONDS * AudioSynth::SAMPLE_RATE / BLOCK_SAMPLES;
+  auto start = std::chrono::steady_clock::now();
+  for (size_t block = 0; block < blocks; block++) {
+    body();
+  }
+  auto elapsed = std::chrono::steady_clock::now() - start;
+  return std::chrono::duration<double, std::nano>(elapsed).count() / (blocks * BLOCK_SAMPLES);
+}
+
+void report(const char* name, double nanos) {
+  printf("BENCH %-22s %7.2f ns/sample  %6.3f%% of the %.0f ns real-time budget\n", name, nanos,
+         100.0 * nanos / REALTIME_NS_PER_SAMPLE, REALTIME_NS_PER_SAMPLE);
+}
+}  // namespace
+
+void setUp() {}
+
+void tearDown() {}
+
+void test_bench_static_noise_per_sample() {
+  StaticNoise noise;
+  double nanos = nanosPerSample([&]() {
+    noise.beginBlock(BLOCK_SAMPLES, Audio::MAX_CRACKLE_CHANCE);
+    int32_t accumulator = 0;
+    for (size_t i = 0; i < BLOCK_SAMPLES; i++) {
+      accumulator += noise.next();
+    }
+    g_sink = accumulator;
+  });
+  report("StaticNoise::next", nanos);
+  TEST_ASSERT_TRUE(nanos < REALTIME_NS_PER_SAMPLE / 100);
+}
+
+void test_bench_synth_render_tone_and_static() {
+  AudioSynth synth;
+  synth.setToneFrequency(600);
+  synth.setToneLevel(200);
+  synth.setStatic(160, Audio::MAX_CRACKLE_CHANCE);
+  std::vector<int16_t> block(BLOCK_SAMPLES);
+
+  // Key every few blocks so the envelope ramps are part of the measurement
+  size_t blockIndex = 0;
+  double nanos = nanosPerSample([&]() {
+    synth.setToneKeyed((blockIndex++ / 3) % 2 == 0);
+    synth.render(block.data(), block.size());
+    g_sink = block[BLOCK_SAMPLES - 1];
+  });
+  report("AudioSynth::render", nanos);
+  TEST_ASSERT_TRUE(nanos < REALTIME_NS_PER_SAMPLE / 100);
+}
+
+void test_bench_synth_render_crowded_band() {
+  AudioSynth synth;
+  MorseTimeline first;
+  MorseTimeline second;
+  first.compile("CQ CQ DE DUBLIN");
+  second.compile("VVV LONDON CALLING");
+
+  synth.setToneFrequency(600);
+  synth.setToneLevel(160);
+  synth.setStatic(96, Audio::MAX_CRACKLE_CHANCE);
+  synth.setKeyingTimings(&Audio::MORSE_FAST);
+  synth.setInterferer(0, &first, 690, 120);
+  synth.setInterferer(1, &second, 480, 80);
+  std::vector<int16_t> block(BLOCK_SAMPLES);
+
+  size_t blockIndex = 0;
+  double nanos = nanosPerSample([&]() {
+    synth.setToneKeyed((blockIndex++ / 3) % 2 == 0);
+    synth.render(block.data(), block.size());
+    g_sink = block[BLOCK_SAMPLES - 1];
+  });
+  report("render, 3 stations", nanos);
+  TEST_ASSERT_TRUE(nanos < REALTIME_NS_PER_SAMPLE / 100);
+}
+
+int main() {
+  UNITY_BEGIN();
+  RUN_TEST(test_bench_static_noise_per_sample);
+  RUN_TEST(test_bench_synth_render_tone_and_static);
+  RUN_TEST(test_bench_synth_render_crowded_band);
+  return UNITY_END();
+}
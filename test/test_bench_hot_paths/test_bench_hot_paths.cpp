@@ -0,0 +1,86 @@
+#include <unity.h>
+
+#include <chrono>
+#include <cstdio>
+
+#include "../../src/BenchRunner.h"
+#include "../../src/PersistenceService.h"
+#include "../../src/StationManager.h"
+
+#include "../mocks/HardwareEmulator.h"
+#include "../mocks/HardwareEmulator.cpp"
+#include "../../src/AdcSampler.cpp"
+#include "../../src/AudioManager.cpp"
+#include "../../src/BenchRunner.cpp"
+#include "../../src/MorseCode.cpp"
+#include "../../src/MorseKeyer.cpp"
+#include "../../src/PowerManager.cpp"
+#include "../../src/SampleAudioEngine.cpp"
+#include "../sim/NetworkStandIns.cpp"
+
+namespace {
+// The device runner's cases, timed with the wall clock since the mock cycle counter is virtual
+BenchRunner::Result timeCase(const BenchRunner::Case& benchCase) {
+  if (benchCase.setup != nullptr) benchCase.setup();
+  auto start = std::chrono::steady_clock::now();
+  for (uint32_t i = 0; i < benchCase.iterations; i++) {
+    benchCase.run(i);
+  }
+  auto elapsed = std::chrono::steady_clock::now() - start;
+  if (benchCase.teardown != nullptr) benchCase.teardown();
+
+  BenchRunner::Result result = {};
+  result.name = benchCase.name;
+  result.iterations = benchCase.iterations;
+  result.nsPerOp = std::chrono::duration<double, std::nano>(elapsed).count() / benchCase.iterations;
+  return result;
+}
+}  // namespace
+
+void setUp() {
+  HardwareEmulator::getInstance().reset();
+  StationManager::getInstance().begin();
+  StationManager::getInstance().resetToDefaults();
+  PersistenceService::getInstance().flush();
+  AudioManager::getInstance().begin();
+  MorseCode::getInstance().begin();
+}
+
+void tearDown() {}
+
+void test_bench_hot_paths() {
+  size_t count = 0;
+  const BenchRunner::Case* cases = BenchRunner::getCases(count);
+  TEST_ASSERT_TRUE(count > 0);
+
+  char json[256];
+  for (size_t i = 0; i < count; i++) {
+    BenchRunner::Result result = timeCase(cases[i]);
+    printf("BENCH %-36s %9.1f ns/op\n", result.name, result.nsPerOp);
+
+    // The same line the device prints, for diffing runs across commits
+    TEST_ASSERT_TRUE(BenchRunner::writeJson(result, json, sizeof(json)) > 0);
+    printf("BENCH_JSON %s\n", json);
+  }
+}
+
+void test_bench_json_reports_cycles_when_measured() {
+  BenchRunner::Result result = {"probe", 10, 250.0, 60.0, 48};
+  char json[256];
+  TEST_ASSERT_TRUE(BenchRunner::writeJson(result, json, sizeof(json)) > 0);
+  TEST_ASSERT_EQUAL_STRING(
+      "{\"bench\":\"probe\",\"target\":\"host\",\"version\":\"" FIRMWARE_VERSION
+      "\",\"iterations\":10,\"nsPerOp\":250.0,\"cyclesPerOp\":60.0,\"minCycles\":48}",
+      json);
+
+  // Truncated output is reported as nothing written
+  volatile size_t tight = 16;
+  TEST_ASSERT_EQUAL(0, static_cast<int>(BenchRunner::writeJson(result, json, tight)));
+}
+
+int main() {
+  UNITY_BEGIN();
+  RUN_TEST(test_bench_hot_paths);
+  RUN_TEST(test_bench_json_reports_cycles_when_measured);
+  return UNITY_END();
+}
@@ -0,0 +1,125 @@
+#include <unity.h>
+
+#include <chrono>
+#include <cstdio>
+
+#include "../../src/Config.h"
+#include "../../src/PotentiometerReader.h"
+
+#include "../mocks/HardwareEmulator.h"
+#include "../mocks/HardwareEmulator.cpp"
+#include "../mocks/PotTrace.h"
+
+namespace {
+constexpr size_t ITERATIONS = 200000;
+
+// The fixed filter PotentiometerReader used before the chains, kept as the baseline
+class LegacyPotFilter {
+ public:
+  static constexpr int WINDOW_SIZE = 5;
+  static constexpr int HYSTERESIS = 10;
+
+  explicit LegacyPotFilter(int pin) : pin_(pin) {}
+
+  void begin() {
+    int initial = analogRead(pin_);
+    for (int i = 0; i < WINDOW_SIZE; i++) window_[i] = initial;
+    sum_ = static_cast<long>(initial) * WINDOW_SIZE;
+    stable_ = initial;
+  }
+
+  int read() { return push(analogRead(pin_)); }
+
+  int push(int sample) {
+    sum_ += sample - window_[index_];
+    window_[index_] = sample;
+    index_ = (index_ + 1) % WINDOW_SIZE;
+    int difference = sum_ / WINDOW_SIZE - stable_;
+    int threshold = abs(difference) > HYSTERESIS * 2 ? HYSTERESIS * 1.5 : HYSTERESIS;
+    if (abs(difference) > threshold) {
+      stable_ += difference > 0 ? min(difference, HYSTERESIS * 2) : max(difference, -HYSTERESIS * 2);
+    }
+    return stable_;
+  }
+
+ private:
+  const int pin_;
+  int window_[WINDOW_SIZE] = {};
+  int index_ = 0;
+  long sum_ = 0;
+  int stable_ = 0;
+};
+
+struct Response {
+  size_t stepSettling;  // Loop ticks until within the tuning leeway after a quick turn
+  double sweepLag;      // Mean counts behind the dial during a full-range sweep
+  size_t restChanges;   // Output changes while the dial rests with ADC noise
+};
+
+template <typename Reader>
+Response measure() {
+  auto& hw = HardwareEmulator::getInstance();
+  Response response;
+
+  hw.reset();
+  Reader stepReader(Pins::TUNING_POT);
+  hw.setADCValue(Pins::TUNING_POT, 1000);
+  stepReader.begin();
+  std::vector<int> step = PotTrace::step(1000, 3000, 50, 200);
+  std::vector<int> output = PotTrace::playTrace(stepReader, Pins::TUNING_POT, step);
+  response.stepSettling = PotTrace::settlingSamples(output, 50, 3000, Radio::TUNING_LEEWAY);
+  response.restChanges = PotTrace::outputChanges(output, 100, output.size()) +
+                         PotTrace::outputChanges(output, 0, 50);
+
+  hw.reset();
+  Reader sweepReader(Pins::TUNING_POT);
+  hw.setADCValue(Pins::TUNING_POT, 0);
+  sweepReader.begin();
+  std::vector<int> sweep = PotTrace::sweep(0, 4000, 100, 50);  // Whole dial in one second
+  output = PotTrace::playTrace(sweepReader, Pins::TUNING_POT, sweep);
+  response.sweepLag = PotTrace::meanLag(output, sweep, 10, 100);
+  return response;
+}
+
+template <typename Reader>
+double nanosPerSample() {
+  HardwareEmulator::getInstance().reset();
+  Reader reader(Pins::TUNING_POT);
+  reader.begin();
+  volatile int sink = 0;
+  auto start = std::chrono::steady_clock::now();
+  for (size_t i = 0; i < ITERATIONS; i++) {
+    sink = reader.push(2000 + static_cast<int>(i & 15));
+  }
+  auto elapsed = std::chrono::steady_clock::now() - start;
+  (void)sink;
+  return std::chrono::duration<double, std::nano>(elapsed).count() / ITERATIONS;
+}
+
+void report(const char* name, const Response& response, double nanos) {
+  printf("BENCH %-20s step %3zu ticks  sweep lag %6.1f counts  rest changes %3zu  %6.1f ns/sample\n",
+         name, response.stepSettling, response.sweepLag, response.restChanges, nanos);
+}
+}  // namespace
+
+void setUp() {}
+
+void tearDown() {}
+
+void test_bench_tuning_filter_response() {
+  Response legacy = measure<LegacyPotFilter>();
+  Response chain = measure<TuningPotReader>();
+  report("legacy average+slew", legacy, nanosPerSample<LegacyPotFilter>());
+  report("tuning chain", chain, nanosPerSample<TuningPotReader>());
+
+  // Less lag when sweeping, no more jitter when still
+  TEST_ASSERT_LESS_THAN(legacy.stepSettling, chain.stepSettling);
+  TEST_ASSERT_TRUE(chain.sweepLag < legacy.sweepLag);
+  TEST_ASSERT_LESS_OR_EQUAL(legacy.restChanges, chain.restChanges);
+}
+
+int main() {
+  UNITY_BEGIN();
+  RUN_TEST(test_bench_tuning_filter_response);
+  return UNITY_END();
+}
@@ -0,0 +1,136 @@
+#include <unity.h>
+
+#include <chrono>
+#include <cstdio>
+
+#include "../../src/Config.h"
+#include "../../src/PersistenceService.h"
+#include "../../src/StationManager.h"
+
+#include "../mocks/HardwareEmulator.h"
+#include "../mocks/HardwareEmulator.cpp"
+
+namespace {
+constexpr size_t CATALOGUE_SIZE = 200;
+constexpr size_t ITERATIONS = 200;
+
+// The key-per-field layout StationStorage wrote before the blob format, kept as the baseline
+void saveLegacyKeys(const std::vector<Station>& stations) {
+  Preferences prefs;
+  prefs.begin("bench_legacy", false);
+  char key[32];
+  for (size_t i = 0; i < stations.size(); i++) {
+    snprintf(key, sizeof(key), "freq%zu", i);
+    prefs.putInt(key, stations[i].getFrequency());
+    snprintf(key, sizeof(key), "msg%zu", i);
+    prefs.putString(key, stations[i].getMessage());
+    snprintf(key, sizeof(key), "enabled%zu", i);
+    prefs.putBool(key, stations[i].isEnabled());
+  }
+  prefs.end();
+}
+
+size_t loadLegacyKeys(size_t count) {
+  Preferences prefs;
+  prefs.begin("bench_legacy", true);
+  char key[32];
+  size_t bytes = 0;
+  for (size_t i = 0; i < count; i++) {
+    snprintf(key, sizeof(key), "freq%zu", i);
+    bytes += prefs.getInt(key, 0) != 0;
+    snprintf(key, sizeof(key), "msg%zu", i);
+    bytes += prefs.getString(key, "").length();
+    snprintf(key, sizeof(key), "enabled%zu", i);
+    bytes += prefs.getBool(key, true);
+  }
+  prefs.end();
+  return bytes;
+}
+
+template <typename Body>
+double microsPerCall(Body body) {
+  auto start = std::chrono::steady_clock::now();
+  for (size_t i = 0; i < ITERATIONS; i++) {
+    body(i);
+  }
+  auto elapsed = std::chrono::steady_clock::now() - start;
+  return std::chrono::duration<double, std::micro>(elapsed).count() / ITERATIONS;
+}
+
+// Host timings measure the mock store; the write count is what costs flash time and wear
+void report(const char* name, double micros, double writes) {
+  printf("BENCH %-26s %9.2f us/op  %7.1f NVS writes/op\n", name, micros, writes);
+}
+
+void fillCatalogue(StationManager& manager) {
+  manager.begin();
+  manager.resetToDefaults();
+  char name[16];
+  for (size_t i = manager.getStationCount(); i < CATALOGUE_SIZE; i++) {
+    snprintf(name, sizeof(name), "Bench %zu", i);
+    manager.addStation(name, static_cast<WaveBand>(i % 3), static_cast<int>(i * 20 % 4096),
+                       "CQ CQ THIS IS A BENCHMARK STATION");
+  }
+  PersistenceService::getInstance().flush();
+}
+}  // namespace
+
+void setUp() {}
+
+void tearDown() {}
+
+void test_bench_single_edit_save() {
+  auto& manager = StationManager::getInstance();
+  fillCatalogue(manager);
+  TEST_ASSERT_EQUAL(CATALOGUE_SIZE, manager.getStationCount());
+  char message[32];
+
+  size_t writes = Preferences::writeCount();
+  double legacy = microsPerCall([&](size_t i) {
+    Station* station = manager.getStation(i % CATALOGUE_SIZE);
+    station->setFrequency(station->getFrequency() ^ 1);
+    saveLegacyKeys(manager.getAllStations());
+  });
+  double legacyWrites = double(Preferences::writeCount() - writes) / ITERATIONS;
+
+  writes = Preferences::writeCount();
+  double blob = microsPerCall([&](size_t i) {
+    size_t index = i % CATALOGUE_SIZE;
+    snprintf(message, sizeof(message), "EDIT %zu", i);
+    manager.updateStation(index, manager.getStation(index)->getFrequency(), message, true);
+    PersistenceService::getInstance().flush();
+  });
+  double blobWrites = double(Preferences::writeCount() - writes) / ITERATIONS;
+
+  report("save one edit, legacy keys", legacy, legacyWrites);
+  report("save one edit, blob pages", blob, blobWrites);
+  TEST_ASSERT_TRUE(blobWrites <= 2.0);
+  TEST_ASSERT_TRUE(blobWrites * 10 < legacyWrites);
+}
+
+void test_bench_catalogue_load() {
+  auto& manager = StationManager::getInstance();
+  fillCatalogue(manager);
+  saveLegacyKeys(manager.getAllStations());
+
+  volatile size_t sink = 0;
+  double legacy = microsPerCall([&](size_t) { sink = loadLegacyKeys(CATALOGUE_SIZE); });
+  double blob = microsPerCall([&](size_t) {
+    manager.loadFromPreferences();
+    sink = manager.getStationCount();
+  });
+  (void)sink;
+
+  report("load, legacy keys", legacy, 0);
+  report("load, blob pages", blob, 0);
+  TEST_ASSERT_EQUAL(CATALOGUE_SIZE, manager.getStationCount());
+  manager.resetToDefaults();
+  PersistenceService::getInstance().flush();
+}
+
+int main() {
+  UNITY_BEGIN();
+  RUN_TEST(test_bench_single_edit_save);
+  RUN_TEST(test_bench_catalogue_load);
+  return UNITY_END();
+}
@@ -0,0 +1,268 @@
+#include <unity.h>
+
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <cstdlib>
+#include <vector>
+
+#include "../../src/AudioSynth.h"
+#include "../../src/StaticNoise.h"
+
+#include "../mocks/HardwareEmulator.h"
+#include "../mocks/HardwareEmulator.cpp"
+
+namespace {
+constexpr size_t ONE_SECOND = AudioSynth::SAMPLE_RATE;
+
+std::vector<int16_t> renderBlocks(AudioSynth& synth, size_t samples, size_t blockSize = 64) {
+  std::vector<int16_t> out(samples);
+  for (size_t offset = 0; offset < samples; offset += blockSize) {
+    size_t count = samples - offset < blockSize ? samples - offset : blockSize;
+    synth.render(out.data() + offset, count);
+  }
+  return out;
+}
+
+int countRisingZeroCrossings(const std::vector<int16_t>& samples) {
+  int crossings = 0;
+  for (size_t i = 1; i < samples.size(); i++) {
+    if (samples[i - 1] < 0 && samples[i] >= 0) crossings++;
+  }
+  return crossings;
+}
+
+int peakOf(const std::vector<int16_t>& samples, size_t begin = 0, size_t end = SIZE_MAX) {
+  int peak = 0;
+  for (size_t i = begin; i < samples.size() && i < end; i++) {
+    if (abs(samples[i]) > peak) peak = abs(samples[i]);
+  }
+  return peak;
+}
+
+int largestStep(const std::vector<int16_t>& samples) {
+  int step = 0;
+  for (size_t i = 1; i < samples.size(); i++) {
+    int delta = abs(samples[i] - samples[i - 1]);
+    if (delta > step) step = delta;
+  }
+  return step;
+}
+}  // namespace
+
+void setUp() {}
+
+void tearDown() {}
+
+void test_synth_is_silent_until_a_source_is_posted() {
+  AudioSynth synth;
+  synth.setToneFrequency(600);
+  synth.setToneLevel(255);
+
+  std::vector<int16_t> samples = renderBlocks(synth, 256);
+  TEST_ASSERT_TRUE(synth.isSilent());
+  TEST_ASSERT_EQUAL(0, peakOf(samples));
+}
+
+void test_synth_renders_keyed_tone_at_requested_pitch() {
+  AudioSynth synth;
+  synth.setToneFrequency(600);
+  synth.setToneLevel(255);
+  synth.setToneKeyed(true);
+
+  std::vector<int16_t> samples = renderBlocks(synth, ONE_SECOND);
+  TEST_ASSERT_FALSE(synth.isSilent());
+  TEST_ASSERT_INT_WITHIN(1, 600, countRisingZeroCrossings(samples));
+  TEST_ASSERT_INT_WITHIN(200, 16383, peakOf(samples));
+
+  // Un-keying takes effect from the next block and decays within the release time
+  synth.setToneKeyed(false);
+  std::vector<int16_t> release = renderBlocks(synth, 256);
+  TEST_ASSERT_EQUAL(0, peakOf(release, ONE_SECOND * Audio::MORSE_ENVELOPE_MS / 1000));
+  renderBlocks(synth, 64);
+  TEST_ASSERT_TRUE(synth.isSilent());
+}
+
+void test_synth_shapes_key_edges_with_raised_cosine_envelope() {
+  AudioSynth synth;
+  synth.setToneFrequency(600);
+  synth.setToneLevel(255);
+  synth.setToneEnvelope(8);
+  const size_t rampSamples = ONE_SECOND * 8 / 1000;
+
+  // Key on for ~19 ms, ending on a sine peak where a hard gate would click hardest
+  synth.setToneKeyed(true);
+  std::vector<int16_t> attack = renderBlocks(synth, 300);
+  synth.setToneKeyed(false);
+  std::vector<int16_t> release = renderBlocks(synth, 320);
+
+  // The first millisecond stays near silence, then the tone reaches full level
+  TEST_ASSERT_TRUE(peakOf(attack, 0, ONE_SECOND / 1000) < 16383 / 20);
+  TEST_ASSERT_INT_WITHIN(200, 16383, peakOf(attack, rampSamples));
+  TEST_ASSERT_TRUE(peakOf(release, rampSamples / 2) < 16383 / 2);
+  TEST_ASSERT_EQUAL(0, peakOf(release, rampSamples));
+
+  // No sample-to-sample jump is much above what the 600 Hz sine has on its own
+  const int sineSlope = static_cast<int>(16383 * 6.2832 * 600 / ONE_SECOND);
+  TEST_ASSERT_TRUE(largestStep(attack) <= sineSlope * 11 / 10);
+  TEST_ASSERT_TRUE(largestStep(release) <= sineSlope * 11 / 10);
+}
+
+void test_static_noise_is_band_limited_hiss() {
+  StaticNoise noise;
+  std::vector<int32_t> samples;
+  for (size_t i = 0; i < ONE_SECOND; i += 64) {
+    noise.beginBlock(64, 0);
+    for (size_t j = 0; j < 64; j++) {
+      samples.push_back(noise.next());
+    }
+  }
+  TEST_ASSERT_FALSE(noise.isCrackling());
+
+  double mean = 0;
+  for (int32_t sample : samples) mean += sample;
+  mean /= samples.size();
+
+  double variance = 0;
+  double lagOne = 0;
+  for (size_t i = 0; i < samples.size(); i++) {
+    variance += (samples[i] - mean) * (samples[i] - mean);
+    if (i > 0) lagOne += (samples[i] - mean) * (samples[i - 1] - mean);
+    TEST_ASSERT_TRUE(abs(samples[i]) <= StaticNoise::PEAK);
+  }
+
+  // High-pass removes DC; low-pass correlates neighbours, which white noise would not
+  TEST_ASSERT_TRUE(fabs(mean) < 200);
+  TEST_ASSERT_INT_WITHIN(3000, 6000, static_cast<int>(sqrt(variance / samples.size())));
+  TEST_ASSERT_TRUE(lagOne / variance > 0.15);
+  TEST_ASSERT_TRUE(lagOne / variance < 0.6);
+}
+
+void test_static_noise_crackles_in_bursts() {
+  StaticNoise quiet;
+  StaticNoise crackling;
+  int quietPeak = 0;
+  int cracklePeak = 0;
+  size_t burstSamples = 0;
+
+  // A 100% chance starts a burst on the first roll, which then runs its course
+  for (size_t block = 0; block < ONE_SECOND / 64; block++) {
+    quiet.beginBlock(64, 0);
+    crackling.beginBlock(64, 100);
+    if (burstSamples > 0 && !crackling.isCrackling()) break;
+
+    for (size_t i = 0; i < 64; i++) {
+      if (crackling.isCrackling()) burstSamples++;
+      quietPeak = std::max(quietPeak, abs(static_cast<int>(quiet.next())));
+      cracklePeak = std::max(cracklePeak, abs(static_cast<int>(crackling.next())));
+    }
+  }
+
+  TEST_ASSERT_FALSE(quiet.isCrackling());
+  TEST_ASSERT_TRUE(burstSamples >= ONE_SECOND * Audio::CRACKLE_DURATION_MIN / 1000);
+  TEST_ASSERT_TRUE(burstSamples <= ONE_SECOND * Audio::CRACKLE_DURATION_MAX / 1000);
+  TEST_ASSERT_TRUE(cracklePeak > quietPeak);
+}
+
+void test_static_noise_draws_like_arduino_random() {
+  // The LEDC static pattern's variations: half-open ranges, every value reachable
+  StaticNoise noise;
+  bool seen[11] = {};
+  for (int i = 0; i < 1000; i++) {
+    int32_t value = noise.between(-5, 6);
+    TEST_ASSERT_TRUE(value >= -5 && value < 6);
+    seen[value + 5] = true;
+  }
+  for (bool hit : seen) TEST_ASSERT_TRUE(hit);
+
+  // An empty range gives its lower bound, as random() does
+  TEST_ASSERT_EQUAL(7, noise.between(7, 7));
+  TEST_ASSERT_EQUAL(7, noise.between(7, 3));
+}
+
+void test_synth_mixes_static_under_tone_without_clipping() {
+  AudioSynth synth;
+  synth.setStatic(255, Audio::MAX_CRACKLE_CHANCE);
+  std::vector<int16_t> staticOnly = renderBlocks(synth, ONE_SECOND);
+  TEST_ASSERT_FALSE(synth.isSilent());
+  TEST_ASSERT_TRUE(peakOf(staticOnly) <= StaticNoise::PEAK);
+
+  synth.setToneFrequency(600);
+  synth.setToneLevel(255);
+  synth.setToneKeyed(true);
+  std::vector<int16_t> mixed = renderBlocks(synth, ONE_SECOND);
+  TEST_ASSERT_TRUE(peakOf(mixed) > 16383);
+  TEST_ASSERT_TRUE(peakOf(mixed) <= 32767);
+}
+
+void test_synth_applies_per_source_and_master_gain() {
+  AudioSynth synth;
+  synth.setToneFrequency(600);
+  synth.setToneKeyed(true);
+
+  // A half-strength station: tone and static bed at equal gain
+  synth.setToneLevel(128);
+  synth.setStatic(0, 0);
+  int tonePeak = peakOf(renderBlocks(synth, ONE_SECOND / 10), ONE_SECOND / 100);
+  TEST_ASSERT_INT_WITHIN(200, 16383 / 2, tonePeak);
+
+  synth.setStatic(128, 0);
+  int mixedPeak = peakOf(renderBlocks(synth, ONE_SECOND / 10));
+  TEST_ASSERT_TRUE(mixedPeak > tonePeak);
+
+  // The master gain scales the whole mix, and zero silences it outright
+  synth.setStatic(0, 0);
+  synth.setMasterLevel(128);
+  TEST_ASSERT_INT_WITHIN(200, tonePeak / 2, peakOf(renderBlocks(synth, ONE_SECOND / 10)));
+
+  synth.setMasterLevel(0);
+  TEST_ASSERT_EQUAL(0, peakOf(renderBlocks(synth, 128)));
+  TEST_ASSERT_TRUE(synth.isSilent());
+}
+
+void test_synth_keys_interferers_from_their_own_timelines() {
+  AudioSynth synth;
+  MorseTimeline dot;
+  MorseTimeline dash;
+  dot.compile("E");   // 200 ms on, 800 ms letter gap at FAST
+  dash.compile("T");  // 600 ms on, 800 ms letter gap at FAST
+
+  synth.setKeyingTimings(&Audio::MORSE_FAST);
+  synth.setInterferer(0, &dot, 900, 255);
+  std::vector<int16_t> samples = renderBlocks(synth, ONE_SECOND * 12 / 10);
+  TEST_ASSERT_EQUAL_PTR(&dot, synth.getInterfererTimelineInUse(0));
+
+  // Keyed for the dot, silent through the gap, then the message repeats
+  const size_t ms = ONE_SECOND / 1000;
+  TEST_ASSERT_INT_WITHIN(200, 16383, peakOf(samples, 10 * ms, 190 * ms));
+  TEST_ASSERT_EQUAL(0, peakOf(samples, 210 * ms, 995 * ms));
+  TEST_ASSERT_INT_WITHIN(200, 16383, peakOf(samples, 1010 * ms, 1190 * ms));
+
+  // A second slot runs independently at its own gain
+  synth.setInterferer(0, nullptr, 0, 0);
+  synth.setInterferer(1, &dash, 700, 128);
+  samples = renderBlocks(synth, ONE_SECOND / 2);
+  TEST_ASSERT_NULL(synth.getInterfererTimelineInUse(0));
+  TEST_ASSERT_EQUAL_PTR(&dash, synth.getInterfererTimelineInUse(1));
+  TEST_ASSERT_INT_WITHIN(200, 16383 / 2, peakOf(samples, 10 * ms));
+  TEST_ASSERT_INT_WITHIN(1, 350, countRisingZeroCrossings(samples));
+
+  synth.silence();
+  renderBlocks(synth, 256);
+  TEST_ASSERT_NULL(synth.getInterfererTimelineInUse(1));
+  TEST_ASSERT_TRUE(synth.isSilent());
+}
+
+int main(int argc, char** argv) {
+  UNITY_BEGIN();
+  RUN_TEST(test_synth_is_silent_until_a_source_is_posted);
+  RUN_TEST(test_synth_renders_keyed_tone_at_requested_pitch);
+  RUN_TEST(test_synth_shapes_key_edges_with_raised_cosine_envelope);
+  RUN_TEST(test_static_noise_is_band_limited_hiss);
+  RUN_TEST(test_static_noise_crackles_in_bursts);
+  RUN_TEST(test_static_noise_draws_like_arduino_random);
+  RUN_TEST(test_synth_mixes_static_under_tone_without_clipping);
+  RUN_TEST(test_synth_applies_per_source_and_master_gain);
+  RUN_TEST(test_synth_keys_interferers_from_their_own_timelines);
+  return UNITY_END();
+}
@@ -1,15 +1,27 @@
 #include <unity.h>
+#include <string>
 
 #include "../../src/Config.h"
+#include "../../src/ButtonDebouncer.h"
+#include "../../src/InputScanner.h"
+#include "../../src/JsonRecordReader.h"
+#include "../../src/LoopWaker.h"
+#include "../../src/PerfMonitor.h"
+#include "../../src/PotentiometerReader.h"
+#include "../../src/RadioState.h"
+#include "../../src/RequestBody.h"
 #include "../../src/SignalManager.h"
 #include "../../src/SpeedManager.h"
+#include "../../src/Telemetry.h"
 #include "../../src/WaveBandManager.h"
 
 #include "../mocks/HardwareEmulator.h"
 #include "../mocks/HardwareEmulator.cpp"
+#include "../mocks/PotTrace.h"
 
 void setUp() {
   auto& hw = HardwareEmulator::getInstance();
+  InputScanner::getInstance().end();
   hw.reset();
   ConfigManager::getInstance().reset();
 }
@@ -25,6 +37,7 @@ void test_speed_manager_updates_state_and_skips_redundant_pwm_write() {
 
   hw.setPinState(Pins::SLOW_DECODE, HIGH);
   hw.setPinState(Pins::MED_DECODE, HIGH);
+  InputScanner::getInstance().scan();
 
   speed.update();
   TEST_ASSERT_EQUAL(static_cast<int>(MorseSpeed::MEDIUM), static_cast<int>(config.getMorseSpeed()));
@@ -35,6 +48,7 @@ void test_speed_manager_updates_state_and_skips_redundant_pwm_write() {
   TEST_ASSERT_EQUAL_UINT32(writesBefore, hw.getLedcWriteCount(PWMChannels::DECODE));
 
   hw.setPinState(Pins::MED_DECODE, LOW);
+  InputScanner::getInstance().scan();
   speed.update();
   TEST_ASSERT_EQUAL(static_cast<int>(MorseSpeed::FAST), static_cast<int>(config.getMorseSpeed()));
   TEST_ASSERT_EQUAL(255, static_cast<int>(hw.getLedcDuty(PWMChannels::DECODE)));
@@ -49,6 +63,7 @@ void test_wave_band_manager_updates_band_and_leds() {
 
   hw.setPinState(Pins::LW_BAND_SWITCH, LOW);
   hw.setPinState(Pins::MW_BAND_SWITCH, HIGH);
+  InputScanner::getInstance().scan();
   manager.update();
 
   TEST_ASSERT_EQUAL(static_cast<int>(WaveBand::LONG_WAVE), static_cast<int>(config.getWaveBand()));
@@ -77,10 +92,365 @@ void test_signal_manager_clamps_and_deduplicates_updates() {
   TEST_ASSERT_EQUAL(HIGH, hw.getPinState(Pins::LOCK_LED));
 }
 
+void test_input_scanner_reads_all_inputs_once_per_pass() {
+  auto& hw = HardwareEmulator::getInstance();
+  auto& inputs = InputScanner::getInstance();
+  ButtonDebouncer button(Pins::WIFI_BUTTON, 50, true);
+
+  inputs.begin();
+  button.begin();
+  TEST_ASSERT_EQUAL_UINT64(InputScanner::INPUT_MASK, inputs.getLevels());
+
+  hw.setPinState(Pins::WIFI_BUTTON, LOW);
+  hw.setPinState(Pins::LW_BAND_SWITCH, LOW);
+  uint32_t readsBefore = hw.getGpioRegisterReads();
+  inputs.scan();
+
+  // Every input comes from the one register read, edges are an XOR with the last pass
+  TEST_ASSERT_EQUAL_UINT32(readsBefore + 1, hw.getGpioRegisterReads());
+  TEST_ASSERT_EQUAL_UINT64(InputScanner::bit(Pins::WIFI_BUTTON) | InputScanner::bit(Pins::LW_BAND_SWITCH),
+                           inputs.getChanged());
+  TEST_ASSERT_TRUE(inputs.fell(Pins::WIFI_BUTTON));
+  TEST_ASSERT_EQUAL(LOW, inputs.read(Pins::LW_BAND_SWITCH));
+  TEST_ASSERT_EQUAL(HIGH, inputs.read(Pins::POWER_SWITCH));
+
+  // The debouncer works from the snapshot, not from the pin
+  button.update();
+  hw.advanceMillis(60);
+  inputs.scan();
+  TEST_ASSERT_EQUAL_UINT64(0, inputs.getChanged());
+  button.update();
+  TEST_ASSERT_TRUE(button.wasPressed());
+
+  hw.setPinState(Pins::WIFI_BUTTON, HIGH);
+  inputs.scan();
+  TEST_ASSERT_TRUE(inputs.rose(Pins::WIFI_BUTTON));
+  TEST_ASSERT_EQUAL_UINT32(readsBefore + 3, hw.getGpioRegisterReads());
+}
+
+void test_input_edges_from_interrupts_drive_debounce_and_idle_scans() {
+  auto& hw = HardwareEmulator::getInstance();
+  auto& inputs = InputScanner::getInstance();
+  ButtonDebouncer button(Pins::WIFI_BUTTON, 50, true);
+
+  LoopWaker::getInstance().begin();
+  inputs.begin();
+  TEST_ASSERT_TRUE(inputs.enableEdgeInterrupts());
+  button.begin();
+
+  // With no edges a pass touches no register
+  uint32_t readsBefore = hw.getGpioRegisterReads();
+  inputs.scan();
+  TEST_ASSERT_EQUAL_UINT32(readsBefore, hw.getGpioRegisterReads());
+  TEST_ASSERT_FALSE(inputs.hasPendingEdges());
+
+  // A bouncing press: each edge is queued with its own timestamp
+  uint32_t edgesBefore = inputs.getEdgeCount();
+  hw.setPinState(Pins::WIFI_BUTTON, LOW);
+  hw.advanceMillis(2);
+  hw.setPinState(Pins::WIFI_BUTTON, HIGH);
+  hw.advanceMillis(3);
+  hw.setPinState(Pins::WIFI_BUTTON, LOW);
+  TEST_ASSERT_TRUE(inputs.hasPendingEdges());
+  uint32_t lastBounce = micros();
+
+  // The edges already woke the loop, so an idle wait returns at once
+  TEST_ASSERT_TRUE(LoopWaker::getInstance().sleepFor(Timing::MAX_IDLE_INTERVAL));
+  TEST_ASSERT_EQUAL_UINT32(lastBounce, micros());
+
+  hw.advanceMillis(40);
+  inputs.scan();
+  TEST_ASSERT_TRUE(inputs.fell(Pins::WIFI_BUTTON));
+  TEST_ASSERT_EQUAL_UINT32(lastBounce, inputs.getLastEdgeMicros(Pins::WIFI_BUTTON));
+  TEST_ASSERT_EQUAL_UINT32(edgesBefore + 3, inputs.getEdgeCount());
+
+  // Debounce counts from the last bounce, not from when the loop noticed it
+  button.update();
+  TEST_ASSERT_FALSE(button.wasPressed());
+  hw.advanceMillis(11);
+  inputs.scan();
+  button.update();
+  TEST_ASSERT_TRUE(button.wasPressed());
+
+  // More edges than the queue holds between passes: the scan resyncs from the register
+  for (int i = 0; i < 41; i++) {
+    hw.setPinState(Pins::LW_BAND_SWITCH, i % 2 == 0 ? LOW : HIGH);
+  }
+  inputs.scan();
+  TEST_ASSERT_TRUE(inputs.isLow(Pins::LW_BAND_SWITCH));
+  TEST_ASSERT_FALSE(inputs.hasPendingEdges());
+
+  inputs.end();
+  hw.setPinState(Pins::LW_BAND_SWITCH, HIGH);
+  TEST_ASSERT_FALSE(inputs.hasPendingEdges());
+}
+
+void test_pot_filter_stages_drop_spikes_and_hold_at_rest() {
+  PotFilters::FilterChain<PotFilters::MedianFilter<3>, PotFilters::Hysteresis<5>> chain;
+  chain.reset(1000);
+
+  // A one-sample spike never reaches the output, a real move does
+  const float samples[] = {3000, 1004, 1004, 1020, 1020};
+  const float expected[] = {1000, 1000, 1000, 1000, 1020};
+  for (size_t i = 0; i < 5; i++) {
+    float output = chain.apply(samples[i], 0.01f);
+    TEST_ASSERT_EQUAL_FLOAT(expected[i], output);
+  }
+
+  PotFilters::FilterChain<> passThrough;
+  TEST_ASSERT_EQUAL_FLOAT(42.0f, passThrough.apply(42, 0.01f));
+}
+
+void test_tuning_pot_step_response_and_rest_jitter() {
+  auto& hw = HardwareEmulator::getInstance();
+  TuningPotReader polled(Pins::TUNING_POT);
+  TuningPotReader pushed(Pins::TUNING_POT);
+
+  hw.setADCValue(Pins::TUNING_POT, 1000);
+  polled.begin();
+  pushed.begin(1000, micros());
+
+  std::vector<int> trace = PotTrace::step(1000, 3000, 50, 150);
+  std::vector<int> output = PotTrace::playTrace(polled, Pins::TUNING_POT, trace);
+
+  // Held still with noise, the dial does not wander
+  TEST_ASSERT_EQUAL(0, PotTrace::outputChanges(output, 0, 50));
+  TEST_ASSERT_INT_WITHIN(PotTrace::NOISE_COUNTS, 1000, output[49]);
+
+  // A quick turn lands within the tuning leeway in a few loop ticks, then rests
+  TEST_ASSERT_LESS_OR_EQUAL(10, PotTrace::settlingSamples(output, 50, 3000, Radio::TUNING_LEEWAY));
+  TEST_ASSERT_INT_WITHIN(PotTrace::NOISE_COUNTS, 3000, output.back());
+  TEST_ASSERT_LESS_OR_EQUAL(2, PotTrace::outputChanges(output, 100, output.size()));
+
+  // Samples pushed by the DMA sampler take the same path as polled reads
+  uint32_t now = micros();
+  for (int step = 0; step < 20; step++) {
+    now += PotTrace::LOOP_INTERVAL_MS * 1000;
+    pushed.push(3000 + (step % 2) * 4, now);
+  }
+  TEST_ASSERT_INT_WITHIN(PotTrace::NOISE_COUNTS, 3000, pushed.getStable());
+}
+
+void test_radio_state_hands_over_tuning_as_one_snapshot() {
+  auto& state = RadioState::getInstance();
+  uint32_t version = state.getTuningVersion();
+
+  RadioState::Tuning tuning;
+  tuning.tuningValue = 1234;
+  tuning.displayValue = 1236;
+  tuning.signalStrength = 180;
+  tuning.stationFrequency = 1200;
+  tuning.band = WaveBand::MEDIUM_WAVE;
+  tuning.updatedAt = 42;
+  state.publishTuning(tuning);
+
+  // Readers see every field of the latest publish and can tell it is new
+  RadioState::Tuning seen = state.getTuning();
+  TEST_ASSERT_EQUAL(version + 1, state.getTuningVersion());
+  TEST_ASSERT_EQUAL(1234, seen.tuningValue);
+  TEST_ASSERT_EQUAL(1236, seen.displayValue);
+  TEST_ASSERT_EQUAL(180, seen.signalStrength);
+  TEST_ASSERT_EQUAL(1200, seen.stationFrequency);
+  TEST_ASSERT_TRUE(seen.band == WaveBand::MEDIUM_WAVE);
+  TEST_ASSERT_EQUAL(42UL, seen.updatedAt);
+
+  state.setMorsePlaying(true);
+  state.setMorseToneOn(true);
+  TEST_ASSERT_TRUE(state.isMorsePlaying() && state.isMorseToneOn());
+  state.setMorsePlaying(false);
+  state.setMorseToneOn(false);
+}
+
+void test_perf_probes_fill_log2_histograms_and_report_json() {
+  auto& hw = HardwareEmulator::getInstance();
+  auto& perf = PerfMonitor::getInstance();
+  perf.reset();
+
+  // 0 cycles lands in bucket 0, 1 in bucket 1, 1000 in [512, 1024)
+  TEST_ASSERT_EQUAL(0, PerfMonitor::Histogram::bucketFor(0));
+  TEST_ASSERT_EQUAL(1, PerfMonitor::Histogram::bucketFor(1));
+  TEST_ASSERT_EQUAL(10, PerfMonitor::Histogram::bucketFor(1000));
+  TEST_ASSERT_EQUAL(31, PerfMonitor::Histogram::bucketFor(0xFFFFFFFFu));
+
+  for (int i = 0; i < 99; i++) {
+    PERF_SCOPE(Perf::Probe::TUNING);
+    hw.spendCycles(1000);
+  }
+  {
+    PERF_SCOPE(Perf::Probe::TUNING);
+    hw.spendCycles(240000);  // One 1 ms outlier
+  }
+  const auto& tuning = perf.get(Perf::Probe::TUNING);
+  TEST_ASSERT_EQUAL(100, tuning.count);
+  TEST_ASSERT_EQUAL(99, tuning.buckets[10]);
+  TEST_ASSERT_EQUAL(240000, tuning.maxCycles);
+  TEST_ASSERT_EQUAL(1023, tuning.percentileCycles(50));
+  TEST_ASSERT_EQUAL(1023, tuning.percentileCycles(99));
+  TEST_ASSERT_EQUAL(240000, tuning.percentileCycles(100));
+
+  // Lateness counts ticks that ran after their deadline; forced early ticks are skipped
+  PERF_TICK_DUE(Perf::Probe::TICK_LATENESS, 10);
+  hw.advanceMillis(12);
+  PERF_TICK_START(Perf::Probe::TICK_LATENESS);
+  PERF_TICK_DUE(Perf::Probe::TICK_LATENESS, 10);
+  hw.advanceMillis(3);
+  PERF_TICK_START(Perf::Probe::TICK_LATENESS);
+  const auto& lateness = perf.get(Perf::Probe::TICK_LATENESS);
+  TEST_ASSERT_EQUAL(1, lateness.count);
+  TEST_ASSERT_EQUAL(2000 * HardwareEmulator::CPU_MHZ, lateness.lastCycles);
+
+  char json[PerfMonitor::JSON_CAPACITY];
+  size_t length = perf.writeJson(json, sizeof(json));
+  TEST_ASSERT_TRUE(length > 0);
+  TEST_ASSERT_NOT_NULL(strstr(json, "\"cpuMhz\":240"));
+  TEST_ASSERT_NOT_NULL(strstr(json, "\"tuning\":{\"count\":100,"));
+  TEST_ASSERT_NOT_NULL(strstr(json, "\"maxUs\":1000.00"));
+  TEST_ASSERT_NOT_NULL(strstr(json, "\"webRequest\":{\"count\":0,"));
+  TEST_ASSERT_EQUAL('}', json[length - 1]);
+
+  // A buffer that is too small fails instead of returning cut-off JSON
+  char small[64];
+  TEST_ASSERT_EQUAL(0, perf.writeJson(small, sizeof(small)));
+
+  // Every probe with every bucket in use still fits the declared capacity
+  for (size_t p = 0; p < static_cast<size_t>(Perf::Probe::COUNT); p++) {
+    Perf::Probe probe = static_cast<Perf::Probe>(p);
+    TEST_ASSERT_TRUE(strlen(Perf::toString(probe)) <= PerfMonitor::JSON_NAME_CHARS);
+    perf.record(probe, 0);
+    for (int bit = 0; bit < 32; bit++) {
+      perf.record(probe, 1u << bit);
+    }
+    perf.record(probe, 0xFFFFFFFFu);
+  }
+  length = perf.writeJson(json, sizeof(json));
+  TEST_ASSERT_TRUE(length > 0);
+  TEST_ASSERT_NOT_NULL(strstr(json, "\"maxUs\":17895697.06"));
+  perf.reset();
+}
+
+void test_telemetry_events_carry_only_changed_fields() {
+  Telemetry first;
+  first.tuning = 1200;
+  first.stationFrequency = 1210;
+  strcpy(first.stationName, "Say \"Hi\"");
+  first.band = WaveBand::LONG_WAVE;
+  first.batteryCentivolts = 405;
+  first.batteryPercent = 91;
+  char json[Telemetry::JSON_CAPACITY];
+
+  // A new stream gets every field
+  TEST_ASSERT_TRUE(Telemetry::writeDelta(nullptr, first, json, sizeof(json)) > 0);
+  TEST_ASSERT_EQUAL_STRING(
+      "{\"tuning\":1200,\"signal\":0,\"frequency\":1210,\"station\":\"Say \\\"Hi\\\"\","
+      "\"band\":\"Long Wave\",\"speed\":\"Medium\",\"voltage\":4.05,\"percentage\":91,"
+      "\"isCharging\":false}",
+      json);
+
+  // Then only what moved, and nothing at all at rest
+  Telemetry next = first;
+  TEST_ASSERT_EQUAL(0, static_cast<int>(Telemetry::writeDelta(&first, next, json, sizeof(json))));
+  next.tuning = 1204;
+  next.charging = true;
+  TEST_ASSERT_TRUE(Telemetry::writeDelta(&first, next, json, sizeof(json)) > 0);
+  TEST_ASSERT_EQUAL_STRING("{\"tuning\":1204,\"isCharging\":true}", json);
+
+  // Too small a buffer sends nothing rather than broken JSON
+  TEST_ASSERT_EQUAL(0, static_cast<int>(Telemetry::writeDelta(nullptr, first, json, 32)));
+}
+
+void test_request_body_is_gathered_in_pieces_and_bounded() {
+  static RequestBody body;
+  body.begin();
+  const char* first = "{\"index\":";
+  const char* second = "3}";
+  body.append(reinterpret_cast<const uint8_t*>(first), strlen(first));
+  body.append(reinterpret_cast<const uint8_t*>(second), strlen(second));
+  TEST_ASSERT_EQUAL_STRING("{\"index\":3}", body.c_str());
+  TEST_ASSERT_EQUAL(11, static_cast<int>(body.size()));
+  TEST_ASSERT_FALSE(body.isTooLarge());
+
+  // A body that outgrows the buffer is flagged rather than cut short
+  static uint8_t piece[RequestBody::CAPACITY];
+  memset(piece, ' ', sizeof(piece));
+  body.append(piece, sizeof(piece));
+  body.append(reinterpret_cast<const uint8_t*>(second), strlen(second));
+  TEST_ASSERT_TRUE(body.isTooLarge());
+
+  // The next request starts clean
+  body.begin();
+  TEST_ASSERT_FALSE(body.isTooLarge());
+  TEST_ASSERT_EQUAL_STRING("", body.c_str());
+}
+
+// Feeds text in pieces of the given size, collecting each record the reader hands back
+std::string readRecords(JsonRecordReader& reader, const char* text, size_t pieceSize) {
+  std::string records;
+  reader.begin();
+  size_t length = strlen(text);
+  for (size_t start = 0; start < length; start += pieceSize) {
+    const char* data = text + start;
+    size_t remaining = length - start < pieceSize ? length - start : pieceSize;
+    while (remaining > 0) {
+      size_t used = reader.feed(data, remaining);
+      data += used;
+      remaining -= used;
+      if (reader.hasRecord()) {
+        records += reader.record();
+        records += "|";
+      }
+    }
+  }
+  return records;
+}
+
+void test_json_record_reader_splits_an_array_across_pieces() {
+  static JsonRecordReader reader("stations");
+  const char* body =
+      "{\"version\":\"stations\",\"other\":[{\"index\":9}],"
+      "\"stations\": [ {\"index\":0,\"message\":\"A}]\\\"{\",\"tone\":{\"hz\":600}},"
+      "{\"index\":1,\"message\":\"B\"} ]}";
+  const char* expected =
+      "{\"index\":0,\"message\":\"A}]\\\"{\",\"tone\":{\"hz\":600}}|"
+      "{\"index\":1,\"message\":\"B\"}|";
+
+  // Same records however the body is split, brackets in strings ignored, other arrays left out
+  const size_t pieceSizes[] = {1, 7, 1436};
+  for (size_t pieceSize : pieceSizes) {
+    TEST_ASSERT_EQUAL_STRING(expected, readRecords(reader, body, pieceSize).c_str());
+    TEST_ASSERT_TRUE(reader.foundArray());
+    TEST_ASSERT_TRUE(reader.isComplete());
+  }
+
+  // A body cut short or with mismatched brackets is not complete
+  readRecords(reader, "{\"stations\":[{\"index\":0}", 16);
+  TEST_ASSERT_FALSE(reader.isComplete());
+  readRecords(reader, "{\"stations\":[}]}", 16);
+  TEST_ASSERT_FALSE(reader.isComplete());
+  TEST_ASSERT_EQUAL_STRING("", readRecords(reader, "{\"messages\":[{\"index\":0}]}", 16).c_str());
+  TEST_ASSERT_FALSE(reader.foundArray());
+
+  // A record too long for the buffer is skipped and counted; the next one still arrives
+  std::string oversized = "{\"stations\":[{\"message\":\"";
+  for (size_t i = 0; i < JsonRecordReader::CAPACITY; i++) oversized += 'E';
+  oversized += "\"},{\"index\":2}]}";
+  TEST_ASSERT_EQUAL_STRING("{\"index\":2}|", readRecords(reader, oversized.c_str(), 64).c_str());
+  TEST_ASSERT_EQUAL(1, static_cast<int>(reader.getSkipped()));
+  TEST_ASSERT_TRUE(reader.isComplete());
+}
+
 int main() {
   UNITY_BEGIN();
   RUN_TEST(test_speed_manager_updates_state_and_skips_redundant_pwm_write);
   RUN_TEST(test_wave_band_manager_updates_band_and_leds);
   RUN_TEST(test_signal_manager_clamps_and_deduplicates_updates);
+  RUN_TEST(test_input_scanner_reads_all_inputs_once_per_pass);
+  RUN_TEST(test_input_edges_from_interrupts_drive_debounce_and_idle_scans);
+  RUN_TEST(test_pot_filter_stages_drop_spikes_and_hold_at_rest);
+  RUN_TEST(test_tuning_pot_step_response_and_rest_jitter);
+  RUN_TEST(test_radio_state_hands_over_tuning_as_one_snapshot);
+  RUN_TEST(test_perf_probes_fill_log2_histograms_and_report_json);
+  RUN_TEST(test_telemetry_events_carry_only_changed_fields);
+  RUN_TEST(test_request_body_is_gathered_in_pieces_and_bounded);
+  RUN_TEST(test_json_record_reader_splits_an_array_across_pieces);
   return UNITY_END();
 }
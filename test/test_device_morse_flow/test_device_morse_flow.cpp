@@ -1,14 +1,20 @@
 #include <unity.h>
 
+#include <cstdio>
+#include <vector>
+
 #include "../../src/AudioManager.h"
 #include "../../src/Config.h"
+#include "../../src/LoopWaker.h"
 #include "../../src/MorseCode.h"
+#include "../../src/RadioState.h"
 
 #include "../mocks/AudioProbe.h"
 #include "../mocks/HardwareEmulator.h"
 #include "../mocks/HardwareEmulator.cpp"
 #include "../mocks/AudioManagerTestDouble.cpp"
 #include "../../src/MorseCode.cpp"
+#include "../../src/MorseKeyer.cpp"
 
 void setUp() {
   HardwareEmulator::getInstance().reset();
@@ -26,18 +32,19 @@ void test_morse_flow_respects_tunein_symbol_and_word_gap_timing() {
   auto& morse = MorseCode::getInstance();
 
   morse.begin();
+  morse.setHardwareKeying(false);
   morse.startMessage("E E");
   AudioProbe::clear();
 
   morse.update();
-  TEST_ASSERT_FALSE(ConfigManager::getInstance().isMorseToneOn());
+  TEST_ASSERT_FALSE(RadioState::getInstance().isMorseToneOn());
   TEST_ASSERT_EQUAL(LOW, hw.getPinState(Pins::MORSE_LEDS));
   TEST_ASSERT_EQUAL(1, static_cast<int>(AudioProbe::events().size()));
   TEST_ASSERT_FALSE(AudioProbe::events()[0].toneOn);
 
   hw.advanceMillis(1000);
   morse.update();
-  TEST_ASSERT_TRUE(ConfigManager::getInstance().isMorseToneOn());
+  TEST_ASSERT_TRUE(RadioState::getInstance().isMorseToneOn());
   TEST_ASSERT_EQUAL(HIGH, hw.getPinState(Pins::MORSE_LEDS));
   TEST_ASSERT_EQUAL(3, static_cast<int>(AudioProbe::events().size()));
   TEST_ASSERT_FALSE(AudioProbe::events()[1].toneOn);
@@ -46,7 +53,7 @@ void test_morse_flow_respects_tunein_symbol_and_word_gap_timing() {
 
   hw.advanceMillis(200);
   morse.update();
-  TEST_ASSERT_FALSE(ConfigManager::getInstance().isMorseToneOn());
+  TEST_ASSERT_FALSE(RadioState::getInstance().isMorseToneOn());
   TEST_ASSERT_EQUAL(LOW, hw.getPinState(Pins::MORSE_LEDS));
   TEST_ASSERT_EQUAL(4, static_cast<int>(AudioProbe::events().size()));
   TEST_ASSERT_FALSE(AudioProbe::events()[3].toneOn);
@@ -54,24 +61,177 @@ void test_morse_flow_respects_tunein_symbol_and_word_gap_timing() {
 
   hw.advanceMillis(800);
   morse.update();
-  TEST_ASSERT_FALSE(ConfigManager::getInstance().isMorseToneOn());
+  TEST_ASSERT_FALSE(RadioState::getInstance().isMorseToneOn());
 
   hw.advanceMillis(1600);
   morse.update();
-  TEST_ASSERT_TRUE(ConfigManager::getInstance().isMorseToneOn());
+  TEST_ASSERT_TRUE(RadioState::getInstance().isMorseToneOn());
   TEST_ASSERT_EQUAL(6, static_cast<int>(AudioProbe::events().size()));
   TEST_ASSERT_FALSE(AudioProbe::events()[4].toneOn);
   TEST_ASSERT_TRUE(AudioProbe::events()[5].toneOn);
   TEST_ASSERT_EQUAL(3600UL, AudioProbe::events()[5].timestamp);
 
   morse.stop();
-  TEST_ASSERT_FALSE(ConfigManager::getInstance().isMorsePlaying());
-  TEST_ASSERT_FALSE(ConfigManager::getInstance().isMorseToneOn());
+  TEST_ASSERT_FALSE(RadioState::getInstance().isMorsePlaying());
+  TEST_ASSERT_FALSE(RadioState::getInstance().isMorseToneOn());
   TEST_ASSERT_EQUAL(LOW, hw.getPinState(Pins::MORSE_LEDS));
 }
 
+void test_morse_deadlines_let_an_idle_loop_sleep_between_edges() {
+  auto& hw = HardwareEmulator::getInstance();
+  auto& morse = MorseCode::getInstance();
+  auto& waker = LoopWaker::getInstance();
+  waker.begin();
+
+  // Polled keying: the loop only wakes when the next element is due
+  morse.begin();
+  morse.setHardwareKeying(false);
+  morse.startMessage("E E");
+  AudioProbe::clear();
+  size_t passes = 0;
+  while (morse.isPlaying() && hw.getMillis() < 10000UL) {
+    morse.update();
+    passes++;
+    if (!morse.isPlaying()) break;
+    waker.sleepFor(morse.msUntilNextUpdate(millis()));
+  }
+  TEST_ASSERT_EQUAL(4600UL, hw.getMillis());
+  TEST_ASSERT_LESS_OR_EQUAL(12, passes);  // A 10 ms tick makes 460 passes
+
+  std::vector<unsigned long> onTimes;
+  for (const auto& event : AudioProbe::events()) {
+    if (event.toneOn) onTimes.push_back(event.timestamp);
+  }
+  TEST_ASSERT_EQUAL(2, static_cast<int>(onTimes.size()));
+  TEST_ASSERT_EQUAL(1000UL, onTimes[0]);
+  TEST_ASSERT_EQUAL(3600UL, onTimes[1]);
+
+  // Hardware keying: the loop sleeps through the message and the keyer wakes it at the end
+  morse.setHardwareKeying(true);
+  unsigned long start = hw.getMillis();
+  morse.startMessage("E E");
+  morse.update();
+  waker.sleepFor(morse.msUntilNextUpdate(millis()));  // Tune-in delay
+  morse.update();
+  TEST_ASSERT_EQUAL(Timing::MAX_IDLE_INTERVAL, morse.msUntilNextUpdate(millis()));
+
+  passes = 0;
+  while (morse.isPlaying() && hw.getMillis() < start + 10000UL) {
+    waker.sleepFor(morse.msUntilNextUpdate(millis()));
+    morse.update();
+    passes++;
+  }
+  TEST_ASSERT_EQUAL(start + 4600UL, hw.getMillis());
+  TEST_ASSERT_LESS_OR_EQUAL(4, passes);
+}
+
+void test_morse_timeline_compiles_gaps_and_skips_unsupported_characters() {
+  using Element = MorseTimeline::Element;
+  MorseTimeline timeline;
+
+  timeline.compile("A? E");
+  const Element expected[] = {Element::DOT,      Element::SYMBOL_GAP, Element::DASH,
+                              Element::LETTER_GAP, Element::WORD_GAP,  Element::DOT,
+                              Element::LETTER_GAP};
+  TEST_ASSERT_EQUAL(7, static_cast<int>(timeline.size()));
+  for (size_t i = 0; i < timeline.size(); i++) {
+    TEST_ASSERT_EQUAL(static_cast<int>(expected[i]), static_cast<int>(timeline.at(i)));
+  }
+  TEST_ASSERT_FALSE(timeline.wasTruncated());
+
+  TEST_ASSERT_EQUAL(600UL, MorseTimeline::durationOf(Element::DASH, Audio::MORSE_FAST));
+  TEST_ASSERT_EQUAL(800UL, MorseTimeline::durationOf(Element::LETTER_GAP, Audio::MORSE_FAST));
+
+  // Digits are the longest characters; a long run of them must truncate on a character boundary
+  String longMessage(std::string(200, '0'));
+  timeline.compile(longMessage.c_str());
+  TEST_ASSERT_TRUE(timeline.wasTruncated());
+  TEST_ASSERT_EQUAL(0, static_cast<int>(timeline.size() % 10));
+  TEST_ASSERT_EQUAL(static_cast<int>(Element::LETTER_GAP),
+                    static_cast<int>(timeline.at(timeline.size() - 1)));
+}
+
+namespace {
+// Plays a message with a 10 ms tick plus pseudo-random stalls (WiFi/ADC work stealing time)
+// and returns the worst difference between a measured on/off run and its nominal length.
+unsigned long measureKeyingJitter(const char* message) {
+  auto& hw = HardwareEmulator::getInstance();
+  auto& morse = MorseCode::getInstance();
+
+  morse.startMessage(message);
+  AudioProbe::clear();
+  while (morse.isPlaying() && hw.getMillis() < 120000UL) {
+    morse.update();
+    hw.advanceMillis(10 + hw.nextRandom(0, 15));
+  }
+
+  // Collapse repeated writes of the same state into keying edges
+  std::vector<unsigned long> edges;
+  bool keyed = false;
+  for (const auto& event : AudioProbe::events()) {
+    if (event.toneOn != keyed) {
+      edges.push_back(event.timestamp);
+      keyed = event.toneOn;
+    }
+  }
+
+  // Nominal run lengths: consecutive elements with the same key state form one run
+  MorseTimeline timeline;
+  timeline.compile(message);
+  const auto& timings = ConfigManager::getInstance().getCurrentMorseTimings();
+  std::vector<unsigned long> runs;
+  for (size_t i = 0; i < timeline.size(); i++) {
+    unsigned long duration = MorseTimeline::durationOf(timeline.at(i), timings);
+    bool keyedRun = MorseTimeline::isKeyed(timeline.at(i));
+    if (i > 0 && keyedRun == MorseTimeline::isKeyed(timeline.at(i - 1))) {
+      runs.back() += duration;
+    } else {
+      runs.push_back(duration);
+    }
+  }
+
+  // Every run but the trailing gap ends on an edge
+  TEST_ASSERT_EQUAL(static_cast<int>(runs.size()), static_cast<int>(edges.size()));
+  unsigned long worst = 0;
+  for (size_t i = 0; i + 1 < edges.size(); i++) {
+    unsigned long measured = edges[i + 1] - edges[i];
+    unsigned long error = measured > runs[i] ? measured - runs[i] : runs[i] - measured;
+    if (error > worst) worst = error;
+  }
+  return worst;
+}
+}  // namespace
+
+void test_hardware_keyer_removes_tick_jitter() {
+  auto& morse = MorseCode::getInstance();
+  morse.begin();
+
+  morse.setHardwareKeying(false);
+  unsigned long polledJitter = measureKeyingJitter("PARIS PARIS");
+
+  morse.setHardwareKeying(true);
+  TEST_ASSERT_TRUE(morse.isHardwareKeying());
+  unsigned long timerJitter = measureKeyingJitter("PARIS PARIS");
+
+  char report[96];
+  snprintf(report, sizeof(report), "keying jitter at FAST: polled %lu ms, esp_timer %lu ms",
+           polledJitter, timerJitter);
+  TEST_MESSAGE(report);
+
+  TEST_ASSERT_TRUE(polledJitter > 0);
+  TEST_ASSERT_TRUE(timerJitter <= 1);
+
+  // Every edge drove the LEDs, the audio gate and the timer outside the keyer's spinlock
+  TEST_ASSERT_EQUAL(0, HardwareEmulator::getInstance().getCriticalSectionCalls());
+  TEST_ASSERT_FALSE(RadioState::getInstance().isMorseToneOn());
+  TEST_ASSERT_EQUAL(LOW, HardwareEmulator::getInstance().getPinState(Pins::MORSE_LEDS));
+}
+
 int main() {
   UNITY_BEGIN();
   RUN_TEST(test_morse_flow_respects_tunein_symbol_and_word_gap_timing);
+  RUN_TEST(test_morse_deadlines_let_an_idle_loop_sleep_between_edges);
+  RUN_TEST(test_morse_timeline_compiles_gaps_and_skips_unsupported_characters);
+  RUN_TEST(test_hardware_keyer_removes_tick_jitter);
   return UNITY_END();
 }
@@ -1,7 +1,10 @@
 #include <unity.h>
 
 #include "../../src/Config.h"
+#include "../../src/PersistenceService.h"
+#include "../../src/StationImport.h"
 #include "../../src/StationManager.h"
+#include "../../src/StationStorage.h"
 
 #include "../mocks/HardwareEmulator.h"
 #include "../mocks/HardwareEmulator.cpp"
@@ -31,18 +34,496 @@ void test_station_updates_persist_through_preferences_storage() {
 
   manager.updateStation(12, 2100, "DEVICE TEST MESSAGE", false);
 
+  PersistenceService::getInstance().flush();
   manager.begin();
   Station* station = manager.getStation(12);
 
   TEST_ASSERT_NOT_NULL(station);
   TEST_ASSERT_EQUAL(2100, station->getFrequency());
-  TEST_ASSERT_EQUAL_STRING("DEVICE TEST MESSAGE", station->getMessage().c_str());
+  TEST_ASSERT_EQUAL_STRING("DEVICE TEST MESSAGE", station->getMessage());
   TEST_ASSERT_FALSE(station->isEnabled());
 }
 
+void test_station_candidates_are_strongest_first_and_capped() {
+  auto& manager = StationManager::getInstance();
+  manager.begin();
+  manager.resetToDefaults();
+
+  // Crowd two stations into Dublin's (2048) leeway
+  for (size_t i = 0; i < manager.getStationCount(); i++) {
+    Station* station = manager.getStation(i);
+    if (strcmp(station->getName(), "London") == 0) {
+      manager.updateStation(i, 2080, station->getMessage(), true);
+    } else if (strcmp(station->getName(), "Vienna") == 0) {
+      manager.updateStation(i, 2070, station->getMessage(), true);
+    }
+  }
+
+  StationCandidate candidates[3];
+  size_t count = manager.findStationCandidates(2060, WaveBand::MEDIUM_WAVE, candidates, 3);
+  TEST_ASSERT_EQUAL(3, static_cast<int>(count));
+  TEST_ASSERT_EQUAL_STRING("Vienna", candidates[0].station->getName());
+  TEST_ASSERT_EQUAL_STRING("Dublin", candidates[1].station->getName());
+  TEST_ASSERT_EQUAL_STRING("London", candidates[2].station->getName());
+  TEST_ASSERT_TRUE(candidates[0].signalStrength > candidates[1].signalStrength);
+  TEST_ASSERT_TRUE(candidates[1].signalStrength > candidates[2].signalStrength);
+
+  // A smaller capacity keeps only the strongest, matching findClosestStation()
+  count = manager.findStationCandidates(2060, WaveBand::MEDIUM_WAVE, candidates, 2);
+  TEST_ASSERT_EQUAL(2, static_cast<int>(count));
+  TEST_ASSERT_EQUAL_STRING("Dublin", candidates[1].station->getName());
+
+  int signalStrength = 0;
+  Station* closest = manager.findClosestStation(2060, WaveBand::MEDIUM_WAVE, signalStrength);
+  TEST_ASSERT_EQUAL_PTR(candidates[0].station, closest);
+  TEST_ASSERT_EQUAL(candidates[0].signalStrength, signalStrength);
+
+  // Between stations nothing is received
+  TEST_ASSERT_EQUAL(0, static_cast<int>(manager.findStationCandidates(
+                           1700, WaveBand::MEDIUM_WAVE, candidates, 3)));
+  manager.resetToDefaults();
+}
+
+void test_tuning_index_matches_linear_scan_after_edits() {
+  auto& manager = StationManager::getInstance();
+  manager.begin();
+  manager.resetToDefaults();
+
+  // Move one station, disable another and stack two on the same frequency
+  manager.updateStation(1, 1040, manager.getStation(1)->getMessage(), true);
+  manager.updateStation(2, manager.getStation(2)->getFrequency(), "OFF AIR", false);
+  manager.updateStation(4, manager.getStation(3)->getFrequency(), "SAME SPOT", true);
+
+  const WaveBand bands[] = {WaveBand::LONG_WAVE, WaveBand::MEDIUM_WAVE, WaveBand::SHORT_WAVE};
+  for (WaveBand band : bands) {
+    for (int tuning = 0; tuning <= Radio::ADC_MAX; tuning++) {
+      // Reference: the original scan over every station
+      const Station* expected = nullptr;
+      int expectedStrength = 0;
+      for (const Station& station : manager.getAllStations()) {
+        if (!station.isEnabled() || station.getBand() != band) continue;
+        int strength = station.getSignalStrength(tuning);
+        if (strength > expectedStrength) {
+          expectedStrength = strength;
+          expected = &station;
+        }
+      }
+
+      int strength = 0;
+      Station* found = manager.findClosestStation(tuning, band, strength);
+      TEST_ASSERT_EQUAL_PTR(expected, found);
+      TEST_ASSERT_EQUAL(expectedStrength, strength);
+    }
+  }
+  manager.resetToDefaults();
+}
+
+void test_catalogue_adds_and_removes_stations_through_storage() {
+  auto& manager = StationManager::getInstance();
+  manager.begin();
+  manager.resetToDefaults();
+  size_t defaults = manager.getStationCount();
+
+  TEST_ASSERT_TRUE(
+      manager.addStation("Reykjavik", WaveBand::SHORT_WAVE, 3100, "NORTHERN LIGHTS", 700));
+  TEST_ASSERT_FALSE(manager.addStation("", WaveBand::SHORT_WAVE, 3100, "NO NAME"));
+  TEST_ASSERT_FALSE(manager.addStation("Nowhere", WaveBand::SHORT_WAVE, 5000, "OFF DIAL"));
+  TEST_ASSERT_FALSE(manager.addStation("Hum", WaveBand::SHORT_WAVE, 3100, "TOO LOW", 50));
+
+  // The added station survives a reload and is tunable
+  PersistenceService::getInstance().flush();
+  manager.begin();
+  TEST_ASSERT_EQUAL(defaults + 1, manager.getStationCount());
+  int strength = 0;
+  Station* station = manager.findClosestStation(3100, WaveBand::SHORT_WAVE, strength);
+  TEST_ASSERT_NOT_NULL(station);
+  TEST_ASSERT_EQUAL_STRING("Reykjavik", station->getName());
+  TEST_ASSERT_EQUAL_STRING("NORTHERN LIGHTS", station->getMessage());
+  TEST_ASSERT_EQUAL(700, station->getToneFrequency());
+
+  // Removing a default shifts the rest down, and the removal persists too
+  TEST_ASSERT_TRUE(manager.removeStation(0));
+  TEST_ASSERT_FALSE(manager.removeStation(defaults));
+  PersistenceService::getInstance().flush();
+  manager.begin();
+  TEST_ASSERT_EQUAL(defaults, manager.getStationCount());
+  TEST_ASSERT_EQUAL_STRING("Reykjavik", manager.getStation(defaults - 1)->getName());
+  TEST_ASSERT_NULL(manager.findClosestStation(3100, WaveBand::LONG_WAVE, strength));
+
+  manager.resetToDefaults();
+  TEST_ASSERT_EQUAL(0, static_cast<int>(manager.getStringArena().getUsed()));
+}
+
+void test_string_arena_reclaims_replaced_messages() {
+  auto& manager = StationManager::getInstance();
+  manager.begin();
+  manager.resetToDefaults();
+
+  // Rewrite messages far more often than the pool could hold without compaction
+  char message[Radio::MAX_MESSAGE_LENGTH + 1];
+  size_t writes = Radio::STRING_ARENA_SIZE / 64;
+  for (size_t i = 0; i < writes; i++) {
+    snprintf(message, sizeof(message), "%0*u", static_cast<int>(Radio::MAX_MESSAGE_LENGTH),
+             static_cast<unsigned>(i));
+    TEST_ASSERT_TRUE(manager.setStationMessage(i % 3, message));
+  }
+
+  // Compaction keeps the pool within its fixed size
+  TEST_ASSERT_TRUE(manager.getStringArena().getUsed() <= Radio::STRING_ARENA_SIZE);
+  TEST_ASSERT_EQUAL_STRING(message, manager.getStation((writes - 1) % 3)->getMessage());
+  TEST_ASSERT_EQUAL_STRING("Budapest", manager.getStation(1)->getName());
+
+  // Overlong messages are refused and leave the old text in place
+  char tooLong[Radio::MAX_MESSAGE_LENGTH + 2];
+  memset(tooLong, 'E', sizeof(tooLong) - 1);
+  tooLong[sizeof(tooLong) - 1] = '\0';
+  TEST_ASSERT_FALSE(manager.setStationMessage(0, tooLong));
+  TEST_ASSERT_EQUAL(Radio::MAX_MESSAGE_LENGTH, strlen(manager.getStation(0)->getMessage()));
+  manager.resetToDefaults();
+}
+
+void test_station_edit_rewrites_only_its_page() {
+  auto& manager = StationManager::getInstance();
+  manager.begin();
+  manager.resetToDefaults();
+
+  // One page blob plus the header, however many stations there are
+  PersistenceService::getInstance().flush();
+  size_t before = Preferences::writeCount();
+  manager.updateStation(20, 1111, "ONE PAGE ONLY", true);
+  PersistenceService::getInstance().flush();
+  TEST_ASSERT_EQUAL(2, static_cast<int>(Preferences::writeCount() - before));
+
+  // Saving an unchanged catalogue writes nothing
+  before = Preferences::writeCount();
+  manager.saveToPreferences();
+  PersistenceService::getInstance().flush();
+  TEST_ASSERT_EQUAL(0, static_cast<int>(Preferences::writeCount() - before));
+
+  manager.begin();
+  TEST_ASSERT_EQUAL(1111, manager.getStation(20)->getFrequency());
+  TEST_ASSERT_EQUAL_STRING("ONE PAGE ONLY", manager.getStation(20)->getMessage());
+  manager.resetToDefaults();
+}
+
+void test_legacy_station_keys_migrate_into_blobs() {
+  Preferences prefs;
+  prefs.begin("catalogue", false);
+  prefs.clear();
+  prefs.end();
+  prefs.begin("stations", false);
+  prefs.clear();
+  prefs.putInt("freq0", 777);
+  prefs.putString("msg0", "FROM OLD FIRMWARE");
+  prefs.putBool("enabled0", false);
+  prefs.end();
+
+  auto& manager = StationManager::getInstance();
+  manager.begin();
+  TEST_ASSERT_EQUAL(777, manager.getStation(0)->getFrequency());
+  TEST_ASSERT_EQUAL_STRING("FROM OLD FIRMWARE", manager.getStation(0)->getMessage());
+  TEST_ASSERT_FALSE(manager.getStation(0)->isEnabled());
+
+  // The old keys are gone and the next boot reads the blobs
+  prefs.begin("stations", true);
+  TEST_ASSERT_FALSE(prefs.isKey("freq0"));
+  prefs.end();
+  manager.begin();
+  TEST_ASSERT_EQUAL_STRING("FROM OLD FIRMWARE", manager.getStation(0)->getMessage());
+  manager.resetToDefaults();
+}
+
+void test_legacy_message_over_the_limit_keeps_the_default() {
+  auto& manager = StationManager::getInstance();
+  manager.resetToDefaults();
+  PersistenceService::getInstance().flush();
+  std::string defaultMessage = manager.getStation(0)->getMessage();
+
+  Preferences prefs;
+  prefs.begin("catalogue", false);
+  prefs.clear();
+  prefs.end();
+
+  // Old firmware took any length; a blob record holds MAX_MESSAGE_LENGTH at most
+  std::string longMessage(Radio::MAX_MESSAGE_LENGTH + 1, 'E');
+  prefs.begin("stations", false);
+  prefs.clear();
+  prefs.putInt("freq0", 779);
+  prefs.putString("msg0", longMessage.c_str());
+  prefs.putString("msg1", "STILL MIGRATED");
+  prefs.end();
+
+  // Rejected whole rather than cut, while the rest of the station and its neighbours move
+  manager.begin();
+  TEST_ASSERT_EQUAL(779, manager.getStation(0)->getFrequency());
+  TEST_ASSERT_EQUAL_STRING(defaultMessage.c_str(), manager.getStation(0)->getMessage());
+  TEST_ASSERT_EQUAL_STRING("STILL MIGRATED", manager.getStation(1)->getMessage());
+
+  manager.begin();
+  TEST_ASSERT_EQUAL_STRING(defaultMessage.c_str(), manager.getStation(0)->getMessage());
+  manager.resetToDefaults();
+  PersistenceService::getInstance().flush();
+}
+
+void test_truncated_import_body_changes_nothing() {
+  auto& manager = StationManager::getInstance();
+  manager.resetToDefaults();
+  PersistenceService::getInstance().flush();
+  std::string first = manager.getStation(0)->getMessage();
+  std::string second = manager.getStation(1)->getMessage();
+
+  // Two complete stations, then the connection drops inside the third
+  static const char BODY[] =
+      "{\"stations\":[{\"index\":0,\"message\":\"STAGED ONE\"},"
+      "{\"index\":1,\"message\":\"STAGED TWO\",\"enabled\":false},"
+      "{\"index\":2,\"mess";
+  StationImport import;
+  import.begin(StationImport::Mode::MESSAGES);
+  for (size_t offset = 0; offset < sizeof(BODY) - 1; offset += 16) {
+    size_t piece = sizeof(BODY) - 1 - offset < 16 ? sizeof(BODY) - 1 - offset : 16;
+    import.feed(BODY + offset, piece);
+  }
+
+  // Staged only: the catalogue is as it was while the body is still arriving
+  TEST_ASSERT_EQUAL_STRING(first.c_str(), manager.getStation(0)->getMessage());
+
+  uint32_t writes = Preferences::writeCount();
+  StationImport::Result result = import.apply();
+  PersistenceService::getInstance().flush();
+  TEST_ASSERT_FALSE(result.complete);
+  TEST_ASSERT_EQUAL(0, static_cast<int>(result.applied));
+  TEST_ASSERT_EQUAL_STRING(first.c_str(), manager.getStation(0)->getMessage());
+  TEST_ASSERT_EQUAL_STRING(second.c_str(), manager.getStation(1)->getMessage());
+  TEST_ASSERT_TRUE(manager.getStation(1)->isEnabled());
+  TEST_ASSERT_EQUAL(0, static_cast<int>(Preferences::writeCount() - writes));
+
+  // The same stations in a body that closes are applied and saved together
+  static const char WHOLE[] =
+      "{\"stations\":[{\"index\":0,\"message\":\"STAGED ONE\"},"
+      "{\"index\":1,\"message\":\"STAGED TWO\",\"enabled\":false}]}";
+  import.begin(StationImport::Mode::MESSAGES);
+  import.feed(WHOLE, sizeof(WHOLE) - 1);
+  result = import.apply();
+  TEST_ASSERT_TRUE(result.complete);
+  TEST_ASSERT_EQUAL(2, static_cast<int>(result.applied));
+  TEST_ASSERT_EQUAL_STRING("STAGED TWO", manager.getStation(1)->getMessage());
+  TEST_ASSERT_FALSE(manager.getStation(1)->isEnabled());
+  PersistenceService::getInstance().flush();
+  manager.begin();
+  TEST_ASSERT_EQUAL_STRING("STAGED ONE", manager.getStation(0)->getMessage());
+
+  manager.resetToDefaults();
+  PersistenceService::getInstance().flush();
+}
+
+void test_save_batch_with_a_bad_station_changes_nothing() {
+  auto& manager = StationManager::getInstance();
+  manager.resetToDefaults();
+  PersistenceService::getInstance().flush();
+  int frequency = manager.getStation(0)->getFrequency();
+
+  // /save refuses the whole form when one station is out of range
+  static const char BODY[] =
+      "{\"stations\":[{\"index\":0,\"frequency\":1234,\"message\":\"OK\",\"enabled\":true},"
+      "{\"index\":1,\"frequency\":0,\"message\":\"BAD\",\"enabled\":true}]}";
+  StationImport import;
+  import.begin(StationImport::Mode::CONFIG);
+  import.feed(BODY, sizeof(BODY) - 1);
+  StationImport::Result result = import.apply();
+  TEST_ASSERT_TRUE(result.complete);
+  TEST_ASSERT_EQUAL(1, result.failedIndex);
+  TEST_ASSERT_EQUAL(0, static_cast<int>(result.applied));
+  TEST_ASSERT_EQUAL(frequency, manager.getStation(0)->getFrequency());
+}
+
+void test_failed_migration_keeps_legacy_keys() {
+  Preferences prefs;
+  prefs.begin("catalogue", false);
+  prefs.clear();
+  prefs.end();
+  prefs.begin("stations", false);
+  prefs.clear();
+  prefs.putInt("freq0", 778);
+  prefs.putString("msg0", "STILL ON OLD KEYS");
+  prefs.end();
+
+  // NVS refuses the blobs, so the keys they would replace stay
+  auto& manager = StationManager::getInstance();
+  Preferences::failWrites() = true;
+  manager.begin();
+  Preferences::failWrites() = false;
+  prefs.begin("stations", true);
+  TEST_ASSERT_TRUE(prefs.isKey("freq0"));
+  prefs.end();
+
+  // The next boot migrates them
+  manager.begin();
+  TEST_ASSERT_EQUAL_STRING("STILL ON OLD KEYS", manager.getStation(0)->getMessage());
+  prefs.begin("stations", true);
+  TEST_ASSERT_FALSE(prefs.isKey("freq0"));
+  prefs.end();
+  manager.begin();
+  TEST_ASSERT_EQUAL(778, manager.getStation(0)->getFrequency());
+  manager.resetToDefaults();
+  PersistenceService::getInstance().flush();
+}
+
+void test_failed_page_write_is_retried_before_the_header() {
+  auto& manager = StationManager::getInstance();
+  auto& storage = StationStorage::getInstance();
+  manager.begin();
+  manager.resetToDefaults();
+  PersistenceService::getInstance().flush();
+
+  // A page that does not land leaves the header alone, so the last catalogue still loads
+  manager.updateStation(3, 1234, "NOT YET", true);
+  size_t before = Preferences::writeCount();
+  Preferences::failWrites() = true;
+  TEST_ASSERT_FALSE(storage.saveStations(manager.getAllStations(), 3, 3));
+  Preferences::failWrites() = false;
+  TEST_ASSERT_EQUAL(0, static_cast<int>(Preferences::writeCount() - before));
+
+  // Saving again writes the page and then the header
+  TEST_ASSERT_TRUE(storage.saveStations(manager.getAllStations(), 3, 3));
+  TEST_ASSERT_EQUAL(2, static_cast<int>(Preferences::writeCount() - before));
+  manager.begin();
+  TEST_ASSERT_EQUAL_STRING("NOT YET", manager.getStation(3)->getMessage());
+  manager.resetToDefaults();
+  PersistenceService::getInstance().flush();
+}
+
+void test_corrupt_station_blob_keeps_defaults() {
+  auto& manager = StationManager::getInstance();
+  manager.begin();
+  manager.updateStation(0, 900, "BEFORE CORRUPTION", true);
+  PersistenceService::getInstance().flush();
+
+  Preferences prefs;
+  prefs.begin("catalogue", false);
+  uint8_t page[4096];
+  size_t length = prefs.getBytes("page0", page, sizeof(page));
+  TEST_ASSERT_TRUE(length > 20);
+  page[10] ^= 0x5A;
+  prefs.putBytes("page0", page, length);
+  prefs.end();
+
+  manager.begin();
+  TEST_ASSERT_EQUAL_STRING("Athens", manager.getStation(0)->getName());
+  TEST_ASSERT_EQUAL_STRING("FIRST CLUE FOUND IN LOBBY", manager.getStation(0)->getMessage());
+  manager.resetToDefaults();
+}
+
+void test_edits_coalesce_until_the_quiet_period() {
+  auto& manager = StationManager::getInstance();
+  auto& persistence = PersistenceService::getInstance();
+  auto& hardware = HardwareEmulator::getInstance();
+  manager.begin();
+  manager.resetToDefaults();
+  persistence.flush();
+
+  // A burst of edits on one page writes nothing while it lasts
+  size_t before = Preferences::writeCount();
+  uint32_t flushes = persistence.getStats().flushes;
+  for (int i = 0; i < 10; i++) {
+    manager.updateStation(i % 4, 500 + i, "BURST", true);
+    hardware.advanceMillis(Timing::PERSIST_QUIET_PERIOD / 4);
+    persistence.update();
+  }
+  TEST_ASSERT_TRUE(persistence.hasPending());
+  TEST_ASSERT_EQUAL(0, static_cast<int>(Preferences::writeCount() - before));
+
+  // Then lands as a single flush of one page and the header
+  hardware.advanceMillis(Timing::PERSIST_QUIET_PERIOD);
+  persistence.update();
+  TEST_ASSERT_FALSE(persistence.hasPending());
+  TEST_ASSERT_EQUAL(flushes + 1, persistence.getStats().flushes);
+  TEST_ASSERT_EQUAL(2, static_cast<int>(Preferences::writeCount() - before));
+  TEST_ASSERT_TRUE(persistence.getStats().bytesWritten > 0);
+
+  manager.begin();
+  TEST_ASSERT_EQUAL(509, manager.getStation(1)->getFrequency());
+  manager.resetToDefaults();
+  persistence.flush();
+}
+
+void test_failed_flush_is_retried_after_the_quiet_period() {
+  auto& manager = StationManager::getInstance();
+  auto& persistence = PersistenceService::getInstance();
+  auto& hardware = HardwareEmulator::getInstance();
+  manager.begin();
+  manager.resetToDefaults();
+  persistence.flush();
+
+  // Neither store lands, so both stay pending and the flush is not counted
+  uint32_t flushes = persistence.getStats().flushes;
+  manager.updateStation(2, 1500, "RETRY ME", true);
+  ConfigManager::getInstance().setInactivityTimeout(45);
+  persistence.markDirty(PersistenceService::Store::CONFIG);
+  Preferences::failWrites() = true;
+  hardware.advanceMillis(Timing::PERSIST_QUIET_PERIOD);
+  persistence.update();
+  Preferences::failWrites() = false;
+  TEST_ASSERT_TRUE(persistence.hasPending());
+  TEST_ASSERT_EQUAL(flushes, persistence.getStats().flushes);
+  TEST_ASSERT_EQUAL(1, static_cast<int>(persistence.getStats().failures));
+
+  // Not hammered on every pass, but written once another quiet period is over
+  persistence.update();
+  TEST_ASSERT_TRUE(persistence.hasPending());
+  hardware.advanceMillis(Timing::PERSIST_QUIET_PERIOD);
+  persistence.update();
+  TEST_ASSERT_FALSE(persistence.hasPending());
+  TEST_ASSERT_EQUAL(flushes + 1, persistence.getStats().flushes);
+
+  manager.begin();
+  TEST_ASSERT_EQUAL_STRING("RETRY ME", manager.getStation(2)->getMessage());
+  ConfigManager::getInstance().load();
+  TEST_ASSERT_EQUAL(45, static_cast<int>(ConfigManager::getInstance().getInactivityTimeout()));
+  manager.resetToDefaults();
+  persistence.flush();
+}
+
+void test_flush_before_sleep_closes_persistence() {
+  auto& manager = StationManager::getInstance();
+  auto& persistence = PersistenceService::getInstance();
+  manager.begin();
+  manager.resetToDefaults();
+  persistence.flush();
+
+  // The sleep path writes what is queued, then nothing writes until the next boot
+  manager.updateStation(1, 1401, "BEFORE SLEEP", true);
+  persistence.flushAndClose();
+  TEST_ASSERT_FALSE(persistence.hasPending());
+  size_t before = Preferences::writeCount();
+  manager.updateStation(1, 1402, "AFTER SLEEP", true);
+  persistence.flush();
+  TEST_ASSERT_EQUAL(0, static_cast<int>(Preferences::writeCount() - before));
+
+  persistence.begin();
+  persistence.flush();
+  TEST_ASSERT_TRUE(Preferences::writeCount() > before);
+  manager.resetToDefaults();
+  persistence.flush();
+}
+
 int main() {
   UNITY_BEGIN();
   RUN_TEST(test_station_manager_finds_closest_station_for_band);
   RUN_TEST(test_station_updates_persist_through_preferences_storage);
+  RUN_TEST(test_station_candidates_are_strongest_first_and_capped);
+  RUN_TEST(test_tuning_index_matches_linear_scan_after_edits);
+  RUN_TEST(test_catalogue_adds_and_removes_stations_through_storage);
+  RUN_TEST(test_string_arena_reclaims_replaced_messages);
+  RUN_TEST(test_station_edit_rewrites_only_its_page);
+  RUN_TEST(test_legacy_station_keys_migrate_into_blobs);
+  RUN_TEST(test_legacy_message_over_the_limit_keeps_the_default);
+  RUN_TEST(test_failed_migration_keeps_legacy_keys);
+  RUN_TEST(test_truncated_import_body_changes_nothing);
+  RUN_TEST(test_save_batch_with_a_bad_station_changes_nothing);
+  RUN_TEST(test_failed_page_write_is_retried_before_the_header);
+  RUN_TEST(test_corrupt_station_blob_keeps_defaults);
+  RUN_TEST(test_edits_coalesce_until_the_quiet_period);
+  RUN_TEST(test_failed_flush_is_retried_after_the_quiet_period);
+  RUN_TEST(test_flush_before_sleep_closes_persistence);
   return UNITY_END();
 }
@@ -0,0 +1,218 @@
+#include <unity.h>
+
+#include "../../src/Config.h"
+#include "../../src/MorseTimeline.h"
+#include "../../src/PowerManager.h"
+#include "../../src/RadioState.h"
+#include "../../src/StationManager.h"
+
+#include "../mocks/HardwareEmulator.h"
+#include "../mocks/HardwareEmulator.cpp"
+#include "../sim/InputTrace.cpp"
+#include "../sim/NetworkStandIns.cpp"
+#include "../sim/RadioSimulator.cpp"
+
+namespace {
+constexpr unsigned long MINUTE = 60000UL;
+
+// Index of the station on a band at a dial position, or -1
+int findStation(WaveBand band, int frequency) {
+  const auto& stations = StationManager::getInstance().getAllStations();
+  for (size_t i = 0; i < stations.size(); i++) {
+    if (stations[i].getBand() == band && stations[i].getFrequency() == frequency) {
+      return static_cast<int>(i);
+    }
+  }
+  return -1;
+}
+
+size_t keyedElements(const char* message) {
+  static MorseTimeline timeline;
+  timeline.compile(message);
+  size_t keyed = 0;
+  for (size_t i = 0; i < timeline.size(); i++) {
+    if (MorseTimeline::isKeyed(timeline.at(i))) keyed++;
+  }
+  return keyed;
+}
+}  // namespace
+
+void setUp() {
+  // A fresh board: factory settings and the default catalogue in flash
+  ConfigManager::getInstance().reset();
+  StationManager::getInstance().resetToDefaults();
+}
+
+void tearDown() {}
+
+void test_sim_trace_parses_sweeps_and_switches() {
+  InputTrace trace;
+  TEST_ASSERT_TRUE(trace.parse("# warm up\n"
+                               "0 pot volume 2000\n"
+                               "100 sweep tuning 0 100 50   # five ticks\n"
+                               "\n"
+                               "500 press wifi 80\n"));
+  const auto& events = trace.getEvents();
+  TEST_ASSERT_EQUAL(9, static_cast<int>(events.size()));
+  TEST_ASSERT_EQUAL(Pins::VOLUME_POT, events[0].pin);
+
+  // One pot step per tick, ending exactly on the target
+  TEST_ASSERT_EQUAL(100, static_cast<int>(events[1].atMs));
+  TEST_ASSERT_EQUAL(0, events[1].value);
+  TEST_ASSERT_EQUAL(110, static_cast<int>(events[2].atMs));
+  TEST_ASSERT_EQUAL(150, static_cast<int>(events[6].atMs));
+  TEST_ASSERT_EQUAL(100, events[6].value);
+
+  // A press closes the switch and opens it again after the hold
+  TEST_ASSERT_EQUAL(Pins::WIFI_BUTTON, events[7].pin);
+  TEST_ASSERT_EQUAL(LOW, events[7].value);
+  TEST_ASSERT_EQUAL(HIGH, events[8].value);
+  TEST_ASSERT_EQUAL(580, static_cast<int>(trace.getEndMs()));
+
+  InputTrace broken;
+  TEST_ASSERT_FALSE(broken.parse("0 pot tuning 10\n20 switch lw sideways\n"));
+  TEST_ASSERT_EQUAL(2, static_cast<int>(broken.getErrorLine()));
+}
+
+void test_sim_inactivity_sleep_follows_the_last_switch_flip() {
+  RadioSimulator sim;
+  InputTrace trace;
+  trace.pot(0, Pins::VOLUME_POT, 2000).setSwitch(1 * 60 * MINUTE, Pins::SLOW_DECODE, true);
+  sim.boot(trace);
+
+  // Two hours of idling from the flip, not from boot
+  const unsigned long timeout = ConfigManager::getInstance().getInactivityTimeout() * MINUTE;
+  TEST_ASSERT_TRUE(sim.runUntil(60 * MINUTE + timeout - 1000));
+  TEST_ASSERT_FALSE(sim.runUntil(60 * MINUTE + timeout + 2000));
+  sim.report("inactivity sleep");
+
+  TEST_ASSERT_EQUAL(static_cast<int>(PowerManager::SleepReason::INACTIVITY), sim.getSleepReason());
+  TEST_ASSERT_UINT32_WITHIN(1000, 60 * MINUTE + timeout, sim.getSleep().atMillis);
+  TEST_ASSERT_EQUAL(Pins::POWER_SWITCH, sim.getSleep().wakePin);
+  TEST_ASSERT_EQUAL(LOW, HardwareEmulator::getInstance().getPinState(Pins::BACKLIGHT));
+
+  // Pots at rest are polled on the coarse deadline, not on every system tick
+  const unsigned long deviceMs = sim.getSleep().atMillis;
+  TEST_ASSERT_TRUE(sim.getLoopPasses() <= deviceMs / Timing::POT_POLL_INTERVAL + 1000);
+}
+
+void test_sim_band_switches_move_the_band_and_its_led() {
+  RadioSimulator sim;
+  InputTrace trace;
+  TEST_ASSERT_TRUE(trace.parse("0    pot volume 2000\n"
+                               "1000 switch lw on\n"
+                               "3000 switch lw off\n"
+                               "5000 switch mw on\n"));
+  sim.boot(trace);
+  auto& hw = HardwareEmulator::getInstance();
+  auto& config = ConfigManager::getInstance();
+
+  // No switch closed is medium wave; the MW switch selects short wave
+  TEST_ASSERT_TRUE(sim.runUntil(900));
+  TEST_ASSERT_EQUAL(static_cast<int>(WaveBand::MEDIUM_WAVE), static_cast<int>(config.getWaveBand()));
+  TEST_ASSERT_EQUAL(HIGH, hw.getPinState(Pins::MW_LED));
+
+  // The band follows the switch within a tick
+  TEST_ASSERT_TRUE(sim.runUntil(1000 + Timing::SYSTEM_UPDATE_INTERVAL));
+  TEST_ASSERT_EQUAL(static_cast<int>(WaveBand::LONG_WAVE), static_cast<int>(config.getWaveBand()));
+  TEST_ASSERT_EQUAL(HIGH, hw.getPinState(Pins::LW_LED));
+  TEST_ASSERT_EQUAL(LOW, hw.getPinState(Pins::MW_LED));
+  TEST_ASSERT_EQUAL(static_cast<int>(WaveBand::LONG_WAVE),
+                    static_cast<int>(RadioState::getInstance().getTuning().band));
+
+  TEST_ASSERT_TRUE(sim.runUntil(4000));
+  TEST_ASSERT_EQUAL(static_cast<int>(WaveBand::MEDIUM_WAVE), static_cast<int>(config.getWaveBand()));
+
+  TEST_ASSERT_TRUE(sim.runUntil(6000));
+  TEST_ASSERT_EQUAL(static_cast<int>(WaveBand::SHORT_WAVE), static_cast<int>(config.getWaveBand()));
+  TEST_ASSERT_EQUAL(HIGH, hw.getPinState(Pins::SW_LED));
+  TEST_ASSERT_EQUAL(LOW, hw.getPinState(Pins::LW_LED));
+  sim.report("band change");
+}
+
+void test_sim_long_message_repeats_every_element() {
+  static const char LONG_MESSAGE[] =
+      "THE QUICK BROWN FOX JUMPS OVER THE LAZY DOG 1234567890 "
+      "PACK MY BOX WITH FIVE DOZEN LIQUOR JUGS 0987654321 "
+      "SPHINX OF QUARTZ JUDGE MY VOW";
+
+  RadioSimulator sim;
+  InputTrace trace;
+  trace.pot(0, Pins::VOLUME_POT, 2000).pot(0, Pins::TUNING_POT, 2457);
+  sim.boot(trace);
+
+  // Edited as the web UI would, before the first loop pass tunes in
+  int vienna = findStation(WaveBand::MEDIUM_WAVE, 2457);
+  TEST_ASSERT_TRUE(vienna >= 0);
+  TEST_ASSERT_TRUE(StationManager::getInstance().setStationMessage(vienna, LONG_MESSAGE));
+
+  TEST_ASSERT_TRUE(sim.runFor(45 * MINUTE));
+  sim.report("long message");
+
+  // The message loops for as long as the station stays tuned, every dot and dash keyed
+  const size_t keyed = keyedElements(LONG_MESSAGE);
+  TEST_ASSERT_TRUE(sim.getRisingEdges(Pins::MORSE_LEDS) >= 3 * keyed);
+  TEST_ASSERT_TRUE(RadioState::getInstance().isMorsePlaying());
+  TEST_ASSERT_EQUAL(HIGH, HardwareEmulator::getInstance().getPinState(Pins::LOCK_LED));
+  TEST_ASSERT_EQUAL(1, static_cast<int>(sim.getRisingEdges(Pins::LOCK_LED)));
+}
+
+void test_sim_sweep_locks_onto_each_station_in_turn() {
+  RadioSimulator sim;
+  InputTrace trace;
+  trace.pot(0, Pins::VOLUME_POT, 2000)
+      .setSwitch(0, Pins::LW_BAND_SWITCH, true)
+      .sweep(1000, Pins::TUNING_POT, 0, Radio::ADC_MAX, MINUTE);
+  sim.boot(trace);
+
+  TEST_ASSERT_TRUE(sim.runUntil(2 * MINUTE));
+  sim.report("tuning sweep");
+
+  // Long-wave stations are spaced wider than the tuning leeway, so each is one lock
+  int stations = 0;
+  for (const auto& station : StationManager::getInstance().getAllStations()) {
+    if (station.getBand() == WaveBand::LONG_WAVE) stations++;
+  }
+  TEST_ASSERT_EQUAL(stations, static_cast<int>(sim.getRisingEdges(Pins::LOCK_LED)));
+  TEST_ASSERT_EQUAL(LOW, HardwareEmulator::getInstance().getPinState(Pins::LOCK_LED));
+}
+
+void test_sim_off_tune_station_plays_at_its_beat_pitch_and_level() {
+  // Twenty steps above Vienna: the beat note drops and the station fades with its signal
+  constexpr int VIENNA = 2457;
+  constexpr int DIAL = VIENNA + 20;
+  constexpr int FULL_VOLUME = 255;  // Duty with the volume pot at the top of its travel
+  RadioSimulator sim;
+  InputTrace trace;
+  trace.pot(0, Pins::VOLUME_POT, Radio::ADC_MAX).pot(0, Pins::TUNING_POT, DIAL);
+  sim.boot(trace);
+
+  int vienna = findStation(WaveBand::MEDIUM_WAVE, VIENNA);
+  TEST_ASSERT_TRUE(vienna >= 0);
+  const Station& station = StationManager::getInstance().getAllStations()[vienna];
+  int tone = station.getToneFrequency() != 0 ? station.getToneFrequency() : 600;
+  int strength = station.getSignalStrength(DIAL);
+  TEST_ASSERT_TRUE(strength > 0 && strength < 255);
+
+  // Catch a key-down and read the speaker channel as it sounds
+  auto& hw = HardwareEmulator::getInstance();
+  unsigned long t = 0;
+  while (hw.getPinState(Pins::MORSE_LEDS) != HIGH && t < MINUTE) {
+    t += 1;
+    TEST_ASSERT_TRUE(sim.runUntil(t));
+  }
+  TEST_ASSERT_EQUAL(HIGH, hw.getPinState(Pins::MORSE_LEDS));
+  TEST_ASSERT_EQUAL(tone + (VIENNA - DIAL) * 3, static_cast<int>(hw.getLedcTone(Audio::SPEAKER_CHANNEL)));
+  TEST_ASSERT_EQUAL(FULL_VOLUME * strength / 255, static_cast<int>(hw.getLedcDuty(Audio::SPEAKER_CHANNEL)));
+}
+
+int main() {
+  UNITY_BEGIN();
+  RUN_TEST(test_sim_trace_parses_sweeps_and_switches);
+  RUN_TEST(test_sim_inactivity_sleep_follows_the_last_switch_flip);
+  RUN_TEST(test_sim_band_switches_move_the_band_and_its_led);
+  RUN_TEST(test_sim_long_message_repeats_every_element);
+  RUN_TEST(test_sim_sweep_locks_onto_each_station_in_turn);
+  RUN_TEST(test_sim_off_tune_station_plays_at_its_beat_pitch_and_level);
+  return UNITY_END();
+}
@@ -0,0 +1,286 @@
+    // Live radio state pushed by the device as Server-Sent Events on /events. Each
+    // event only carries the fields that changed, so listeners get the merged state.
+    const radioState = {};
+    const telemetryListeners = [];
+
+    function onTelemetry(listener) {
+        telemetryListeners.push(listener);
+        if (Object.keys(radioState).length > 0) listener(radioState);
+    }
+
+    function updateTelemetry(changes) {
+        Object.assign(radioState, changes);
+        telemetryListeners.forEach(listener => listener(radioState));
+    }
+
+    function startTelemetry() {
+        if (!window.EventSource) {
+            // Browsers without SSE poll the same state; the battery changes slowly
+            if (document.getElementById('currentTuning')) {
+                setInterval(updateTuningValue, 500);
+            }
+            if (document.getElementById('batteryFill')) {
+                updateBatteryValue();
+                setInterval(updateBatteryValue, 5000);
+            }
+            return;
+        }
+        const source = new EventSource('/events');
+        source.onmessage = event => updateTelemetry(JSON.parse(event.data));
+    }
+
+    onTelemetry(state => {
+        const element = document.getElementById('currentTuning');
+        if (element && state.tuning !== undefined) element.textContent = state.tuning;
+    });
+
+    function updateTuningValue() {
+        fetch('/tuning')
+            .then(response => response.json())
+            .then(data => updateTelemetry({ tuning: data.value }))
+            .catch(error => console.error('Error fetching tuning value:', error));
+    }
+
+    function updateBatteryValue() {
+        fetch('/api/battery')
+            .then(response => response.json())
+            .then(data => updateTelemetry(data))
+            .catch(error => console.error('Error fetching battery status:', error));
+    }
+
+    function setFrequency(stationIndex) {
+        fetch('/tuning')
+            .then(response => response.json())
+            .then(data => {
+                const display = document.getElementById('freq_' + stationIndex);
+                if (display) {
+                    display.textContent = data.value;
+                    display.style.backgroundColor = 'var(--success-color)';
+                    display.style.color = 'white';
+                    setTimeout(() => {
+                        display.style.backgroundColor = '';
+                        display.style.color = '';
+                    }, 500);
+                    
+                    // Save the frequency immediately
+                    saveFrequency(stationIndex, data.value);
+                }
+            })
+            .catch(error => console.error('Error setting frequency:', error));
+    }
+
+    function saveFrequency(stationIndex, frequency) {
+        const data = {
+            station: parseInt(stationIndex),
+            frequency: parseInt(frequency)
+        };
+
+        fetch('/save-frequency', {
+            method: 'POST',
+            headers: {
+                'Content-Type': 'application/json',
+            },
+            body: JSON.stringify(data)
+        })
+        .then(response => response.json())
+        .then(data => {
+            if (data.success) {
+                showToast('Frequency saved: ' + frequency);
+            } else {
+                showToast('Failed to save frequency', true);
+            }
+        })
+        .catch(error => {
+            console.error('Error:', error);
+            showToast('Error saving frequency', true);
+        });
+    }
+
+    function showToast(message, isError = false) {
+        const toast = document.createElement('div');
+        toast.className = 'toast' + (isError ? ' error' : '');
+        toast.textContent = message;
+        document.body.appendChild(toast);
+        
+        // Trigger reflow to ensure animation works
+        toast.offsetHeight;
+        toast.classList.add('show');
+        
+        setTimeout(() => {
+            toast.classList.remove('show');
+            setTimeout(() => toast.remove(), 300);
+        }, 3000);
+    }
+
+    function handleFormSubmit(event) {
+        event.preventDefault();
+        const form = event.target;
+        // Look for submit button inside form first, then outside (for floating button)
+        let submitButton = form.querySelector('button[type="submit"]');
+        if (!submitButton) {
+            submitButton = document.querySelector('button[form="' + form.id + '"]');
+        }
+        
+        // Disable button and show saving state
+        if (submitButton) {
+            submitButton.disabled = true;
+            submitButton.classList.add('saving');
+        }
+        
+        // Collect form data into a structured object
+        const stations = [];
+        const stationData = {};
+        
+        // First pass: collect all inputs
+        form.querySelectorAll('input').forEach(input => {
+            const match = input.name.match(/(freq|msg|enable)_(\d+)/);
+            if (match) {
+                const [, type, index] = match;
+                if (!stationData[index]) {
+                    stationData[index] = { index: parseInt(index) };
+                }
+                
+                if (type === 'freq') {
+                    stationData[index].frequency = parseInt(input.value);
+                } else if (type === 'msg') {
+                    stationData[index].message = input.value;
+                } else if (type === 'enable') {
+                    stationData[index].enabled = input.checked;
+                }
+            }
+        });
+        
+        // Convert to array and ensure enabled is set
+        for (const index in stationData) {
+            const station = stationData[index];
+            if (!('enabled' in station)) {
+                station.enabled = false;
+            }
+            stations.push(station);
+        }
+
+        // Send as JSON
+        fetch('/save', {
+            method: 'POST',
+            headers: {
+                'Content-Type': 'application/json',
+            },
+            body: JSON.stringify({ stations })
+        })
+        .then(response => response.json())
+        .then(data => {
+            showToast(data.message, !data.success);
+        })
+        .catch(error => {
+            console.error('Error:', error);
+            showToast('Error saving configuration', true);
+        })
+        .finally(() => {
+            // Re-enable button and remove saving state
+            if (submitButton) {
+                submitButton.disabled = false;
+                submitButton.classList.remove('saving');
+            }
+        });
+    }
+
+    function exportMessages() {
+        fetch('/api/messages')
+            .then(response => response.json())
+            .then(data => {
+                // Create a blob from the JSON data
+                const blob = new Blob([JSON.stringify(data, null, 2)], { type: 'application/json' });
+                const url = URL.createObjectURL(blob);
+                
+                // Create a temporary link and trigger download
+                const a = document.createElement('a');
+                a.href = url;
+                a.download = 'radio-messages-' + new Date().toISOString().split('T')[0] + '.json';
+                document.body.appendChild(a);
+                a.click();
+                
+                // Clean up
+                document.body.removeChild(a);
+                URL.revokeObjectURL(url);
+                
+                showToast('Messages exported successfully');
+            })
+            .catch(error => {
+                console.error('Error exporting messages:', error);
+                showToast('Error exporting messages', true);
+            });
+    }
+
+    function importMessages() {
+        const input = document.getElementById('importFile');
+        if (!input || !input.files || input.files.length === 0) {
+            showToast('Please select a file to import', true);
+            return;
+        }
+
+        const file = input.files[0];
+        const reader = new FileReader();
+
+        reader.onload = function(e) {
+            try {
+                const jsonData = JSON.parse(e.target.result);
+                
+                fetch('/api/messages', {
+                    method: 'POST',
+                    headers: {
+                        'Content-Type': 'application/json',
+                    },
+                    body: JSON.stringify(jsonData)
+                })
+                .then(response => response.json())
+                .then(data => {
+                    if (data.success) {
+                        showToast(data.message);
+                        // Reload the page to show updated messages
+                        setTimeout(() => window.location.reload(), 1500);
+                    } else {
+                        showToast(data.message, true);
+                    }
+                })
+                .catch(error => {
+                    console.error('Error importing messages:', error);
+                    showToast('Error importing messages', true);
+                });
+            } catch (error) {
+                console.error('Error parsing JSON:', error);
+                showToast('Invalid JSON file', true);
+            }
+        };
+
+        reader.onerror = function() {
+            showToast('Error reading file', true);
+        };
+
+        reader.readAsText(file);
+    }
+
+    function triggerFileInput() {
+        const input = document.getElementById('importFile');
+        if (input) {
+            input.click();
+        }
+    }
+
+    document.addEventListener('DOMContentLoaded', () => {
+        // Only the pages showing the dial or the battery listen for updates
+        if (document.getElementById('currentTuning') || document.getElementById('batteryFill')) {
+            startTelemetry();
+        }
+
+        // Add form submit handler
+        const form = document.querySelector('form');
+        if (form) {
+            form.addEventListener('submit', handleFormSubmit);
+        }
+        
+        // Add import file input change handler
+        const importInput = document.getElementById('importFile');
+        if (importInput) {
+            importInput.addEventListener('change', importMessages);
+        }
+    });